@@ -78,6 +78,18 @@ results = infer_request.infer(inputs={0: data})
 results = compiled_model(inputs={0: data})
 #! [sync_infer]
 
+#! [results_without_copy]
+# Read-only results sharing memory with output tensors,
+# they are overwritten by the next inference of the request
+results = infer_request.infer(inputs={0: data}, share_outputs=True)
+results = infer_request.shared_results
+
+# Results are written directly into preallocated arrays
+output_buffer = np.zeros(shape=(8), dtype=np.float32)
+infer_request.set_output_buffers({0: output_buffer})
+infer_request.infer(inputs={0: data})
+#! [results_without_copy]
+
 #! [asyncinferqueue]
 core = ov.Core()
 
@@ -90,6 +90,22 @@ static const char infer_latency_percentile_message[] =
     "Optional. Defines the percentile to be reported in latency metric. The valid range is [1, 100]. The default value "
     "is 50 (median).";
 
+/// @brief message for arrival rate
+static const char arrival_rate_message[] =
+    "Optional. Enables open-loop load generation: inference requests are issued at the given rate (requests per "
+    "second) independently of their completion. Requests arriving when all infer requests are busy are queued, "
+    "queueing and execution times are reported separately. Only async API is supported.";
+
+/// @brief message for arrival distribution
+static const char arrival_message[] =
+    "Optional. Distribution of request arrivals for -arrival_rate: \"constant\" for fixed intervals or \"poisson\" "
+    "for exponentially distributed intervals. Default value is \"constant\".";
+
+/// @brief message for arrival trace
+static const char arrival_trace_message[] =
+    "Optional. Enables open-loop load generation with request arrivals replayed from a text file containing an "
+    "arrival timestamp in milliseconds per line.";
+
 /// @brief message for enforcing of BF16 execution where it is possible
 static const char enforce_bf16_message[] =
     "Optional. By default floating point operations execution in bfloat16 precision are enforced "
@@ -282,6 +298,15 @@ DEFINE_string(nstreams, "", infer_num_streams_message);
 /// @brief The percentile which will be reported in latency metric
 DEFINE_uint32(latency_percentile, 50, infer_latency_percentile_message);
 
+/// @brief Target rate of requests arrival in open-loop mode
+DEFINE_double(arrival_rate, 0, arrival_rate_message);
+
+/// @brief Distribution of requests arrival in open-loop mode
+DEFINE_string(arrival, "constant", arrival_message);
+
+/// @brief Path to a file with timestamps of requests arrival in open-loop mode
+DEFINE_string(arrival_trace, "", arrival_trace_message);
+
 /// @brief Define parameter for batch size <br>
 /// Default is 0 (that means don't specify)
 DEFINE_uint32(b, 0, batch_size_message);
@@ -392,6 +417,9 @@ static void show_usage() {
     std::cout << "    -cache_dir \"<path>\"       " << cache_dir_message << std::endl;
     std::cout << "    -load_from_file           " << load_from_file_message << std::endl;
     std::cout << "    -latency_percentile       " << infer_latency_percentile_message << std::endl;
+    std::cout << "    -arrival_rate \"<float>\"   " << arrival_rate_message << std::endl;
+    std::cout << "    -arrival \"<constant/poisson>\" " << arrival_message << std::endl;
+    std::cout << "    -arrival_trace \"<path>\"   " << arrival_trace_message << std::endl;
     std::cout << std::endl << "  device-specific performance options:" << std::endl;
     std::cout << "    -nstreams \"<integer>\"     " << infer_num_streams_message << std::endl;
     std::cout << "    -nthreads \"<integer>\"     " << infer_num_threads_message << std::endl;
@@ -48,6 +48,15 @@ public:
 
     void start_async() {
         _startTime = Time::now();
+        _arrivalTime = _startTime;
+        _request.start_async();
+    }
+
+    /// @brief Starts the request which arrived at the given time, the time between the arrival and the start
+    /// is reported as the queueing time.
+    void start_async(const Time::time_point& arrivalTime) {
+        _startTime = Time::now();
+        _arrivalTime = std::min(arrivalTime, _startTime);
         _request.start_async();
     }
 
@@ -57,6 +66,7 @@ public:
 
     void infer() {
         _startTime = Time::now();
+        _arrivalTime = _startTime;
         _request.infer();
         _endTime = Time::now();
         _callbackQueue(_id, _lat_group_id, get_execution_time_in_milliseconds(), nullptr);
@@ -84,6 +94,11 @@ public:
         return static_cast<double>(execTime.count()) * 0.000001;
     }
 
+    double get_queueing_time_in_milliseconds() const {
+        auto queueingTime = std::chrono::duration_cast<ns>(_startTime - _arrivalTime);
+        return static_cast<double>(queueingTime.count()) * 0.000001;
+    }
+
     void set_latency_group_id(size_t id) {
         _lat_group_id = id;
     }
@@ -97,6 +112,7 @@ public:
 
 private:
     ov::InferRequest _request;
+    Time::time_point _arrivalTime;
     Time::time_point _startTime;
     Time::time_point _endTime;
     size_t _id;
@@ -141,6 +157,15 @@ public:
         for (auto& group : _latency_groups) {
             group.clear();
         }
+        _queueingHistogram.reset();
+        _executionHistogram.reset();
+        _totalHistogram.reset();
+    }
+
+    /// @brief Enables recording of queueing, execution and total (queueing + execution) latency histograms
+    void enable_latency_histograms() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _histogramsEnabled = true;
     }
 
     double get_duration_in_milliseconds() {
@@ -159,6 +184,12 @@ public:
             if (enable_lat_groups) {
                 _latency_groups[lat_group_id].push_back(latency);
             }
+            if (_histogramsEnabled) {
+                const auto queueing = requests.at(id)->get_queueing_time_in_milliseconds();
+                _queueingHistogram.record(queueing);
+                _executionHistogram.record(latency);
+                _totalHistogram.record(queueing + latency);
+            }
             _idleIds.push(id);
             _endTime = std::max(Time::now(), _endTime);
         }
@@ -205,6 +236,21 @@ public:
         return _latency_groups;
     }
 
+    LatencyHistogram get_queueing_histogram() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        return _queueingHistogram;
+    }
+
+    LatencyHistogram get_execution_histogram() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        return _executionHistogram;
+    }
+
+    LatencyHistogram get_total_histogram() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        return _totalHistogram;
+    }
+
     std::vector<InferReqWrap::Ptr> requests;
 
 private:
@@ -216,5 +262,9 @@ private:
     std::vector<double> _latencies;
     std::vector<std::vector<double>> _latency_groups;
     bool enable_lat_groups;
+    bool _histogramsEnabled = false;
+    LatencyHistogram _queueingHistogram;
+    LatencyHistogram _executionHistogram;
+    LatencyHistogram _totalHistogram;
     std::exception_ptr inferenceException = nullptr;
 };
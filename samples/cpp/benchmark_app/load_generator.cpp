@@ -0,0 +1,70 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// clang-format off
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include "load_generator.hpp"
+// clang-format on
+
+ArrivalSchedule::ArrivalSchedule(double rate, const std::string& distribution) : _rate(rate) {
+    if (rate <= 0) {
+        throw std::logic_error("Arrival rate should be positive.");
+    }
+    if (distribution == "poisson") {
+        _poisson = true;
+        _interval_ms = std::exponential_distribution<double>(rate / 1000.0);
+    } else if (distribution != "constant") {
+        throw std::logic_error("Unknown arrival distribution: " + distribution +
+                               ". Supported distributions are `constant` and `poisson`.");
+    }
+}
+
+ArrivalSchedule::ArrivalSchedule(const std::string& trace_path) {
+    std::ifstream trace(trace_path);
+    if (!trace.is_open()) {
+        throw std::logic_error("Can't open arrival trace file: " + trace_path);
+    }
+    std::string line;
+    while (std::getline(trace, line)) {
+        if (line.find_first_not_of(" \t\r") == std::string::npos) {
+            continue;
+        }
+        try {
+            _trace_ms.push_back(std::stod(line));
+        } catch (const std::exception&) {
+            throw std::logic_error("Can't parse arrival timestamp '" + line + "' in " + trace_path);
+        }
+    }
+    if (_trace_ms.empty()) {
+        throw std::logic_error("Arrival trace file is empty: " + trace_path);
+    }
+
+    // timestamps are replayed relative to the first arrival
+    std::sort(_trace_ms.begin(), _trace_ms.end());
+    const auto first = _trace_ms.front();
+    for (auto& timestamp : _trace_ms) {
+        timestamp -= first;
+    }
+    const auto span_ms = _trace_ms.back();
+    _rate = span_ms > 0 ? (_trace_ms.size() - 1) * 1000.0 / span_ms : 0;
+}
+
+bool ArrivalSchedule::has_next() const {
+    return _trace_ms.empty() || _trace_pos < _trace_ms.size();
+}
+
+ns ArrivalSchedule::next() {
+    double arrival_ms = 0;
+    if (!_trace_ms.empty()) {
+        arrival_ms = _trace_ms.at(_trace_pos++);
+    } else {
+        arrival_ms = _next_ms;
+        _next_ms += _poisson ? _interval_ms(_generator) : 1000.0 / _rate;
+    }
+    return ns(static_cast<int64_t>(arrival_ms * 1000000));
+}
@@ -0,0 +1,45 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <random>
+#include <string>
+#include <vector>
+
+// clang-format off
+#include "utils.hpp"
+// clang-format on
+
+/// @brief Arrival times of inference requests for the open-loop benchmarking. Requests arrive at a target rate
+/// independently of the completion of the previous requests.
+class ArrivalSchedule {
+public:
+    /// @brief Arrivals at the given rate (requests per second) with the "constant" or "poisson" distribution
+    ArrivalSchedule(double rate, const std::string& distribution);
+
+    /// @brief Arrivals replayed from a trace file with a timestamp in milliseconds per line
+    explicit ArrivalSchedule(const std::string& trace_path);
+
+    bool has_next() const;
+
+    /// @brief Returns the time of the next arrival counted from the start of the benchmark
+    ns next();
+
+    /// @brief Returns the mean rate of arrivals in requests per second
+    double get_offered_rate() const {
+        return _rate;
+    }
+
+private:
+    double _rate = 0;
+    bool _poisson = false;
+    double _next_ms = 0;
+    // the generator is seeded with a constant, so the arrivals are the same in every run
+    std::mt19937_64 _generator{0};
+    std::exponential_distribution<double> _interval_ms;
+
+    std::vector<double> _trace_ms;
+    size_t _trace_pos = 0;
+};
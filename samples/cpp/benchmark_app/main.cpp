@@ -7,6 +7,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -24,6 +25,7 @@
 #include "benchmark_app.hpp"
 #include "infer_request_wrap.hpp"
 #include "inputs_filling.hpp"
+#include "load_generator.hpp"
 #include "progress_bar.hpp"
 #include "remote_tensors_filling.hpp"
 #include "statistics_report.hpp"
@@ -55,6 +57,18 @@ bool parse_and_check_command_line(int argc, char* argv[]) {
     if (FLAGS_api != "async" && FLAGS_api != "sync") {
         throw std::logic_error("Incorrect API. Please set -api option to `sync` or `async` value.");
     }
+    if (FLAGS_arrival_rate < 0) {
+        throw std::logic_error("The arrival rate value is incorrect. It should be positive.");
+    }
+    if (FLAGS_arrival != "constant" && FLAGS_arrival != "poisson") {
+        throw std::logic_error("Incorrect arrival distribution. Please set -arrival option to `constant` or `poisson`.");
+    }
+    if (FLAGS_arrival_rate > 0 && !FLAGS_arrival_trace.empty()) {
+        throw std::logic_error("Only one of -arrival_rate and -arrival_trace options can be set.");
+    }
+    if ((FLAGS_arrival_rate > 0 || !FLAGS_arrival_trace.empty()) && FLAGS_api == "sync") {
+        throw std::logic_error("Open-loop load generation is supported only for async API.");
+    }
     if (!FLAGS_hint.empty() && FLAGS_hint != "throughput" && FLAGS_hint != "tput" && FLAGS_hint != "latency" &&
         FLAGS_hint != "cumulative_throughput" && FLAGS_hint != "ctput" && FLAGS_hint != "none") {
         throw std::logic_error("Incorrect performance hint. Please set -hint option to"
@@ -750,8 +764,8 @@ int main(int argc, char* argv[]) {
         if (FLAGS_t != 0) {
             // time limit
             duration_seconds = FLAGS_t;
-        } else if (FLAGS_niter == 0) {
-            // default time limit
+        } else if (FLAGS_niter == 0 && FLAGS_arrival_trace.empty()) {
+            // default time limit, the arrival trace is replayed till the end
             duration_seconds = device_default_device_duration_in_seconds(device_name);
         }
         uint64_t duration_nanoseconds = get_duration_in_nanoseconds(duration_seconds);
@@ -955,17 +969,44 @@ int main(int argc, char* argv[]) {
         }
         inferRequestsQueue.reset_times();
 
+        // In open-loop mode requests are issued at the arrival times independently of the completion of
+        // the previous requests, the time spent waiting for an idle infer request is the queueing time
+        std::unique_ptr<ArrivalSchedule> arrivals;
+        if (FLAGS_arrival_rate > 0) {
+            arrivals.reset(new ArrivalSchedule(FLAGS_arrival_rate, FLAGS_arrival));
+        } else if (!FLAGS_arrival_trace.empty()) {
+            arrivals.reset(new ArrivalSchedule(FLAGS_arrival_trace));
+        }
+        if (arrivals) {
+            inferRequestsQueue.enable_latency_histograms();
+        }
+
         size_t processedFramesN = 0;
         auto startTime = Time::now();
         auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+        auto keep_running = [&]() {
+            if (arrivals) {
+                return arrivals->has_next() && (niter == 0LL || iteration < niter);
+            }
+            return (niter != 0LL && iteration < niter) ||
+                   (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
+                   (FLAGS_api == "async" && iteration % nireq != 0);
+        };
 
         /** Start inference & calculate performance **/
         /** to align number if iterations to guarantee that last infer requests are
          * executed in the same conditions **/
         ProgressBar progressBar(progressBarTotalCount, FLAGS_stream_output, FLAGS_progress);
-        while ((niter != 0LL && iteration < niter) ||
-               (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
+        while (keep_running()) {
+            auto arrivalTime = Time::now();
+            if (arrivals) {
+                const auto arrivalOffset = arrivals->next();
+                if (duration_nanoseconds != 0LL && (uint64_t)arrivalOffset.count() >= duration_nanoseconds) {
+                    break;
+                }
+                arrivalTime = startTime + std::chrono::duration_cast<Time::duration>(arrivalOffset);
+                std::this_thread::sleep_until(arrivalTime);
+            }
             inferRequest = inferRequestsQueue.get_idle_request();
             if (!inferRequest) {
                 IE_THROW() << "No idle Infer Requests!";
@@ -1017,7 +1058,7 @@ int main(int argc, char* argv[]) {
                 // well, but as it uses just error codes it has no details like ‘what()’
                 // method of `std::exception` So, rechecking for any exceptions here.
                 inferRequest->wait();
-                inferRequest->start_async();
+                inferRequest->start_async(arrivalTime);
             }
             ++iteration;
 
@@ -1026,7 +1067,7 @@ int main(int argc, char* argv[]) {
 
             if (niter > 0) {
                 progressBar.add_progress(1);
-            } else {
+            } else if (duration_nanoseconds != 0LL) {
                 // calculate how many progress intervals are covered by current
                 // iteration. depends on the current iteration time and time of each
                 // progress interval. Previously covered progress intervals must be
@@ -1093,6 +1134,36 @@ int main(int argc, char* argv[]) {
             statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                        {StatisticsVariant("throughput", "throughput", fps)});
         }
+
+        LatencyHistogram queueingHistogram, executionHistogram, totalHistogram;
+        double offeredRate = 0, achievedRate = 0;
+        bool saturated = false;
+        if (arrivals) {
+            queueingHistogram = inferRequestsQueue.get_queueing_histogram();
+            executionHistogram = inferRequestsQueue.get_execution_histogram();
+            totalHistogram = inferRequestsQueue.get_total_histogram();
+            offeredRate = arrivals->get_offered_rate();
+            achievedRate = totalDuration > 0 ? 1000.0 * iteration / totalDuration : 0;
+            // requests were queued faster than they were executed, so the achieved rate is the saturation
+            // throughput of the device for the given number of infer requests
+            saturated = achievedRate < 0.95 * offeredRate;
+            if (statistics) {
+                statistics->add_parameters(
+                    StatisticsReport::Category::EXECUTION_RESULTS,
+                    {StatisticsVariant("offered rate (requests/s)", "offered_rate", offeredRate),
+                     StatisticsVariant("achieved rate (requests/s)", "achieved_rate", achievedRate),
+                     StatisticsVariant("saturated", "saturated", std::string(saturated ? "true" : "false")),
+                     StatisticsVariant("queueing latency p50;p90;p99;p99.9;avg;min;max (ms)",
+                                       "queueing_latency",
+                                       queueingHistogram),
+                     StatisticsVariant("execution latency p50;p90;p99;p99.9;avg;min;max (ms)",
+                                       "execution_latency",
+                                       executionHistogram),
+                     StatisticsVariant("total latency p50;p90;p99;p99.9;avg;min;max (ms)",
+                                       "total_latency",
+                                       totalHistogram)});
+            }
+        }
         progressBar.finish();
 
         // ----------------- 11. Dumping statistics report
@@ -1156,6 +1227,21 @@ int main(int argc, char* argv[]) {
             }
         }
         slog::info << "Throughput: " << double_to_string(fps) << " FPS" << slog::endl;
+        if (arrivals) {
+            slog::info << "Offered rate:  " << double_to_string(offeredRate) << " requests/s" << slog::endl;
+            slog::info << "Achieved rate: " << double_to_string(achievedRate) << " requests/s" << slog::endl;
+            if (saturated) {
+                slog::warn << "The device is saturated: requests arrive faster than they are executed, the achieved "
+                              "rate is the saturation throughput."
+                           << slog::endl;
+            }
+            slog::info << "Queueing latency: " << slog::endl;
+            queueingHistogram.write_to_slog();
+            slog::info << "Execution latency: " << slog::endl;
+            executionHistogram.write_to_slog();
+            slog::info << "Total latency (queueing + execution): " << slog::endl;
+            totalHistogram.write_to_slog();
+        }
 
     } catch (const std::exception& ex) {
         slog::err << ex.what() << slog::endl;
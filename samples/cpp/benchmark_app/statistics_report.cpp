@@ -4,6 +4,7 @@
 
 // clang-format off
 #include <algorithm>
+#include <cmath>
 #include <map>
 #include <string>
 #include <utility>
@@ -283,6 +284,101 @@ void LatencyMetrics::fill_data(std::vector<double> latencies, size_t percentile_
     max = latencies.back();
 };
 
+size_t LatencyHistogram::bucket_index(uint64_t value) {
+    // values below 2 * sub_bucket_count are counted exactly, larger values are counted with
+    // sub_bucket_count buckets per power of two
+    size_t shift = 0;
+    while ((value >> shift) >= 2 * sub_bucket_count) {
+        shift++;
+    }
+    return (shift << sub_bucket_bits) + static_cast<size_t>(value >> shift);
+}
+
+uint64_t LatencyHistogram::bucket_upper_bound(size_t index) {
+    if (index < 2 * sub_bucket_count) {
+        return index;
+    }
+    const size_t shift = (index >> sub_bucket_bits) - 1;
+    const uint64_t sub_bucket = index - (shift << sub_bucket_bits);
+    return ((sub_bucket + 1) << shift) - 1;
+}
+
+void LatencyHistogram::record(double latency_ms) {
+    latency_ms = std::max(latency_ms, 0.0);
+    const auto index = bucket_index(static_cast<uint64_t>(std::llround(latency_ms * 1000)));
+    if (index >= _counts.size()) {
+        _counts.resize(index + 1, 0);
+    }
+    _counts[index]++;
+    _min = _count ? std::min(_min, latency_ms) : latency_ms;
+    _max = _count ? std::max(_max, latency_ms) : latency_ms;
+    _sum += latency_ms;
+    _count++;
+}
+
+void LatencyHistogram::reset() {
+    _counts.clear();
+    _count = 0;
+    _sum = 0;
+    _min = 0;
+    _max = 0;
+}
+
+double LatencyHistogram::percentile(double percentile_boundary) const {
+    if (_count == 0) {
+        return 0;
+    }
+    const auto target = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(_count * percentile_boundary / 100)));
+    uint64_t accumulated = 0;
+    for (size_t index = 0; index < _counts.size(); index++) {
+        accumulated += _counts[index];
+        if (accumulated >= target) {
+            return std::min(bucket_upper_bound(index) / 1000.0, _max);
+        }
+    }
+    return _max;
+}
+
+void LatencyHistogram::write_to_stream(std::ostream& stream) const {
+    std::ios::fmtflags fmt(stream.flags());
+    const auto precision = stream.precision();
+    stream << std::fixed << std::setprecision(2) << percentile(50) << ";" << percentile(90) << ";" << percentile(99)
+           << ";" << percentile(99.9) << ";" << avg() << ";" << min() << ";" << max();
+    stream.flags(fmt);
+    stream.precision(precision);
+}
+
+void LatencyHistogram::write_to_slog() const {
+    slog::info << "\tMedian:     " << double_to_string(percentile(50)) << " ms" << slog::endl;
+    slog::info << "\t90 percentile:    " << double_to_string(percentile(90)) << " ms" << slog::endl;
+    slog::info << "\t99 percentile:    " << double_to_string(percentile(99)) << " ms" << slog::endl;
+    slog::info << "\t99.9 percentile:  " << double_to_string(percentile(99.9)) << " ms" << slog::endl;
+    slog::info << "\tAverage:    " << double_to_string(avg()) << " ms" << slog::endl;
+    slog::info << "\tMin:        " << double_to_string(min()) << " ms" << slog::endl;
+    slog::info << "\tMax:        " << double_to_string(max()) << " ms" << slog::endl;
+}
+
+const nlohmann::json LatencyHistogram::to_json() const {
+    nlohmann::json stat;
+    stat["count"] = _count;
+    stat["latency_p50"] = percentile(50);
+    stat["latency_p90"] = percentile(90);
+    stat["latency_p99"] = percentile(99);
+    stat["latency_p99_9"] = percentile(99.9);
+    stat["latency_average"] = avg();
+    stat["latency_min"] = min();
+    stat["latency_max"] = max();
+    // non-empty buckets as [upper bound in ms, number of requests]
+    auto& buckets = stat["buckets"];
+    buckets = nlohmann::json::array();
+    for (size_t index = 0; index < _counts.size(); index++) {
+        if (_counts[index] != 0) {
+            buckets.push_back({bucket_upper_bound(index) / 1000.0, _counts[index]});
+        }
+    }
+    return stat;
+}
+
 std::string StatisticsVariant::to_string() const {
     switch (type) {
     case INT:
@@ -293,11 +389,17 @@ std::string StatisticsVariant::to_string() const {
         return s_val;
     case ULONGLONG:
         return std::to_string(ull_val);
-    case METRICS:
+    case METRICS: {
         std::ostringstream str;
         metrics_val.write_to_stream(str);
         return str.str();
     }
+    case HISTOGRAM: {
+        std::ostringstream str;
+        histogram_val.write_to_stream(str);
+        return str.str();
+    }
+    }
     throw std::invalid_argument("StatisticsVariant::to_string : invalid type is provided");
 }
 
@@ -322,6 +424,9 @@ void StatisticsVariant::write_to_json(nlohmann::json& js) const {
         }
         arr.push_back(metrics_val.to_json());
     } break;
+    case HISTOGRAM:
+        js[json_name] = histogram_val.to_json();
+        break;
     default:
         throw std::invalid_argument("StatisticsVariant:: json conversion : invalid type is provided");
     }
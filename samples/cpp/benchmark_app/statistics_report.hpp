@@ -52,9 +52,54 @@ private:
     size_t percentile_boundary = 50;
 };
 
+/// @brief HDR-style latency histogram. Latencies are counted in log-linear buckets with relative error below
+/// 1 / sub_bucket_count, so the memory and the cost of recording don't depend on the number of requests.
+class LatencyHistogram {
+public:
+    void record(double latency_ms);
+    void reset();
+
+    /// @brief Returns the upper bound of the bucket containing the given percentile in milliseconds
+    double percentile(double percentile_boundary) const;
+
+    size_t count() const {
+        return _count;
+    }
+
+    double avg() const {
+        return _count ? _sum / _count : 0;
+    }
+
+    double min() const {
+        return _count ? _min : 0;
+    }
+
+    double max() const {
+        return _count ? _max : 0;
+    }
+
+    void write_to_stream(std::ostream& stream) const;
+    void write_to_slog() const;
+    const nlohmann::json to_json() const;
+
+private:
+    // latencies are recorded in microseconds, 2^7 sub-buckets give less than 1% error
+    static constexpr size_t sub_bucket_bits = 7;
+    static constexpr uint64_t sub_bucket_count = 1ull << sub_bucket_bits;
+
+    static size_t bucket_index(uint64_t value);
+    static uint64_t bucket_upper_bound(size_t index);
+
+    std::vector<uint64_t> _counts;
+    size_t _count = 0;
+    double _sum = 0;
+    double _min = 0;
+    double _max = 0;
+};
+
 class StatisticsVariant {
 public:
-    enum Type { INT, DOUBLE, STRING, ULONGLONG, METRICS };
+    enum Type { INT, DOUBLE, STRING, ULONGLONG, METRICS, HISTOGRAM };
 
     StatisticsVariant(std::string csv_name, std::string json_name, int v)
         : csv_name(csv_name),
@@ -91,6 +136,11 @@ public:
           json_name(json_name),
           metrics_val(v),
           type(METRICS) {}
+    StatisticsVariant(std::string csv_name, std::string json_name, const LatencyHistogram& v)
+        : csv_name(csv_name),
+          json_name(json_name),
+          histogram_val(v),
+          type(HISTOGRAM) {}
 
     ~StatisticsVariant() {}
 
@@ -101,6 +151,7 @@ public:
     unsigned long long ull_val = 0;
     std::string s_val;
     LatencyMetrics metrics_val;
+    LatencyHistogram histogram_val;
     Type type;
 
     std::string to_string() const;
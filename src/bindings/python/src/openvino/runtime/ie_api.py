@@ -121,7 +121,9 @@ class InferRequest(InferRequestBase):
     """InferRequest class represents infer request which can be run in asynchronous or synchronous manners."""
 
     def infer(
-        self, inputs: Union[dict, list, tuple, Tensor, np.ndarray] = None
+        self,
+        inputs: Union[dict, list, tuple, Tensor, np.ndarray] = None,
+        share_outputs: bool = False,
     ) -> dict:
         """Infers specified input(s) in synchronous mode.
 
@@ -145,32 +147,38 @@ class InferRequest(InferRequestBase):
 
         :param inputs: Data to be set on input tensors.
         :type inputs: Union[Dict[keys, values], List[values], Tuple[values], Tensor, numpy.array], optional
+        :param share_outputs: If `True`, results of static outputs are read-only arrays sharing
+                              memory with output tensors. They are overwritten by the next
+                              inference of this InferRequest. Results of dynamic outputs and
+                              all results if `False` are copied.
+        :type share_outputs: bool, optional
         :return: Dictionary of results from output tensors with ports as keys.
         :rtype: Dict[openvino.runtime.ConstOutput, numpy.array]
         """
         # If inputs are empty, pass empty dictionary.
         if inputs is None:
-            return super().infer({})
+            return super().infer({}, share_outputs)
         # If inputs are dict, normalize dictionary and call infer method.
         elif isinstance(inputs, dict):
-            return super().infer(normalize_inputs(self, inputs))
+            return super().infer(normalize_inputs(self, inputs), share_outputs)
         # If inputs are list or tuple, enumarate inputs and save them as dictionary.
         # It is an extension of above branch with dict inputs.
         elif isinstance(inputs, (list, tuple)):
             return super().infer(
                 normalize_inputs(
                     self, {index: input for index, input in enumerate(inputs)}
-                )
+                ),
+                share_outputs,
             )
         # If inputs are Tensor, call infer method directly.
         elif isinstance(inputs, Tensor):
-            return super().infer(inputs)
+            return super().infer(inputs, share_outputs)
         # If inputs are single numpy array or scalars, use helper function to copy them
         # directly to Tensor or create temporary Tensor to pass into the InferRequest.
         # Pass empty dictionary to infer method, inputs are already set by helper function.
         elif isinstance(inputs, (np.ndarray, np.number, int, float)):
             update_tensor(inputs, self)
-            return super().infer({})
+            return super().infer({}, share_outputs)
         else:
             raise TypeError(f"Incompatible inputs of type: {type(inputs)}")
 
@@ -243,7 +251,9 @@ class CompiledModel(CompiledModelBase):
         return InferRequest(super().create_infer_request())
 
     def infer_new_request(
-        self, inputs: Union[dict, list, tuple, Tensor, np.ndarray] = None
+        self,
+        inputs: Union[dict, list, tuple, Tensor, np.ndarray] = None,
+        share_outputs: bool = False,
     ) -> dict:
         """Infers specified input(s) in synchronous mode.
 
@@ -270,19 +280,25 @@ class CompiledModel(CompiledModelBase):
 
         :param inputs: Data to be set on input tensors.
         :type inputs: Union[Dict[keys, values], List[values], Tuple[values], Tensor, numpy.array], optional
+        :param share_outputs: If `True`, results of static outputs are read-only arrays sharing
+                              memory with output tensors of the temporary InferRequest.
+                              Results of dynamic outputs and all results if `False` are copied.
+        :type share_outputs: bool, optional
         :return: Dictionary of results from output tensors with ports as keys.
         :rtype: Dict[openvino.runtime.ConstOutput, numpy.array]
         """
         # It returns wrapped python InferReqeust and then call upon
         # overloaded functions of InferRequest class
-        return self.create_infer_request().infer(inputs)
+        return self.create_infer_request().infer(inputs, share_outputs)
 
-    def __call__(self, inputs: Union[dict, list] = None) -> dict:
+    def __call__(
+        self, inputs: Union[dict, list] = None, share_outputs: bool = False
+    ) -> dict:
         """Callable infer wrapper for CompiledModel.
 
         Take a look at `infer_new_request` for reference.
         """
-        return self.infer_new_request(inputs)
+        return self.infer_new_request(inputs, share_outputs)
 
 
 class AsyncInferQueue(AsyncInferQueueBase):
@@ -92,6 +92,48 @@ ov::Tensor tensor_from_numpy(py::array& array, bool shared_memory) {
     return tensor;
 }
 
+namespace {
+// Hands out the memory of the array to a single tensor and keeps the array alive until the tensor is released.
+class NumpyAllocator final : public ov::AllocatorImpl {
+public:
+    explicit NumpyAllocator(py::array array) : _array(std::move(array)) {}
+
+    ~NumpyAllocator() {
+        // the last tensor may be released by a plugin thread
+        py::gil_scoped_acquire acquire;
+        _array.release().dec_ref();
+    }
+
+    void* allocate(const size_t bytes, const size_t alignment) override {
+        if (bytes > static_cast<size_t>(_array.nbytes())) {
+            throw ov::Exception("Array is too small to hold the tensor!");
+        }
+        return _array.mutable_data();
+    }
+
+    void deallocate(void* handle, const size_t bytes, size_t alignment) override {}
+
+    bool is_equal(const ov::AllocatorImpl& other) const override {
+        return this == &other;
+    }
+
+private:
+    py::array _array;
+};
+}  // namespace
+
+ov::Tensor tensor_owning_numpy(py::array& array) {
+    if (!(C_CONTIGUOUS == (array.flags() & C_CONTIGUOUS))) {
+        throw ov::Exception("Tensor with shared memory must be C contiguous!");
+    }
+    if (!array.writeable()) {
+        throw ov::Exception("Tensor with shared memory must be writeable!");
+    }
+    auto type = Common::dtype_to_ov_type().at(py::str(array.dtype()));
+    std::vector<size_t> shape(array.shape(), array.shape() + array.ndim());
+    return ov::Tensor(type, shape, ov::Allocator(std::make_shared<NumpyAllocator>(array)));
+}
+
 ov::PartialShape partial_shape_from_list(const py::list& shape) {
     using value_type = ov::Dimension::value_type;
     ov::PartialShape pshape;
@@ -310,10 +352,24 @@ uint32_t get_optimal_number_of_requests(const ov::CompiledModel& actual) {
     }
 }
 
-py::dict outputs_to_dict(const std::vector<ov::Output<const ov::Node>>& outputs, ov::InferRequest& request) {
+py::dict outputs_to_dict(const std::vector<ov::Output<const ov::Node>>& outputs,
+                         ov::InferRequest& request,
+                         bool share_outputs) {
     py::dict res;
     for (const auto& out : outputs) {
         ov::Tensor t{request.get_tensor(out)};
+        // Memory of dynamic outputs may be reallocated by the next inference, so they are always copied.
+        if (share_outputs && out.get_partial_shape().is_static()) {
+            // Read-only view on the tensor memory, the tensor is kept alive by the array.
+            // Types not supported by the copying path are skipped in the same way.
+            const auto type = t.get_element_type();
+            if (type.bitwidth() >= 8 && Common::ov_type_to_dtype().count(type)) {
+                py::array array(Common::ov_type_to_dtype().at(type), t.get_shape(), t.get_strides(), t.data(), py::cast(t));
+                array.attr("flags").attr("writeable") = false;
+                res[py::cast(out)] = array;
+            }
+            continue;
+        }
         switch (t.get_element_type()) {
         case ov::element::Type_t::i8: {
             res[py::cast(out)] = py::array_t<int8_t>(t.get_shape(), t.data<int8_t>());
@@ -32,6 +32,8 @@ ov::Tensor tensor_from_pointer(py::array& array, const ov::Shape& shape, const o
 
 ov::Tensor tensor_from_numpy(py::array& array, bool shared_memory);
 
+ov::Tensor tensor_owning_numpy(py::array& array);
+
 ov::PartialShape partial_shape_from_list(const py::list& shape);
 
 ov::PartialShape partial_shape_from_str(const std::string& value);
@@ -50,7 +52,9 @@ void set_request_tensors(ov::InferRequest& request, const py::dict& inputs);
 
 uint32_t get_optimal_number_of_requests(const ov::CompiledModel& actual);
 
-py::dict outputs_to_dict(const std::vector<ov::Output<const ov::Node>>& outputs, ov::InferRequest& request);
+py::dict outputs_to_dict(const std::vector<ov::Output<const ov::Node>>& outputs,
+                         ov::InferRequest& request,
+                         bool share_outputs = false);
 
 ov::pass::Serialize::Version convert_to_version(const std::string& version);
 
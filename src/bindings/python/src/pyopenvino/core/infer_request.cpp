@@ -18,14 +18,14 @@ PYBIND11_MAKE_OPAQUE(Containers::TensorNameMap);
 
 namespace py = pybind11;
 
-py::dict run_sync_infer(InferRequestWrapper& self) {
+py::dict run_sync_infer(InferRequestWrapper& self, bool share_outputs) {
     {
         py::gil_scoped_release release;
         self._start_time = Time::now();
         self._request.infer();
         self._end_time = Time::now();
     }
-    return Common::outputs_to_dict(self._outputs, self._request);
+    return Common::outputs_to_dict(self._outputs, self._request, share_outputs);
 }
 
 void regclass_InferRequest(py::module m) {
@@ -115,6 +115,39 @@ void regclass_InferRequest(py::module m) {
             :type inputs: Dict[int, openvino.runtime.Tensor]
         )");
 
+    // Python API exclusive function
+    cls.def(
+        "set_output_buffers",
+        [](InferRequestWrapper& self, const py::dict& buffers) {
+            for (auto&& buffer : buffers) {
+                if (!py::isinstance<py::array>(buffer.second)) {
+                    throw py::type_error("Incompatible buffer type for output: " + py::str(buffer.first).cast<std::string>());
+                }
+                auto array = py::reinterpret_borrow<py::array>(buffer.second);
+                // The tensor keeps the array alive, so the buffer can't be released while the request uses it.
+                auto tensor = Common::tensor_owning_numpy(array);
+                if (py::isinstance<ov::Output<const ov::Node>>(buffer.first)) {
+                    self._request.set_tensor(buffer.first.cast<ov::Output<const ov::Node>>(), tensor);
+                } else if (py::isinstance<py::str>(buffer.first)) {
+                    self._request.set_tensor(buffer.first.cast<std::string>(), tensor);
+                } else if (py::isinstance<py::int_>(buffer.first)) {
+                    self._request.set_output_tensor(buffer.first.cast<size_t>(), tensor);
+                } else {
+                    throw py::type_error("Incompatible key type for buffer named: " + py::str(buffer.first).cast<std::string>());
+                }
+            }
+        },
+        py::arg("buffers"),
+        R"(
+            Set preallocated arrays as output tensors, so results are written directly into them.
+
+            Arrays need to be C_CONTIGUOUS, writeable and match the output element type and shape.
+            Their memory is shared with the output tensors and is kept alive while used by this InferRequest.
+
+            :param buffers: Arrays to set as output tensors.
+            :type buffers: Dict[Union[int, str, openvino.runtime.ConstOutput], numpy.array]
+        )");
+
     // Python API exclusive function
     cls.def(
         "set_input_tensors",
@@ -171,11 +204,12 @@ void regclass_InferRequest(py::module m) {
     // Overload for single input, it will throw error if a model has more than one input.
     cls.def(
         "infer",
-        [](InferRequestWrapper& self, const ov::Tensor& inputs) {
+        [](InferRequestWrapper& self, const ov::Tensor& inputs, bool share_outputs) {
             self._request.set_input_tensor(inputs);
-            return run_sync_infer(self);
+            return run_sync_infer(self, share_outputs);
         },
         py::arg("inputs"),
+        py::arg("share_outputs") = false,
         R"(
             Infers specified input(s) in synchronous mode.
             Blocks all methods of InferRequest while request is running.
@@ -185,6 +219,11 @@ void regclass_InferRequest(py::module m) {
 
             :param inputs: Data to set on single input tensor.
             :type inputs: openvino.runtime.Tensor
+            :param share_outputs: If `True`, results of static outputs are read-only arrays sharing
+                                  memory with output tensors. They are overwritten by the next
+                                  inference of this InferRequest. Results of dynamic outputs and
+                                  all results if `False` are copied.
+            :type share_outputs: bool
             :return: Dictionary of results from output tensors with ports as keys.
             :rtype: Dict[openvino.runtime.ConstOutput, numpy.array]
         )");
@@ -197,13 +236,14 @@ void regclass_InferRequest(py::module m) {
     // and values are always of type: ov::Tensor.
     cls.def(
         "infer",
-        [](InferRequestWrapper& self, const py::dict& inputs) {
+        [](InferRequestWrapper& self, const py::dict& inputs, bool share_outputs) {
             // Update inputs if there are any
             Common::set_request_tensors(self._request, inputs);
             // Call Infer function
-            return run_sync_infer(self);
+            return run_sync_infer(self, share_outputs);
         },
         py::arg("inputs"),
+        py::arg("share_outputs") = false,
         R"(
             Infers specified input(s) in synchronous mode.
             Blocks all methods of InferRequest while request is running.
@@ -213,6 +253,11 @@ void regclass_InferRequest(py::module m) {
 
             :param inputs: Data to set on input tensors.
             :type inputs: Dict[Union[int, str, openvino.runtime.ConstOutput], openvino.runtime.Tensor]
+            :param share_outputs: If `True`, results of static outputs are read-only arrays sharing
+                                  memory with output tensors. They are overwritten by the next
+                                  inference of this InferRequest. Results of dynamic outputs and
+                                  all results if `False` are copied.
+            :type share_outputs: bool
             :return: Dictionary of results from output tensors with ports as keys.
             :rtype: Dict[openvino.runtime.ConstOutput, numpy.array]
         )");
@@ -719,6 +764,22 @@ void regclass_InferRequest(py::module m) {
             :rtype: Dict[openvino.runtime.ConstOutput, numpy.array]
         )");
 
+    cls.def_property_readonly(
+        "shared_results",
+        [](InferRequestWrapper& self) {
+            return Common::outputs_to_dict(self._outputs, self._request, true);
+        },
+        R"(
+            Gets all outputs tensors of this InferRequest without copying.
+
+            Results of static outputs are read-only arrays sharing memory with output tensors,
+            they are overwritten by the next inference of this InferRequest.
+            Results of dynamic outputs are copied.
+
+            :return: Dictionary of results from output tensors with ports as keys.
+            :rtype: Dict[openvino.runtime.ConstOutput, numpy.array]
+        )");
+
     cls.def("__repr__", [](const InferRequestWrapper& self) {
         auto inputs_str = Common::docs::container_to_string(self._inputs, ",\n");
         auto outputs_str = Common::docs::container_to_string(self._outputs, ",\n");
@@ -623,6 +623,57 @@ def test_get_results(device):
         assert np.array_equal(results[output], request.results[output])
 
 
+def test_get_shared_results(device):
+    request, arr_1, arr_2 = create_simple_request_and_inputs(device)
+    copied = request.infer([arr_1, arr_2])
+    shared = request.infer([arr_1, arr_2], share_outputs=True)
+    output = request.model_outputs[0]
+    assert np.array_equal(copied[output], shared[output])
+    assert np.shares_memory(shared[output], request.get_output_tensor().data)
+    assert np.shares_memory(request.shared_results[output], request.get_output_tensor().data)
+    assert not shared[output].flags.writeable
+    with pytest.raises(ValueError):
+        shared[output][0] = 0
+    # the view keeps the tensor alive
+    del request
+    assert np.array_equal(copied[output], shared[output])
+
+
+def test_get_shared_results_dynamic_output(device):
+    core = Core()
+    param = ops.parameter(PartialShape([1, -1]), np.float32)
+    model = Model(ops.relu(param), [param])
+    compiled = core.compile_model(model, device)
+    request = compiled.create_infer_request()
+
+    small = np.abs(np.random.normal(size=[1, 4])).astype(np.float32)
+    first = request.infer([small], share_outputs=True)
+    first_result = first[request.model_outputs[0]]
+    # the output grows, so its memory may be reallocated
+    large = np.abs(np.random.normal(size=[1, 4096])).astype(np.float32)
+    second = request.infer([large], share_outputs=True)
+    # results of dynamic outputs are copied
+    assert np.array_equal(first_result, small)
+    assert np.array_equal(second[request.model_outputs[0]], large)
+    assert first_result.flags.writeable
+    assert not np.shares_memory(second[request.model_outputs[0]], request.get_output_tensor().data)
+
+
+def test_set_output_buffers(device):
+    request, arr_1, arr_2 = create_simple_request_and_inputs(device)
+    buffer = np.zeros((2, 2), dtype=np.float32)
+    request.set_output_buffers({0: buffer})
+    results = request.infer([arr_1, arr_2])
+    assert np.array_equal(buffer, arr_1 + arr_2)
+    assert np.array_equal(results[list(results)[0]], buffer)
+    assert np.shares_memory(request.get_output_tensor().data, buffer)
+    with pytest.raises(TypeError):
+        request.set_output_buffers({0: [[0, 0], [0, 0]]})
+    with pytest.raises(RuntimeError) as e:
+        request.set_output_buffers({0: np.zeros((2, 4), dtype=np.float32)[:, ::2]})
+    assert "Tensor with shared memory must be C contiguous" in str(e.value)
+
+
 def test_results_async_infer(device):
     jobs = 8
     num_request = 4
@@ -21,11 +21,23 @@ public:
     OPENVINO_RTTI("ConstantFolding");
     bool run_on_model(const std::shared_ptr<ov::Model>& f) override;
 
+    /// \brief Sets the number of threads folding the sub-graph bodies (e.g. TensorIterator, Loop, If) of the
+    /// model concurrently, 0 (default) uses all the threads of the threading backend, 1 folds the bodies serially.
+    /// The bodies sharing nodes are always folded serially. The result does not depend on the number of threads.
+    /// Parallel folding should be disabled if constant_fold of some operations in the bodies is not thread safe.
+    void set_sub_models_threads(size_t threads) {
+        m_sub_models_threads = threads;
+    }
+
 protected:
     void copy_runtime_info_to_target_inputs(const std::shared_ptr<Node>& node, const Output<Node>& replacement);
     /// \brief Folds pre-calculated output tensor values to constants in case lower and
     /// upper estimations are equal. Traverses graph backwards starting from the results.
     bool pre_calculated_values_folding(const std::shared_ptr<ov::Model>& f);
+    /// \brief Folds bodies of operations containing sub-graphs.
+    bool fold_sub_models(const std::vector<std::shared_ptr<ov::Model>>& sub_models);
+
+    size_t m_sub_models_threads = 0;
 };
 
 /**
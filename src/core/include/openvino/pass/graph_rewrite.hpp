@@ -227,6 +227,11 @@ public:
 protected:
     bool apply_matcher_passes(std::shared_ptr<Model> f, std::deque<std::weak_ptr<Node>> nodes_to_run);
 
+    /// \brief Checks if at least one enabled MatcherPass can be applied to the given operations.
+    /// The check is based on the types of operations in the model and on the root types of
+    /// MatcherPass patterns, so the model traversal is skipped when no pattern root is present.
+    bool has_applicable_matchers(const std::vector<std::shared_ptr<Node>>& ops);
+
     bool m_enable_shape_inference = false;
 
     std::vector<std::shared_ptr<ov::pass::MatcherPass>> m_matchers;
@@ -10,6 +10,7 @@
 
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/op/util/attr_types.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph {
@@ -99,11 +100,58 @@ void autobroadcast_binop(const T* arg0,
                          Functor elementwise_functor) {
     switch (broadcast_spec.m_type) {
     case op::AutoBroadcastType::NONE:
-        for (size_t i = 0; i < shape_size(arg0_shape); i++) {
-            out[i] = elementwise_functor(arg0[i], arg1[i]);
-        }
+        parallel::parallel_for(shape_size(arg0_shape),
+                               parallel::min_elements_per_thread(sizeof(U)),
+                               [&](size_t start, size_t end) {
+                                   for (size_t i = start; i < end; i++) {
+                                       out[i] = elementwise_functor(arg0[i], arg1[i]);
+                                   }
+                               });
         break;
     case op::AutoBroadcastType::NUMPY:
+        // Large outputs are split along the outermost output axis which is not 1,
+        // every thread broadcasts its slices serially
+        if (parallel::get_max_threads() > 1) {
+            const size_t out_rank = std::max(arg0_shape.size(), arg1_shape.size());
+            Shape padded0(out_rank - arg0_shape.size(), 1);
+            padded0.insert(padded0.end(), arg0_shape.begin(), arg0_shape.end());
+            Shape padded1(out_rank - arg1_shape.size(), 1);
+            padded1.insert(padded1.end(), arg1_shape.begin(), arg1_shape.end());
+
+            size_t split_axis = 0;
+            while (split_axis < out_rank && std::max(padded0[split_axis], padded1[split_axis]) == 1)
+                ++split_axis;
+            if (split_axis < out_rank) {
+                const Shape slice0(padded0.begin() + split_axis + 1, padded0.end());
+                const Shape slice1(padded1.begin() + split_axis + 1, padded1.end());
+                size_t out_slice_size = 1;
+                for (size_t i = 0; i < slice0.size(); ++i)
+                    out_slice_size *= std::max(slice0[i], slice1[i]);
+                const size_t dim = std::max(padded0[split_axis], padded1[split_axis]);
+                const size_t min_slices = std::max<size_t>(
+                    1,
+                    parallel::min_elements_per_thread(sizeof(U)) / std::max<size_t>(out_slice_size, 1));
+                if (dim >= 2 * min_slices) {
+                    const size_t step0 = padded0[split_axis] == 1 ? 0 : shape_size(slice0);
+                    const size_t step1 = padded1[split_axis] == 1 ? 0 : shape_size(slice1);
+                    parallel::parallel_for(dim, min_slices, [&](size_t start, size_t end) {
+                        // the range of the slices is broadcast as a tensor with the shortened split axis
+                        Shape range0(padded0.begin() + split_axis, padded0.end());
+                        Shape range1(padded1.begin() + split_axis, padded1.end());
+                        range0[0] = step0 ? end - start : 1;
+                        range1[0] = step1 ? end - start : 1;
+                        autobroadcast_binop(arg0 + start * step0,
+                                            arg1 + start * step1,
+                                            out + start * out_slice_size,
+                                            range0,
+                                            range1,
+                                            broadcast_spec,
+                                            elementwise_functor);
+                    });
+                    break;
+                }
+            }
+        }
         // We'll be using CoordinateTransform to handle the broadcasting. The general
         // procedure is as follows:
         //
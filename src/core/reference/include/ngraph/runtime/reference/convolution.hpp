@@ -16,6 +16,7 @@
 #include "ngraph/runtime/reference/helpers.hpp"
 #include "ngraph/runtime/reference/reverse.hpp"
 #include "ngraph/runtime/reference/split.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/util.hpp"
 
 namespace ngraph {
@@ -234,15 +235,19 @@ void convolution(const T* in,
     const Shape filter_shape(++filters_shape.begin(), filters_shape.end());
     const size_t filter_size = shape_size(filter_shape);
 
-    auto batch = in;
-    for (size_t batch_idx = 0; batch_idx < batches_count; ++batch_idx) {
-        auto filter = f;
-        for (size_t f_idx = 0; f_idx < filters_count; ++f_idx) {
-            convolve_3D_channels(params, batch, batch_shape, filter, filter_shape, out);
-            filter += filter_size;
-        }
-        batch += batch_size;
-    }
+    // every (batch, filter) pair computes a separate output channel, so the pairs are split among threads
+    const size_t channels_count = batches_count * filters_count;
+    const size_t out_channel_size = channels_count == 0 ? 0 : shape_size(out_shape) / channels_count;
+    parallel::parallel_for(channels_count,
+                           parallel::min_items_per_thread(out_channel_size * filter_size),
+                           [&](size_t start, size_t end) {
+                               T* channel_out = out + start * out_channel_size;
+                               for (size_t channel = start; channel < end; ++channel) {
+                                   const auto batch = in + (channel / filters_count) * batch_size;
+                                   const auto filter = f + (channel % filters_count) * filter_size;
+                                   convolve_3D_channels(params, batch, batch_shape, filter, filter_shape, channel_out);
+                               }
+                           });
 }
 }  // namespace reference
 }  // namespace runtime
@@ -6,6 +6,7 @@
 
 #include <numeric>
 
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/shape.hpp"
 #include "utils/span.hpp"
 
@@ -32,28 +33,33 @@ void gather(const T* const data,
     int64_t batch_indices_mul = shape_size(span(indices_shape).subspan(batch_dims));
 
     int64_t axis_size = data_shape[axis];
-    int64_t data_offset, out_offset, idx;
-
-    for (int64_t batch = 0; batch < batch_size; batch++)
-        for (int64_t outer_idx = 0; outer_idx < outer_size; outer_idx++) {
-            data_offset = batch_data_mul * batch + inner_size * axis_size * outer_idx;
-            out_offset = batch_out_mul * batch + indices_size * inner_size * outer_idx;
-            for (int64_t i = 0; i < indices_size; i++) {
-                idx = indices[i + batch_indices_mul * batch];
-                // clang-format off
-                            // todo: check if bound check is needed
-                            // if (idx >= axis_size || (idx < 0 && -idx >= axis_size))
-                            //    throw std::domain_error{"indices values of Gather exceed size along axis"};
-                // clang-format on
-                if (idx < 0)
-                    idx += axis_size;
-
-                const auto src_begin = std::next(data, data_offset + inner_size * idx);
-                const auto src_end = std::next(src_begin, inner_size);
-                const auto out_ptr = std::next(out, out_offset + inner_size * i);
-                std::copy(src_begin, src_end, out_ptr);
-            }
+
+    // every index of every (batch, outer) slice copies a separate part of the output, so they are split among threads
+    const size_t work_amount = batch_size * outer_size * indices_size;
+    const size_t min_work = parallel::min_elements_per_thread(inner_size * sizeof(T));
+    parallel::parallel_for(work_amount, min_work, [&](size_t start, size_t end) {
+        for (size_t item = start; item < end; ++item) {
+            const int64_t i = item % indices_size;
+            const int64_t outer_idx = (item / indices_size) % outer_size;
+            const int64_t batch = item / indices_size / outer_size;
+
+            const int64_t data_offset = batch_data_mul * batch + inner_size * axis_size * outer_idx;
+            const int64_t out_offset = batch_out_mul * batch + indices_size * inner_size * outer_idx;
+            int64_t idx = indices[i + batch_indices_mul * batch];
+            // clang-format off
+            // todo: check if bound check is needed
+            // if (idx >= axis_size || (idx < 0 && -idx >= axis_size))
+            //    throw std::domain_error{"indices values of Gather exceed size along axis"};
+            // clang-format on
+            if (idx < 0)
+                idx += axis_size;
+
+            const auto src_begin = std::next(data, data_offset + inner_size * idx);
+            const auto src_end = std::next(src_begin, inner_size);
+            const auto out_ptr = std::next(out, out_offset + inner_size * i);
+            std::copy(src_begin, src_end, out_ptr);
         }
+    });
 }
 
 }  // namespace reference
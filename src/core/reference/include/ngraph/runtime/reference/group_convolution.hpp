@@ -5,6 +5,7 @@
 #pragma once
 
 #include "ngraph/runtime/reference/convolution.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/util.hpp"
 
 namespace {
@@ -106,12 +107,18 @@ void group_convolution(const INPUT* in,
     }();
     const size_t group_out_size = shape_size(group_out_shape);
 
-    for (size_t batch_idx = 0; batch_idx < in_shape[in_batch_axis]; ++batch_idx) {
-        group_filter = f;
-        for (size_t group_idx = 0; group_idx < group_count; ++group_idx) {
-            runtime::reference::convolution(group_batch,
-                                            group_filter,
-                                            group_out,
+    // Groups are split among threads when there are enough of them (e.g. depthwise convolutions),
+    // otherwise every group is computed by a parallel convolution.
+    const size_t groups_total = in_shape[in_batch_axis] * group_count;
+    const size_t group_ops = group_out_size * (group_filter_size / std::max<size_t>(group_filter_shape[0], 1));
+    const size_t min_groups =
+        groups_total >= parallel::get_max_threads() ? parallel::min_items_per_thread(group_ops) : groups_total;
+    parallel::parallel_for(groups_total, min_groups, [&](size_t start, size_t end) {
+        for (size_t group = start; group < end; ++group) {
+            const size_t group_idx = group % group_count;
+            runtime::reference::convolution(group_batch + group * group_batch_size,
+                                            group_filter + group_idx * group_filter_size,
+                                            group_out + group * group_out_size,
                                             group_batch_shape,
                                             group_filter_shape,
                                             group_out_shape,
@@ -119,11 +126,8 @@ void group_convolution(const INPUT* in,
                                             dilation,
                                             pads_begin,
                                             pads_end);
-            group_batch += group_batch_size;
-            group_filter += group_filter_size;
-            group_out += group_out_size;
         }
-    }
+    });
 }
 }  // namespace reference
 }  // namespace runtime
@@ -14,6 +14,7 @@
 
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/op/interpolate.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph {
@@ -349,10 +350,10 @@ void InterpolateEval<T>::linear_func(const T* input_data, T* out) {
     auto info = helper.get_info_for_linear_mode();
 
     NGRAPH_SUPPRESS_DEPRECATED_START
-    CoordinateTransform output_transform(m_out_shape);
     CoordinateTransform input_transform(m_input_data_shape);
 
-    for (const Coordinate& output_coord : output_transform) {
+    const size_t point_ops = shape_size(info.shape_for_indeces) * m_input_data_shape.size();
+    parallel::for_each_coordinate(m_out_shape, point_ops, [&](size_t out_index, const Coordinate& output_coord) {
         auto icoords_data = helper.get_icoords(output_coord);
 
         float summa = 0.0f;
@@ -370,16 +371,16 @@ void InterpolateEval<T>::linear_func(const T* input_data, T* out) {
         }
 
         if (wsum == 0.0f) {
-            out[output_transform.index(output_coord)] = T{};
+            out[out_index] = T{};
         } else {
             if (std::is_integral<T>()) {
                 // Round value for integral return types
-                out[output_transform.index(output_coord)] = static_cast<T>(std::round(summa / wsum));
+                out[out_index] = static_cast<T>(std::round(summa / wsum));
             } else {
-                out[output_transform.index(output_coord)] = static_cast<T>(summa / wsum);
+                out[out_index] = static_cast<T>(summa / wsum);
             }
         }
-    }
+    });
     NGRAPH_SUPPRESS_DEPRECATED_END
 }
 
@@ -439,10 +440,14 @@ void InterpolateEval<T>::linear_onnx_func(const T* input_data, T* out) {
     const int64_t spatial_rank = info.spatial_rank;
     const int64_t points_in_neighbor = 1LL << spatial_rank;
 
-    const T* xdata = input_data;
-    T* ydata = out;
-    for (int64_t n = 0; n < batch_size; ++n) {
-        for (int64_t c = 0; c < num_channels; ++c) {
+    // channels are independent, so they are split among threads
+    const size_t channels_count = batch_size * num_channels;
+    const size_t point_ops = points_in_neighbor * spatial_rank;
+    const size_t min_channels = parallel::min_items_per_thread(output_data_ptr_increment * point_ops);
+    parallel::parallel_for(channels_count, min_channels, [&](size_t start, size_t end) {
+        for (size_t channel = start; channel < end; ++channel) {
+            const T* xdata = input_data + channel * input_data_ptr_increment;
+            T* ydata = out + channel * output_data_ptr_increment;
             for (int64_t idx = 0; idx < output_data_ptr_increment; ++idx) {
                 // 1. Get the current spatial coords vector.
                 std::vector<int64_t> output_coords(spatial_rank);
@@ -506,11 +511,8 @@ void InterpolateEval<T>::linear_onnx_func(const T* input_data, T* out) {
                 // 6. Store result.
                 ydata[idx] = static_cast<T>(sum);
             }
-
-            xdata += input_data_ptr_increment;
-            ydata += output_data_ptr_increment;
         }
-    }
+    });
 }
 
 template <typename T>
@@ -519,11 +521,11 @@ void InterpolateEval<T>::cubic_func(const T* input_data, T* out) {
     size_t num_of_axes = m_axes.size();
 
     NGRAPH_SUPPRESS_DEPRECATED_START
-    CoordinateTransform output_transform(m_out_shape);
     CoordinateTransform input_transform(m_input_data_shape);
     Shape indices_shape{std::vector<size_t>(num_of_axes, 4)};
 
-    for (const Coordinate& output_coord : output_transform) {
+    const size_t point_ops = shape_size(indices_shape) * num_of_axes;
+    parallel::for_each_coordinate(m_out_shape, point_ops, [&](size_t out_index, const Coordinate& output_coord) {
         std::map<size_t, std::array<float, 4>> cubic_coeffs;
         std::vector<int64_t> base_coords(input_rank, 0);
         for (size_t i = 0; i < num_of_axes; ++i) {
@@ -556,21 +558,21 @@ void InterpolateEval<T>::cubic_func(const T* input_data, T* out) {
             summa += coeffs_prod * input_data[input_transform.index(coords_for_sum)];
         }
 
-        out[output_transform.index(output_coord)] = static_cast<T>(summa);
-    }
+        out[out_index] = static_cast<T>(summa);
+    });
     NGRAPH_SUPPRESS_DEPRECATED_END
 }
 
 template <typename T>
 void InterpolateEval<T>::nearest_func(const T* input_data, T* out) {
     NGRAPH_SUPPRESS_DEPRECATED_START
-    CoordinateTransform output_transform(m_out_shape);
     CoordinateTransform input_transform(m_input_data_shape);
 
-    for (const Coordinate& output_coord : output_transform) {
+    const size_t point_ops = m_out_shape.size();
+    parallel::for_each_coordinate(m_out_shape, point_ops, [&](size_t out_index, const Coordinate& output_coord) {
         auto input_coord = helper.get_input_coords_for_nearest_mode(output_coord);
-        out[output_transform.index(output_coord)] = input_data[input_transform.index(input_coord)];
-    }
+        out[out_index] = input_data[input_transform.index(input_coord)];
+    });
     NGRAPH_SUPPRESS_DEPRECATED_END
 }
 
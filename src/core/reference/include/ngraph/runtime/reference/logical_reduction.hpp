@@ -8,6 +8,7 @@
 #include <numeric>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph {
@@ -17,6 +18,9 @@ static inline void reduce_logical_and(const char* arg,
                                       char* out,
                                       const Shape& in_shape,
                                       const AxisSet& reduction_axes) {
+    if (parallel::split_reduction(arg, out, in_shape, reduction_axes, reduce_logical_and)) {
+        return;
+    }
     constexpr bool dont_keep_dims_in_output = false;
     const auto out_shape = reduce(in_shape, reduction_axes, dont_keep_dims_in_output);
     std::fill(out, out + shape_size(out_shape), 1);
@@ -36,6 +40,9 @@ static inline void reduce_logical_and(const char* arg,
 }
 
 static inline void reduce_logical_or(const char* arg, char* out, const Shape& in_shape, const AxisSet& reduction_axes) {
+    if (parallel::split_reduction(arg, out, in_shape, reduction_axes, reduce_logical_or)) {
+        return;
+    }
     const auto out_shape = reduce(in_shape, reduction_axes, false);
     std::fill(out, out + shape_size(out_shape), 0);
 
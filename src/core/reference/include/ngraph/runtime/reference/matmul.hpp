@@ -11,6 +11,7 @@
 
 #include "ngraph/runtime/opt_kernel/reshape.hpp"
 #include "ngraph/runtime/reference/broadcast.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph {
@@ -24,7 +25,6 @@ void dot(const T* arg0,
          const Shape& arg0_shape,
          const Shape& arg1_shape,
          const Shape& out_shape) {
-    std::fill(out, out + shape_size(out_shape), T{0});
     const size_t arg0_rank = arg0_shape.size();
     const size_t arg1_rank = arg1_shape.size();
 
@@ -35,16 +35,20 @@ void dot(const T* arg0,
     const size_t J_dim = arg1_rank == 1 ? 1 : arg1_shape[arg1_rank - 1];
     const size_t K_dim = arg1_rank == 1 ? arg1_shape[arg1_rank - 1] : arg1_shape[arg1_rank - 2];
 
-    for (size_t i = 0; i < I_dim; ++i) {
-        for (size_t k = 0; k < K_dim; ++k) {
-            const size_t a_idx = i * K_dim + k;
-            for (size_t j = 0; j < J_dim; ++j) {
-                const size_t b_idx = k * J_dim + j;
-                const size_t out_idx = i * J_dim + j;
-                out[out_idx] += arg0[a_idx] * arg1[b_idx];
+    // rows of the output are independent, so they are split among threads
+    parallel::parallel_for(I_dim, parallel::min_items_per_thread(K_dim * J_dim), [&](size_t start, size_t end) {
+        std::fill(out + start * J_dim, out + end * J_dim, T{0});
+        for (size_t i = start; i < end; ++i) {
+            for (size_t k = 0; k < K_dim; ++k) {
+                const size_t a_idx = i * K_dim + k;
+                for (size_t j = 0; j < J_dim; ++j) {
+                    const size_t b_idx = k * J_dim + j;
+                    const size_t out_idx = i * J_dim + j;
+                    out[out_idx] += arg0[a_idx] * arg1[b_idx];
+                }
             }
         }
-    }
+    });
 }
 
 std::vector<size_t> get_transpose_order(const Shape& input_shape);
@@ -208,14 +212,22 @@ void matmul(const T* arg0,
     const size_t arg0_offset = (arg0_rank > 2) ? shape_size(dot_arg0_shape) : 0;
     const size_t arg1_offset = (arg1_rank > 2) ? shape_size(dot_arg1_shape) : 0;
     const size_t output_offset = shape_size(dot_output_shape);
-    for (size_t i = 0; i < output_batch_size; i++) {
-        details::dot(arg0_data + i * arg0_offset,
-                     arg1_data + i * arg1_offset,
-                     out + i * output_offset,
-                     dot_arg0_shape,
-                     dot_arg1_shape,
-                     dot_output_shape);
-    }
+    // Batches are split among threads when there are enough of them, otherwise every dot is parallel
+    // dot_arg1_shape is {K, J} or {K}
+    const size_t batch_ops = output_offset * dot_arg1_shape[0];
+    const size_t min_batches = output_batch_size >= parallel::get_max_threads()
+                                   ? parallel::min_items_per_thread(batch_ops)
+                                   : output_batch_size;
+    parallel::parallel_for(output_batch_size, min_batches, [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; i++) {
+            details::dot(arg0_data + i * arg0_offset,
+                         arg1_data + i * arg1_offset,
+                         out + i * output_offset,
+                         dot_arg0_shape,
+                         dot_arg1_shape,
+                         dot_output_shape);
+        }
+    });
 }
 }  // namespace reference
 }  // namespace runtime
@@ -9,6 +9,7 @@
 #include <numeric>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph {
@@ -16,6 +17,9 @@ namespace runtime {
 namespace reference {
 template <typename T>
 void max(const T* arg, T* out, const Shape& in_shape, const AxisSet& reduction_axes) {
+    if (parallel::split_reduction(arg, out, in_shape, reduction_axes, max<T>)) {
+        return;
+    }
     T minval = std::numeric_limits<T>::lowest();
 
     constexpr bool dont_keep_dims_in_output = false;
@@ -8,6 +8,7 @@
 #include <numeric>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 
 namespace ngraph {
 namespace runtime {
@@ -22,10 +23,9 @@ void max_pool(const T* arg,
               const Shape& padding_below,
               const Shape& padding_above) {
     NGRAPH_SUPPRESS_DEPRECATED_START
-    // At the outermost level we will walk over every output coordinate O.
-    CoordinateTransform output_transform(out_shape);
-
-    for (const Coordinate& out_coord : output_transform) {
+    // At the outermost level we will walk over every output coordinate O, the coordinates are split among threads.
+    const size_t window_size = shape_size(window_shape);
+    parallel::for_each_coordinate(out_shape, window_size, [&](size_t out_index, const Coordinate& out_coord) {
         // Our output coordinate O will have the form:
         //
         //   (N,chan,i_1,...,i_n)
@@ -106,8 +106,8 @@ void max_pool(const T* arg,
             }
         }
 
-        out[output_transform.index(out_coord)] = result;
-    }
+        out[out_index] = result;
+    });
     NGRAPH_SUPPRESS_DEPRECATED_END
 }
 
@@ -341,10 +341,15 @@ void max_pool(const Values_t* data,
     const auto out_batch_elems = shape_size(std::begin(out_shape) + 1, std::end(out_shape));
     const auto out_channel_elems = shape_size(std::begin(out_shape) + 2, std::end(out_shape));
 
-    for (size_t b = 0; b < data_shape[0]; ++b) {
-        const Indices_t batch_indices_offset = b * data_batch_elems;
+    // channels are independent, so they are split among threads
+    const size_t channels_count = data_shape[0] * data_shape[1];
+    const size_t min_channels = parallel::min_items_per_thread(out_channel_elems * shape_size(kernel));
+    parallel::parallel_for(channels_count, min_channels, [&](size_t start, size_t end) {
+        for (size_t channel = start; channel < end; ++channel) {
+            const size_t b = channel / data_shape[1];
+            const size_t c = channel % data_shape[1];
+            const Indices_t batch_indices_offset = b * data_batch_elems;
 
-        for (size_t c = 0; c < data_shape[1]; ++c) {
             // calculate the buffer offsets for a given channel "c" then execute an appropriate
             // kernel for each processed channel
             const Values_t* data_channel_first_elem = data + b * data_batch_elems + c * data_channel_elems;
@@ -397,7 +402,7 @@ void max_pool(const Values_t* data,
                              " passed to the MaxPool reference implementation. Supported shapes: 3D, 4D and 5D.");
             }
         }
-    }
+    });
 
     // adjust the calculated indices to the requested range (specified by the axis attribute) if needed
     if (axis != 0) {
@@ -9,6 +9,7 @@
 #include <numeric>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/shape_util.hpp"
 
 #ifdef _WIN32
@@ -20,6 +21,9 @@ namespace runtime {
 namespace reference {
 template <typename T>
 void min(const T* arg, T* out, const Shape& in_shape, const AxisSet& reduction_axes) {
+    if (parallel::split_reduction(arg, out, in_shape, reduction_axes, min<T>)) {
+        return;
+    }
     T minval =
         std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity() : std::numeric_limits<T>::max();
 
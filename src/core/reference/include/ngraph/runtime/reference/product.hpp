@@ -8,6 +8,7 @@
 #include <numeric>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph {
@@ -15,6 +16,9 @@ namespace runtime {
 namespace reference {
 template <typename T>
 void product(const T* arg, T* out, const Shape& in_shape, const AxisSet& reduction_axes) {
+    if (parallel::split_reduction(arg, out, in_shape, reduction_axes, product<T>)) {
+        return;
+    }
     constexpr bool dont_keep_dims_in_output = false;
     const auto out_shape = reduce(in_shape, reduction_axes, dont_keep_dims_in_output);
     std::fill(out, out + shape_size(out_shape), 1);
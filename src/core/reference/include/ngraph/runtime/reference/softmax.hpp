@@ -9,6 +9,7 @@
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/runtime/reference/max.hpp"
 #include "ngraph/runtime/reference/sum.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph {
@@ -16,6 +17,9 @@ namespace runtime {
 namespace reference {
 template <typename T>
 void softmax(const T* arg, T* out, const Shape& shape, const AxisSet& axes) {
+    if (parallel::split_reduction(arg, out, shape, axes, softmax<T>, true)) {
+        return;
+    }
     auto temp_shape = reduce(shape, axes, true);
     auto temp_elements = shape_size(temp_shape);
     auto temp_ptr = new T[temp_elements];
@@ -0,0 +1,156 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/coordinate.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph {
+namespace runtime {
+namespace reference {
+namespace parallel {
+/// \brief Minimal number of bytes processed by a thread, smaller kernels are executed serially
+///        since starting the threads costs more than the work itself.
+constexpr size_t min_bytes_per_thread = 128 * 1024;
+
+/// \brief Minimal number of arithmetic operations (e.g. multiply-accumulate) executed by a thread.
+constexpr size_t min_ops_per_thread = 64 * 1024;
+
+/// \brief Returns the number of threads available for a parallel region started by the calling thread.
+///        Returns 1 inside a parallel region, nested regions are executed serially, so independent kernels
+///        executed in parallel do not oversubscribe the CPU.
+///
+///        The threading backend follows the THREADING build option (TBB, OMP or SEQ), the reference
+///        library uses std::thread when it is built without the option.
+size_t get_max_threads();
+
+/// \brief Calls func(ithr, nthr) in nthr threads, the calling thread executes one of them.
+///        The first exception thrown by func is rethrown after all the threads are finished.
+void parallel_nt(size_t nthr, const std::function<void(size_t, size_t)>& func);
+
+/// \brief Splits n work items among team threads, the tid thread processes [start, end) items.
+///        The same split as splitter() in ie_parallel.hpp.
+inline void splitter(size_t n, size_t team, size_t tid, size_t& start, size_t& end) {
+    if (team <= 1 || n == 0) {
+        start = 0;
+        end = n;
+    } else {
+        const size_t n1 = (n + team - 1) / team;
+        const size_t n2 = n1 - 1;
+        const size_t t1 = n - n2 * team;
+        end = tid < t1 ? n1 : n2;
+        start = tid <= t1 ? tid * n1 : t1 * n1 + (tid - t1) * n2;
+    }
+    end += start;
+}
+
+/// \brief Calls func(start, end) for the ranges of work_amount items split among threads,
+///        every thread gets at least min_work items.
+template <typename F>
+void parallel_for(size_t work_amount, size_t min_work, const F& func) {
+    const auto nthr = std::min(get_max_threads(), work_amount / std::max<size_t>(min_work, 1));
+    if (nthr <= 1) {
+        if (work_amount > 0) {
+            func(size_t{0}, work_amount);
+        }
+        return;
+    }
+    parallel_nt(nthr, [&](size_t ithr, size_t team) {
+        size_t start = 0, end = 0;
+        splitter(work_amount, team, ithr, start, end);
+        if (start < end) {
+            func(start, end);
+        }
+    });
+}
+
+/// \brief Returns the minimal number of elements of the given size processed by a thread.
+inline size_t min_elements_per_thread(size_t element_size) {
+    return min_bytes_per_thread / std::max<size_t>(element_size, 1);
+}
+
+/// \brief Returns the minimal number of work items processed by a thread when every item costs
+///        item_ops arithmetic operations.
+inline size_t min_items_per_thread(size_t item_ops) {
+    return std::max<size_t>(1, min_ops_per_thread / std::max<size_t>(item_ops, 1));
+}
+
+/// \brief Calls func(index, coordinate) for every coordinate of the shape, index is the row-major index of the
+///        coordinate. The coordinates are split among threads, every call costs item_ops operations.
+template <typename F>
+void for_each_coordinate(const Shape& shape, size_t item_ops, const F& func) {
+    parallel_for(shape_size(shape), min_items_per_thread(item_ops), [&](size_t start, size_t end) {
+        Coordinate coord(shape.size());
+        size_t rest = start;
+        for (size_t axis = shape.size(); axis-- > 0;) {
+            coord[axis] = rest % shape[axis];
+            rest /= shape[axis];
+        }
+        for (size_t index = start; index < end; ++index) {
+            func(index, static_cast<const Coordinate&>(coord));
+            for (size_t axis = shape.size(); axis-- > 0;) {
+                if (++coord[axis] < shape[axis]) {
+                    break;
+                }
+                coord[axis] = 0;
+            }
+        }
+    });
+}
+
+/// \brief Splits a reduction among threads by the non-reduced axes preceding the first reduced axis.
+///        Every part is reduced by reduce_part(arg, out, part_shape, part_axes), so every output element
+///        is accumulated in the same order as by a serial kernel. Returns false if the reduction is not split.
+///        If reduced_axes_in_output is true, the output has the input shape (e.g. softmax normalization).
+template <typename T, typename U, typename F>
+bool split_reduction(const T* arg,
+                     U* out,
+                     const Shape& in_shape,
+                     const AxisSet& reduction_axes,
+                     const F& reduce_part,
+                     bool reduced_axes_in_output = false) {
+    if (get_max_threads() == 1) {
+        return false;
+    }
+    size_t first_reduced = in_shape.size();
+    for (const auto axis : reduction_axes) {
+        first_reduced = std::min(first_reduced, axis);
+    }
+    if (first_reduced == 0) {
+        return false;
+    }
+    const size_t outer_size = shape_size(in_shape.begin(), in_shape.begin() + first_reduced);
+    const size_t inner_in_size = shape_size(in_shape.begin() + first_reduced, in_shape.end());
+    size_t inner_out_size = 1;
+    for (size_t axis = first_reduced; axis < in_shape.size(); ++axis) {
+        if (reduced_axes_in_output || reduction_axes.count(axis) == 0) {
+            inner_out_size *= in_shape[axis];
+        }
+    }
+    const size_t min_work = min_items_per_thread(inner_in_size);
+    if (outer_size < 2 * min_work) {
+        return false;
+    }
+
+    AxisSet part_axes;
+    for (const auto axis : reduction_axes) {
+        part_axes.insert(axis - first_reduced + 1);
+    }
+    parallel_for(outer_size, min_work, [&](size_t start, size_t end) {
+        Shape part_shape{end - start};
+        part_shape.insert(part_shape.end(), in_shape.begin() + first_reduced, in_shape.end());
+        reduce_part(arg + start * inner_in_size, out + start * inner_out_size, part_shape, part_axes);
+    });
+    return true;
+}
+}  // namespace parallel
+}  // namespace reference
+}  // namespace runtime
+}  // namespace ngraph
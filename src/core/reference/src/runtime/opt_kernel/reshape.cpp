@@ -9,10 +9,32 @@
 
 #include "ngraph/check.hpp"
 #include "ngraph/runtime/reference/reshape.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 
 using namespace ngraph;
 
 namespace {
+// Fixed size copies are inlined by the compiler, unlike memcpy calls with a runtime size.
+inline void copy_element(char* out, const char* in, size_t elem_size) {
+    switch (elem_size) {
+    case 1:
+        *out = *in;
+        break;
+    case 2:
+        memcpy(out, in, 2);
+        break;
+    case 4:
+        memcpy(out, in, 4);
+        break;
+    case 8:
+        memcpy(out, in, 8);
+        break;
+    default:
+        memcpy(out, in, elem_size);
+        break;
+    }
+}
+
 void reshape_in0(const char* in,
                  char* out,
                  const Shape& in_shape,
@@ -27,7 +49,9 @@ void reshape_in1(const char* in,
                  const Shape& in_shape,
                  const AxisVector& in_axis_order,
                  const Shape& out_shape,
-                 size_t elem_size) {
+                 size_t elem_size,
+                 size_t first_begin,
+                 size_t first_end) {
     size_t size[1];
     size_t in_index[1];
     size_t* map_index[1];
@@ -35,8 +59,8 @@ void reshape_in1(const char* in,
         size[i] = in_shape[in_axis_order[i]];
         map_index[in_axis_order[i]] = &in_index[i];
     }
-    for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0]) {
-        memcpy(out, in + *map_index[0] * elem_size, elem_size);
+    for (in_index[0] = first_begin; in_index[0] < first_end; ++in_index[0]) {
+        copy_element(out, in + *map_index[0] * elem_size, elem_size);
         out += elem_size;
     }
 }
@@ -46,7 +70,9 @@ void reshape_in2(const char* in,
                  const Shape& in_shape,
                  const AxisVector& in_axis_order,
                  const Shape& out_shape,
-                 size_t elem_size) {
+                 size_t elem_size,
+                 size_t first_begin,
+                 size_t first_end) {
     size_t size[2];
     size_t in_index[2];
     size_t* map_index[2];
@@ -54,13 +80,13 @@ void reshape_in2(const char* in,
         size[i] = in_shape[in_axis_order[i]];
         map_index[in_axis_order[i]] = &in_index[i];
     }
-    for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0]) {
+    for (in_index[0] = first_begin; in_index[0] < first_end; ++in_index[0]) {
         for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1]) {
             // clang-format off
-                memcpy(out,
-                       in + (*map_index[0] * in_shape[1] +
-                             *map_index[1]) * elem_size,
-                       elem_size);
+                copy_element(out,
+                             in + (*map_index[0] * in_shape[1] +
+                                   *map_index[1]) * elem_size,
+                             elem_size);
                 out += elem_size;
             // clang-format on
         }
@@ -72,7 +98,9 @@ void reshape_in3(const char* in,
                  const Shape& in_shape,
                  const AxisVector& in_axis_order,
                  const Shape& out_shape,
-                 size_t elem_size) {
+                 size_t elem_size,
+                 size_t first_begin,
+                 size_t first_end) {
     size_t size[3];
     size_t in_index[3];
     size_t* map_index[3];
@@ -80,15 +108,15 @@ void reshape_in3(const char* in,
         size[i] = in_shape[in_axis_order[i]];
         map_index[in_axis_order[i]] = &in_index[i];
     }
-    for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0]) {
+    for (in_index[0] = first_begin; in_index[0] < first_end; ++in_index[0]) {
         for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1]) {
             for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2]) {
                 // clang-format off
-                    memcpy(out,
-                           in + (*map_index[0] * in_shape[1] * in_shape[2] +
-                                 *map_index[1] * in_shape[2] +
-                                 *map_index[2]) * elem_size,
-                           elem_size);
+                    copy_element(out,
+                                 in + (*map_index[0] * in_shape[1] * in_shape[2] +
+                                       *map_index[1] * in_shape[2] +
+                                       *map_index[2]) * elem_size,
+                                 elem_size);
                     out += elem_size;
                 // clang-format on
             }
@@ -101,7 +129,9 @@ void reshape_in4(const char* in,
                  const Shape& in_shape,
                  const AxisVector& in_axis_order,
                  const Shape& out_shape,
-                 size_t elem_size) {
+                 size_t elem_size,
+                 size_t first_begin,
+                 size_t first_end) {
     size_t size[4];
     size_t in_index[4];
     size_t* map_index[4];
@@ -109,17 +139,17 @@ void reshape_in4(const char* in,
         size[i] = in_shape[in_axis_order[i]];
         map_index[in_axis_order[i]] = &in_index[i];
     }
-    for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0]) {
+    for (in_index[0] = first_begin; in_index[0] < first_end; ++in_index[0]) {
         for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1]) {
             for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2]) {
                 for (in_index[3] = 0; in_index[3] < size[3]; ++in_index[3]) {
                     // clang-format off
-                        memcpy(out,
-                               in + (*map_index[0] * in_shape[1] * in_shape[2] * in_shape[3] +
-                                     *map_index[1] * in_shape[2] * in_shape[3] +
-                                     *map_index[2] * in_shape[3] +
-                                     *map_index[3]) * elem_size,
-                               elem_size);
+                        copy_element(out,
+                                     in + (*map_index[0] * in_shape[1] * in_shape[2] * in_shape[3] +
+                                           *map_index[1] * in_shape[2] * in_shape[3] +
+                                           *map_index[2] * in_shape[3] +
+                                           *map_index[3]) * elem_size,
+                                     elem_size);
                         out += elem_size;
                     // clang-format on
                 }
@@ -133,7 +163,9 @@ void reshape_in5(const char* in,
                  const Shape& in_shape,
                  const AxisVector& in_axis_order,
                  const Shape& out_shape,
-                 size_t elem_size) {
+                 size_t elem_size,
+                 size_t first_begin,
+                 size_t first_end) {
     size_t size[5];
     size_t in_index[5];
     size_t* map_index[5];
@@ -141,19 +173,19 @@ void reshape_in5(const char* in,
         size[i] = in_shape[in_axis_order[i]];
         map_index[in_axis_order[i]] = &in_index[i];
     }
-    for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0]) {
+    for (in_index[0] = first_begin; in_index[0] < first_end; ++in_index[0]) {
         for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1]) {
             for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2]) {
                 for (in_index[3] = 0; in_index[3] < size[3]; ++in_index[3]) {
                     for (in_index[4] = 0; in_index[4] < size[4]; ++in_index[4]) {
                         // clang-format off
-                            memcpy(out,
-                                   in + (*map_index[0] * in_shape[1] * in_shape[2] * in_shape[3] * in_shape[4] +
-                                         *map_index[1] * in_shape[2] * in_shape[3] * in_shape[4] +
-                                         *map_index[2] * in_shape[3] * in_shape[4] +
-                                         *map_index[3] * in_shape[4] +
-                                         *map_index[4]) * elem_size,
-                                   elem_size);
+                            copy_element(out,
+                                         in + (*map_index[0] * in_shape[1] * in_shape[2] * in_shape[3] * in_shape[4] +
+                                               *map_index[1] * in_shape[2] * in_shape[3] * in_shape[4] +
+                                               *map_index[2] * in_shape[3] * in_shape[4] +
+                                               *map_index[3] * in_shape[4] +
+                                               *map_index[4]) * elem_size,
+                                         elem_size);
                             out += elem_size;
                         // clang-format on
                     }
@@ -168,7 +200,9 @@ void reshape_in6(const char* in,
                  const Shape& in_shape,
                  const AxisVector& in_axis_order,
                  const Shape& out_shape,
-                 size_t elem_size) {
+                 size_t elem_size,
+                 size_t first_begin,
+                 size_t first_end) {
     size_t size[6];
     size_t in_index[6];
     size_t* map_index[6];
@@ -176,21 +210,21 @@ void reshape_in6(const char* in,
         size[i] = in_shape[in_axis_order[i]];
         map_index[in_axis_order[i]] = &in_index[i];
     }
-    for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0]) {
+    for (in_index[0] = first_begin; in_index[0] < first_end; ++in_index[0]) {
         for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1]) {
             for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2]) {
                 for (in_index[3] = 0; in_index[3] < size[3]; ++in_index[3]) {
                     for (in_index[4] = 0; in_index[4] < size[4]; ++in_index[4]) {
                         for (in_index[5] = 0; in_index[5] < size[5]; ++in_index[5]) {
                             // clang-format off
-                                memcpy(out,
-                                       in + (*map_index[0] * in_shape[1] * in_shape[2] * in_shape[3] * in_shape[4] * in_shape[5] +
-                                             *map_index[1] * in_shape[2] * in_shape[3] * in_shape[4] * in_shape[5] +
-                                             *map_index[2] * in_shape[3] * in_shape[4] * in_shape[5] +
-                                             *map_index[3] * in_shape[4] * in_shape[5] +
-                                             *map_index[4] * in_shape[5] +
-                                             *map_index[5]) * elem_size,
-                                       elem_size);
+                                copy_element(out,
+                                             in + (*map_index[0] * in_shape[1] * in_shape[2] * in_shape[3] * in_shape[4] * in_shape[5] +
+                                                   *map_index[1] * in_shape[2] * in_shape[3] * in_shape[4] * in_shape[5] +
+                                                   *map_index[2] * in_shape[3] * in_shape[4] * in_shape[5] +
+                                                   *map_index[3] * in_shape[4] * in_shape[5] +
+                                                   *map_index[4] * in_shape[5] +
+                                                   *map_index[5]) * elem_size,
+                                             elem_size);
                                 out += elem_size;
                             // clang-format on
                         }
@@ -213,35 +247,57 @@ void runtime::opt_kernel::reshape(const char* in,
                                   const AxisVector& in_axis_order,
                                   const Shape& out_shape,
                                   size_t elem_size) {
+    namespace parallel = reference::parallel;
     if (no_axis_reordering(in_axis_order)) {
-        std::memcpy(out, in, shape_size(in_shape) * elem_size);
+        const auto size = shape_size(in_shape) * elem_size;
+        parallel::parallel_for(size, parallel::min_bytes_per_thread, [&](size_t start, size_t end) {
+            std::memcpy(out + start, in + start, end - start);
+        });
         return;
     }
 
+    using reshape_kernel = void (*)(const char*,
+                                    char*,
+                                    const Shape&,
+                                    const AxisVector&,
+                                    const Shape&,
+                                    size_t,
+                                    size_t,
+                                    size_t);
+    reshape_kernel kernel = nullptr;
     switch (in_shape.size()) {
     case 0:
         reshape_in0(in, out, in_shape, in_axis_order, out_shape, elem_size);
-        break;
+        return;
     case 1:
-        reshape_in1(in, out, in_shape, in_axis_order, out_shape, elem_size);
+        kernel = reshape_in1;
         break;
     case 2:
-        reshape_in2(in, out, in_shape, in_axis_order, out_shape, elem_size);
+        kernel = reshape_in2;
         break;
     case 3:
-        reshape_in3(in, out, in_shape, in_axis_order, out_shape, elem_size);
+        kernel = reshape_in3;
         break;
     case 4:
-        reshape_in4(in, out, in_shape, in_axis_order, out_shape, elem_size);
+        kernel = reshape_in4;
         break;
     case 5:
-        reshape_in5(in, out, in_shape, in_axis_order, out_shape, elem_size);
+        kernel = reshape_in5;
         break;
     case 6:
-        reshape_in6(in, out, in_shape, in_axis_order, out_shape, elem_size);
+        kernel = reshape_in6;
         break;
     default:
         reference::reshape(in, out, in_shape, in_axis_order, out_shape, elem_size);
-        break;
+        return;
     }
+
+    // The outermost output axis is split among threads, every thread writes a contiguous part of the output.
+    const size_t outer_size = in_shape[in_axis_order[0]];
+    const size_t inner_size = outer_size == 0 ? 0 : shape_size(in_shape) / outer_size;
+    const size_t min_work =
+        std::max<size_t>(1, parallel::min_elements_per_thread(elem_size) / std::max<size_t>(inner_size, 1));
+    parallel::parallel_for(outer_size, min_work, [&](size_t start, size_t end) {
+        kernel(in, out + start * inner_size * elem_size, in_shape, in_axis_order, out_shape, elem_size, start, end);
+    });
 }
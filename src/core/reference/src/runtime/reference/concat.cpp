@@ -6,6 +6,8 @@
 
 #include <cstring>
 
+#include "ngraph/runtime/reference/utils/parallel.hpp"
+
 namespace ngraph {
 namespace runtime {
 namespace reference {
@@ -33,17 +35,27 @@ void concat(const std::vector<const char*>& args,
 
     const auto& shape_sizes = calculate_shape_sizes(in_shapes);
 
-    size_t out_offset = 0;
-    for (size_t step = 0; step < steps; ++step) {
-        for (size_t in_index = 0; in_index < args.size(); ++in_index) {
-            const size_t size = shape_sizes[in_index] / steps;
-            const size_t in_offset = step * size;
+    size_t step_size = 0;
+    for (const auto& size : shape_sizes) {
+        step_size += size / steps;
+    }
+
+    // Every step writes a contiguous part of the output, so the steps are copied in parallel.
+    const size_t min_steps =
+        std::max<size_t>(1, parallel::min_elements_per_thread(elem_size) / std::max<size_t>(step_size, 1));
+    parallel::parallel_for(steps, min_steps, [&](size_t start, size_t end) {
+        size_t out_offset = start * step_size;
+        for (size_t step = start; step < end; ++step) {
+            for (size_t in_index = 0; in_index < args.size(); ++in_index) {
+                const size_t size = shape_sizes[in_index] / steps;
+                const size_t in_offset = step * size;
 
-            std::memcpy(&out[out_offset * elem_size], &args[in_index][in_offset * elem_size], size * elem_size);
+                std::memcpy(&out[out_offset * elem_size], &args[in_index][in_offset * elem_size], size * elem_size);
 
-            out_offset += size;
+                out_offset += size;
+            }
         }
-    }
+    });
 }
 }  // namespace reference
 }  // namespace runtime
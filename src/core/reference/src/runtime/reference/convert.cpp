@@ -5,6 +5,7 @@
 #include "ngraph/runtime/reference/convert.hpp"
 
 #include "jit_generator.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 
 namespace ngraph {
 namespace runtime {
@@ -183,14 +184,19 @@ template <typename TI, typename TO>
 void convert_impl(const TI* arg, TO* out, size_t count) {
     auto converter = jit_convert_array::get<TI, TO>();
 
-    if (converter) {
-        jit_convert_array::args_t args = {arg, out, count};
-        converter(&args);
-    } else {
-        for (size_t i = 0; i < count; ++i) {
-            out[i] = static_cast<TO>(arg[i]);
-        }
-    }
+    // Large weights (e.g. compressed to f16) are converted by ranges in parallel
+    parallel::parallel_for(count,
+                           parallel::min_elements_per_thread(sizeof(TI) + sizeof(TO)),
+                           [&](size_t start, size_t end) {
+                               if (converter) {
+                                   jit_convert_array::args_t args = {arg + start, out + start, end - start};
+                                   converter(&args);
+                               } else {
+                                   for (size_t i = start; i < end; ++i) {
+                                       out[i] = static_cast<TO>(arg[i]);
+                                   }
+                               }
+                           });
 }
 }  // namespace
 
@@ -0,0 +1,105 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph/runtime/reference/utils/parallel.hpp"
+
+#include <exception>
+#include <thread>
+#include <vector>
+
+// The same values as in ie_parallel.hpp, IE_THREAD is defined by set_ie_threading_interface_for()
+#define IE_THREAD_TBB      0
+#define IE_THREAD_OMP      1
+#define IE_THREAD_SEQ      2
+#define IE_THREAD_TBB_AUTO 3
+
+#if defined(IE_THREAD) && (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+#    include "tbb/parallel_for.h"
+#    include "tbb/task_arena.h"
+#elif defined(IE_THREAD) && IE_THREAD == IE_THREAD_OMP
+#    include <omp.h>
+#endif
+
+namespace ngraph {
+namespace runtime {
+namespace reference {
+namespace parallel {
+namespace {
+bool& in_parallel_region() {
+    static thread_local bool in_region = false;
+    return in_region;
+}
+
+size_t get_backend_max_threads() {
+#if defined(IE_THREAD) && (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    return static_cast<size_t>(std::max(1, tbb::this_task_arena::max_concurrency()));
+#elif defined(IE_THREAD) && IE_THREAD == IE_THREAD_OMP
+    return static_cast<size_t>(std::max(1, omp_get_max_threads()));
+#elif defined(IE_THREAD) && IE_THREAD == IE_THREAD_SEQ
+    return 1;
+#else
+    return std::max(1u, std::thread::hardware_concurrency());
+#endif
+}
+
+template <typename F>
+void run_team(size_t nthr, const F& run) {
+#if defined(IE_THREAD) && (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    tbb::parallel_for(
+        size_t{0},
+        nthr,
+        [&](size_t ithr) {
+            run(ithr);
+        },
+        tbb::static_partitioner());
+#elif defined(IE_THREAD) && IE_THREAD == IE_THREAD_OMP
+#    pragma omp parallel for num_threads(static_cast<int>(nthr)) schedule(static, 1)
+    for (int ithr = 0; ithr < static_cast<int>(nthr); ++ithr) {
+        run(static_cast<size_t>(ithr));
+    }
+#else
+    std::vector<std::thread> threads;
+    threads.reserve(nthr - 1);
+    for (size_t ithr = 1; ithr < nthr; ++ithr) {
+        threads.emplace_back(run, ithr);
+    }
+    run(0);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+#endif
+}
+}  // namespace
+
+size_t get_max_threads() {
+    return in_parallel_region() ? 1 : get_backend_max_threads();
+}
+
+void parallel_nt(size_t nthr, const std::function<void(size_t, size_t)>& func) {
+    if (nthr <= 1) {
+        func(size_t{0}, size_t{1});
+        return;
+    }
+    std::vector<std::exception_ptr> errors(nthr);
+    run_team(nthr, [&](size_t ithr) {
+        auto& in_region = in_parallel_region();
+        const auto outer_region = in_region;
+        in_region = true;
+        try {
+            func(ithr, nthr);
+        } catch (...) {
+            errors[ithr] = std::current_exception();
+        }
+        in_region = outer_region;
+    });
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+}  // namespace parallel
+}  // namespace reference
+}  // namespace runtime
+}  // namespace ngraph
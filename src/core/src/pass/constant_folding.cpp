@@ -4,65 +4,252 @@
 
 #include "ngraph/pass/constant_folding.hpp"
 
+#include <atomic>
 #include <ngraph/op/constant.hpp>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "ngraph/op/util/sub_graph_base.hpp"
 #include "ngraph/opsets/opset1.hpp"
 #include "ngraph/opsets/opset3.hpp"
 #include "ngraph/rt_info.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/validation_util.hpp"
 
 using namespace std;
 
+namespace {
+// Nodes with Constant inputs only do not depend on each other, so a batch of such nodes is folded concurrently
+bool can_be_folded_in_batch(const std::shared_ptr<ov::Node>& node) {
+    if (node->get_input_size() == 0 || node->get_output_size() == 0 ||
+        node->get_rt_info().count(ov::pass::DisableConstantFolding::get_type_info_static()) ||
+        ov::is_type<ngraph::op::util::MultiSubGraphOp>(node)) {
+        return false;
+    }
+    const auto& inputs = node->input_values();
+    return std::all_of(inputs.cbegin(), inputs.cend(), [](const ov::Output<ov::Node>& input) {
+        return ov::is_type<ngraph::op::Constant>(input.get_node());
+    });
+}
+
+size_t get_input_bytes(const std::shared_ptr<ov::Node>& node) {
+    size_t bytes = 0;
+    for (const auto& input : node->input_values()) {
+        bytes += ov::as_type<ngraph::op::Constant>(input.get_node())->get_byte_size();
+    }
+    return bytes;
+}
+
+// Returns constant_fold results of the batch nodes, an empty OutputVector if the node is not folded.
+// Nodes with large inputs are folded one by one by parallel kernels, the rest are distributed among threads.
+std::vector<ov::OutputVector> fold_batch(const std::vector<std::shared_ptr<ov::Node>>& batch) {
+    namespace parallel = ngraph::runtime::reference::parallel;
+    std::vector<ov::OutputVector> results(batch.size());
+    auto fold = [&](size_t i) {
+        const auto& node = batch[i];
+        ov::OutputVector replacements(node->get_output_size());
+        if (node->constant_fold(replacements, node->input_values())) {
+            results[i] = std::move(replacements);
+        }
+    };
+
+    // Some constant_fold implementations build temporary nodes on top of the inputs, which changes the consumers
+    // of the input constants, so nodes sharing an input constant are folded by the calling thread.
+    std::unordered_map<const ov::Node*, size_t> constant_consumers;
+    for (const auto& node : batch) {
+        for (const auto& input : node->input_values()) {
+            ++constant_consumers[input.get_node()];
+        }
+    }
+    auto has_shared_inputs = [&](const std::shared_ptr<ov::Node>& node) {
+        const auto& inputs = node->input_values();
+        return std::any_of(inputs.cbegin(), inputs.cend(), [&](const ov::Output<ov::Node>& input) {
+            return constant_consumers[input.get_node()] > 1;
+        });
+    };
+
+    const auto nthr = parallel::get_max_threads();
+    std::vector<size_t> small_nodes;
+    for (size_t i = 0; i < batch.size(); ++i) {
+        if (nthr == 1 || has_shared_inputs(batch[i]) ||
+            get_input_bytes(batch[i]) >= parallel::min_bytes_per_thread * nthr) {
+            fold(i);
+        } else {
+            // Unique names are generated lazily, so they are generated before the nodes are shared among threads
+            for (const auto& input : batch[i]->input_values()) {
+                input.get_node()->get_name();
+            }
+            batch[i]->get_name();
+            small_nodes.push_back(i);
+        }
+    }
+
+    std::atomic<size_t> next{0};
+    parallel::parallel_nt(std::min(nthr, small_nodes.size()), [&](size_t, size_t) {
+        for (auto i = next++; i < small_nodes.size(); i = next++) {
+            fold(small_nodes[i]);
+        }
+    });
+    return results;
+}
+
+// Collects the nodes of the model and of its nested bodies, returns false if a node is already collected
+bool collect_nodes(const std::shared_ptr<ov::Model>& model, std::unordered_set<const ov::Node*>& nodes) {
+    for (const auto& node : model->get_ops()) {
+        if (!nodes.insert(node.get()).second) {
+            return false;
+        }
+        if (auto sub_graph_node = std::dynamic_pointer_cast<ngraph::op::util::MultiSubGraphOp>(node)) {
+            size_t sub_graphs_num = sub_graph_node->get_internal_subgraphs_size();
+            for (size_t sub_graph_ind = 0; sub_graph_ind < sub_graphs_num; ++sub_graph_ind) {
+                const auto& sub_model = sub_graph_node->get_function(sub_graph_ind);
+                if (sub_model && !collect_nodes(sub_model, nodes)) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+// Bodies sharing a node (or the same body of several operations) can not be folded concurrently
+bool are_disjoint(const std::vector<std::shared_ptr<ov::Model>>& sub_models) {
+    std::unordered_set<const ov::Node*> nodes;
+    return std::all_of(sub_models.cbegin(), sub_models.cend(), [&](const std::shared_ptr<ov::Model>& sub_model) {
+        return collect_nodes(sub_model, nodes);
+    });
+}
+}  // namespace
+
 bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& f) {
     bool rewritten = pre_calculated_values_folding(f);
 
+    auto replace_node = [&](const std::shared_ptr<Node>& node, const OutputVector& replacements) {
+        NGRAPH_CHECK(replacements.size() == node->get_output_size(),
+                     "constant_fold_default returned incorrect number of replacements for ",
+                     node);
+
+        for (size_t i = 0; i < replacements.size(); ++i) {
+            auto node_output = node->output(i);
+            auto replacement = replacements.at(i);
+            if (replacement.get_node_shared_ptr() && (node_output != replacement)) {
+                if (replacements.size() == 1) {
+                    replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name());
+                } else {
+                    replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name() + "." +
+                                                                         std::to_string(i));
+                }
+                node_output.replace(replacement);
+                // Propagate runtime info attributes to replacement consumer nodes
+                copy_runtime_info_to_target_inputs(node, replacement);
+
+                rewritten = true;
+            }
+        }
+    };
+
+    // Nodes are collected into a batch until a node consumes an output of the batch
+    std::vector<std::shared_ptr<Node>> batch;
+    std::unordered_set<const Node*> batch_nodes;
+    auto fold_pending = [&]() {
+        const auto results = fold_batch(batch);
+        for (size_t i = 0; i < batch.size(); ++i) {
+            if (!results[i].empty()) {
+                replace_node(batch[i], results[i]);
+            }
+        }
+        batch.clear();
+        batch_nodes.clear();
+    };
+
+    // Bodies of the sub-graph nodes which are not folded are folded together when a node consumes an output of
+    // the pending sub-graph nodes, folding of the bodies does not affect the other nodes
+    std::vector<std::shared_ptr<ov::Model>> sub_models;
+    std::unordered_set<const Node*> sub_graph_nodes;
+    auto fold_pending_sub_models = [&]() {
+        rewritten |= fold_sub_models(sub_models);
+        sub_models.clear();
+        sub_graph_nodes.clear();
+    };
+
     for (const auto& node : f->get_ordered_ops()) {
+        if (!batch.empty()) {
+            const auto& inputs = node->input_values();
+            if (std::any_of(inputs.cbegin(), inputs.cend(), [&](const Output<Node>& input) {
+                    return batch_nodes.count(input.get_node());
+                })) {
+                fold_pending();
+            }
+        }
+        if (!sub_graph_nodes.empty()) {
+            const auto& inputs = node->input_values();
+            if (std::any_of(inputs.cbegin(), inputs.cend(), [&](const Output<Node>& input) {
+                    return sub_graph_nodes.count(input.get_node());
+                })) {
+                fold_pending_sub_models();
+            }
+        }
+
         if (rewritten) {
             node->validate_and_infer_types();
         }
 
+        if (can_be_folded_in_batch(node)) {
+            batch.push_back(node);
+            batch_nodes.insert(node.get());
+            continue;
+        }
+
         OutputVector replacements(node->get_output_size());
 
         // We have to check node for DisableConstantFolding because operations can override constant_folding
         // method, so we can't always rely on attribute check inside default node->constant_fold method
         if (node->get_rt_info().count(DisableConstantFolding::get_type_info_static()) == 0 &&
             node->constant_fold(replacements, node->input_values())) {
-            NGRAPH_CHECK(replacements.size() == node->get_output_size(),
-                         "constant_fold_default returned incorrect number of replacements for ",
-                         node);
-
-            for (size_t i = 0; i < replacements.size(); ++i) {
-                auto node_output = node->output(i);
-                auto replacement = replacements.at(i);
-                if (replacement.get_node_shared_ptr() && (node_output != replacement)) {
-                    if (replacements.size() == 1) {
-                        replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name());
-                    } else {
-                        replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name() + "." +
-                                                                             std::to_string(i));
-                    }
-                    node_output.replace(replacement);
-                    // Propagate runtime info attributes to replacement consumer nodes
-                    copy_runtime_info_to_target_inputs(node, replacement);
-
-                    rewritten = true;
-                }
-            }
-        } else {
-            // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
-            if (auto sub_graph_node = std::dynamic_pointer_cast<ngraph::op::util::MultiSubGraphOp>(node)) {
-                size_t sub_graphs_num = sub_graph_node->get_internal_subgraphs_size();
-                for (size_t sub_graph_ind = 0; sub_graph_ind < sub_graphs_num; ++sub_graph_ind) {
-                    rewritten |= run_on_model(sub_graph_node->get_function(sub_graph_ind));
+            replace_node(node, replacements);
+        } else if (auto sub_graph_node = std::dynamic_pointer_cast<ngraph::op::util::MultiSubGraphOp>(node)) {
+            // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop, If)
+            size_t sub_graphs_num = sub_graph_node->get_internal_subgraphs_size();
+            for (size_t sub_graph_ind = 0; sub_graph_ind < sub_graphs_num; ++sub_graph_ind) {
+                if (const auto& sub_model = sub_graph_node->get_function(sub_graph_ind)) {
+                    sub_models.push_back(sub_model);
                 }
             }
+            sub_graph_nodes.insert(node.get());
         }
     }
+    fold_pending();
+    fold_pending_sub_models();
 
     return rewritten;
 }
 
+bool ov::pass::ConstantFolding::fold_sub_models(const std::vector<std::shared_ptr<ov::Model>>& sub_models) {
+    namespace parallel = ngraph::runtime::reference::parallel;
+    const auto max_threads = m_sub_models_threads ? m_sub_models_threads : parallel::get_max_threads();
+    const auto nthr = std::min(max_threads, sub_models.size());
+    if (nthr <= 1 || !are_disjoint(sub_models)) {
+        bool rewritten = false;
+        for (const auto& sub_model : sub_models) {
+            rewritten |= run_on_model(sub_model);
+        }
+        return rewritten;
+    }
+
+    // The bodies are taken in order by the free threads, nested bodies are folded serially by the thread which folds
+    // the outer body.
+    std::vector<char> sub_model_rewritten(sub_models.size(), false);
+    std::atomic<size_t> next{0};
+    parallel::parallel_nt(nthr, [&](size_t, size_t) {
+        for (auto i = next++; i < sub_models.size(); i = next++) {
+            sub_model_rewritten[i] = run_on_model(sub_models[i]);
+        }
+    });
+    return std::any_of(sub_model_rewritten.cbegin(), sub_model_rewritten.cend(), [](char rewritten) {
+        return rewritten != 0;
+    });
+}
+
 void ngraph::pass::ConstantFolding::copy_runtime_info_to_target_inputs(const std::shared_ptr<Node>& node,
                                                                        const Output<Node>& replacement) {
     for (auto& input : replacement.get_target_inputs()) {
@@ -5,7 +5,9 @@
 #include "ngraph/pass/graph_rewrite.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <deque>
+#include <iomanip>
 #include <iostream>
 #include <ngraph/pattern/op/wrap_type.hpp>
 #include <regex>
@@ -16,6 +18,7 @@
 #include "ngraph/env_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/op/util/sub_graph_base.hpp"
+#include "openvino/util/env_util.hpp"
 #include "perf_counters.hpp"
 
 /* GraphRewrite algorithm:
@@ -57,28 +60,107 @@ PerfCounters& perf_counters_graph_rewrite() {
     static PerfCounters counters;
     return counters;
 }
+
+bool profile_enabled() {
+    static bool enabled =
+        ov::util::getenv_bool("NGRAPH_PROFILE_PASS_ENABLE") || ov::util::getenv_bool("OV_PROFILE_PASS_ENABLE");
+    return enabled;
+}
+
+// Extracts the types of nodes the MatcherPass can be applied to. Returns false when the root of the
+// pattern is not type based (e.g. pattern::any_input()), so the pass has to be tried on every node.
+bool get_root_types(const std::shared_ptr<MatcherPass>& m_pass, std::vector<NodeTypeInfo>& root_types) {
+    auto matcher = m_pass->get_matcher();
+    if (!matcher)
+        return false;
+
+    auto root = matcher->get_pattern_value().get_node_shared_ptr();
+    // pattern::op::AnyOutput operation automatically appends for multi output operations inside
+    // Matcher and to gen actual root node we need to take it's parent.
+    if (auto any_type = std::dynamic_pointer_cast<pattern::op::AnyOutput>(root)) {
+        root = any_type->input_value(0).get_node_shared_ptr();
+    }
+
+    // if root is an operation from opset or has pattern::op::WrapType type then we can extract
+    // it's type
+    if (auto p = std::dynamic_pointer_cast<pattern::op::Pattern>(root)) {
+        if (auto any_type = std::dynamic_pointer_cast<pattern::op::WrapType>(p)) {
+            root_types = any_type->get_wrapped_types();
+            return true;
+        }
+        return false;
+    }
+    root_types = {root->get_type_info()};
+    return true;
+}
 }  // namespace
 }  // namespace pass
 }  // namespace ov
 
 bool ov::pass::BackwardGraphRewrite::run_on_model(const std::shared_ptr<ov::Model>& f) {
+    const auto ordered_ops = f->get_ordered_ops();
+    if (!has_applicable_matchers(ordered_ops))
+        return false;
+
     // Initialize execution queue with nodes in topological order
     std::deque<std::weak_ptr<Node>> nodes_to_run;
-    for (auto& node : f->get_ordered_ops()) {
+    for (auto& node : ordered_ops) {
         nodes_to_run.emplace_front(node);
     }
     return apply_matcher_passes(f, std::move(nodes_to_run));
 }
 
 bool ov::pass::GraphRewrite::run_on_model(const std::shared_ptr<ov::Model>& f) {
+    const auto ordered_ops = f->get_ordered_ops();
+    if (!has_applicable_matchers(ordered_ops))
+        return false;
+
     // Initialize execution queue with nodes in topological order
     std::deque<std::weak_ptr<Node>> nodes_to_run;
-    for (auto& node : f->get_ordered_ops()) {
+    for (auto& node : ordered_ops) {
         nodes_to_run.emplace_back(node);
     }
     return apply_matcher_passes(f, std::move(nodes_to_run));
 }
 
+bool ov::pass::GraphRewrite::has_applicable_matchers(const std::vector<std::shared_ptr<Node>>& ops) {
+    // Nodes are revalidated during the traversal, so it can't be skipped
+    if (m_enable_shape_inference)
+        return true;
+
+    // Types of the operations in the model including the base types, as matchers registered
+    // for a base type are applied to the derived operations too
+    std::unordered_set<NodeTypeInfo> op_types;
+    for (const auto& op : ops) {
+        // Sub-graph bodies are processed by the recursive GraphRewrite run
+        if (std::dynamic_pointer_cast<ngraph::op::util::MultiSubGraphOp>(op))
+            return true;
+        for (auto type_info = &op->get_type_info(); type_info; type_info = type_info->parent) {
+            op_types.insert(*type_info);
+        }
+    }
+
+    // Nodes created by a matcher are visited only when they are registered by that matcher, so if
+    // no matcher can be applied to the original nodes the model stays unchanged
+    const auto& pass_config = get_pass_config();
+    std::vector<NodeTypeInfo> root_types;
+    for (const auto& m_pass : m_matchers) {
+        if (pass_config->is_disabled(m_pass->get_type_info()))
+            continue;
+        if (!get_root_types(m_pass, root_types))
+            return true;
+        for (const auto& root_type : root_types) {
+            if (op_types.count(root_type))
+                return true;
+        }
+    }
+
+    if (profile_enabled()) {
+        std::cout << std::setw(7) << 0 << "ms   " << get_name() << ": skipped, no root operations in the model\n";
+    }
+    return false;
+}
+
 bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
                                                   std::deque<std::weak_ptr<Node>> nodes_to_run) {
     OV_ITT_SCOPED_TASK(ov::itt::domains::nGraph, "pass::GraphRewrite::run_on_function");
@@ -86,52 +168,37 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
     bool rewritten = false;
     const auto& pass_config = get_pass_config();
 
-    // Check that all Matchers in MatcherPasses has type bases root node
-    bool all_roots_has_type = true;
+    // MatcherPasses with type based root node are stored in unordered_map for fast search by the
+    // node type. The rest of MatcherPasses are applied to every node.
     std::unordered_map<NodeTypeInfo, std::vector<size_t>> type_to_matcher;
+    std::vector<size_t> any_type_matchers;
+    std::vector<NodeTypeInfo> root_types;
     for (size_t matcher_index = 0; matcher_index < m_matchers.size(); ++matcher_index) {
         // Skip passes that are disabled
         if (pass_config->is_disabled(m_matchers[matcher_index]->get_type_info()))
             continue;
 
-        auto matcher = m_matchers[matcher_index]->get_matcher();
-        if (!matcher) {
-            all_roots_has_type = false;
-            break;
-        }
-
-        auto root = matcher->get_pattern_value().get_node_shared_ptr();
-        // pattern::op::AnyOutput operation automatically appends for multi output operations inside
-        // Matcher and to gen actual root node we need to take it's parent.
-        if (auto any_type = std::dynamic_pointer_cast<pattern::op::AnyOutput>(root)) {
-            root = any_type->input_value(0).get_node_shared_ptr();
-        }
-
-        // if root is an operation from opset or has pattern::op::WrapType type then we can extract
-        // it's type
-        // and use it in unordered_map as key for fast MatcherPass search. Otherwise type is unknown
-        // and default algorithm is used.
-        if (auto p = std::dynamic_pointer_cast<pattern::op::Pattern>(root)) {
-            if (auto any_type = std::dynamic_pointer_cast<pattern::op::WrapType>(p)) {
-                for (const auto& root_type_info : any_type->get_wrapped_types()) {
-                    type_to_matcher[root_type_info].push_back(matcher_index);
-                }
-            } else {
-                all_roots_has_type = false;
-                break;
+        if (get_root_types(m_matchers[matcher_index], root_types)) {
+            for (const auto& root_type_info : root_types) {
+                type_to_matcher[root_type_info].push_back(matcher_index);
             }
         } else {
-            type_to_matcher[root->get_type_info()].push_back(matcher_index);
+            any_type_matchers.push_back(matcher_index);
         }
-
-        // TODO: traverse parents for root_type_info in order to register complete list of matchers
-        // including ones triggered by parent type info.
     }
 
+    // Number of nodes each MatcherPass was applied to and number of successful applications, collected
+    // when the transformations profiling is enabled
+    const bool collect_statistics = profile_enabled();
+    std::vector<size_t> applied_count(collect_statistics ? m_matchers.size() : 0, 0);
+    std::vector<size_t> matched_count(collect_statistics ? m_matchers.size() : 0, 0);
+    std::vector<double> elapsed_ms(collect_statistics ? m_matchers.size() : 0, 0.);
+
     // This lambda preforms execution of particular MatcherPass on given node.
     // It automatically handles nodes registered by MatcherPass during transformation and set
     // transformation callback.
-    auto run_matcher_pass = [&](std::shared_ptr<MatcherPass> m_pass, std::shared_ptr<Node> node) -> bool {
+    auto run_matcher_pass = [&](size_t matcher_index, std::shared_ptr<Node> node) -> bool {
+        const auto& m_pass = m_matchers[matcher_index];
         // Keep this property check for backward compatibility. In future transformation property
         // will be deprecated and removed.
         if (m_pass->get_property(PassProperty::REQUIRE_STATIC_SHAPE) && f->is_dynamic()) {
@@ -144,7 +211,17 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
 
         // Apply MatcherPass. In case if it returns true no other MatcherPasses will apply
         // to this node
-        bool status = m_pass->apply(node);
+        bool status = false;
+        if (collect_statistics) {
+            const auto start = std::chrono::steady_clock::now();
+            status = m_pass->apply(node);
+            elapsed_ms[matcher_index] +=
+                std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            applied_count[matcher_index]++;
+            matched_count[matcher_index] += status;
+        } else {
+            status = m_pass->apply(node);
+        }
 
         // In case if MatcherPass registered nodes they will be added to the beginning of execution
         // queue
@@ -183,48 +260,38 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         if (m_enable_shape_inference) {
             node->revalidate_and_infer_types();
         }
-        // If all Matchers in MatcherPasses has type based root node then we apply efficient
-        // algorithm for finding matchers
-        if (all_roots_has_type) {
-            const DiscreteTypeInfo* node_type_info = &node->get_type_info();
-            matcher_passes_to_run.clear();
-            while (node_type_info) {
-                auto matchers = type_to_matcher.find(*node_type_info);
-                if (matchers != type_to_matcher.end()) {
-                    // do not run found matchers immediately, need to collect all matchers for
-                    // parents
-                    // and sort them in order of the registration
-                    matcher_passes_to_run.insert(matcher_passes_to_run.end(),
-                                                 matchers->second.begin(),
-                                                 matchers->second.end());
-                }
-                node_type_info = node_type_info->parent;
-            }
 
-            std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
+        // Collect the matchers registered for the node type and its parents as well as the matchers
+        // without type based root and apply them in order of the registration
+        const DiscreteTypeInfo* node_type_info = &node->get_type_info();
+        matcher_passes_to_run.assign(any_type_matchers.begin(), any_type_matchers.end());
+        while (node_type_info) {
+            auto matchers = type_to_matcher.find(*node_type_info);
+            if (matchers != type_to_matcher.end()) {
+                matcher_passes_to_run.insert(matcher_passes_to_run.end(),
+                                             matchers->second.begin(),
+                                             matchers->second.end());
+            }
+            node_type_info = node_type_info->parent;
+        }
 
-            // TODO: type_to_matcher with just collected list of matchers to enable
-            // fast processing at the next time when node with the same type will be processed
+        std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
 
-            for (size_t matcher_index : matcher_passes_to_run) {
-                if (run_matcher_pass(m_matchers[matcher_index], node)) {
-                    rewritten = true;
-                    break;
-                }
+        for (size_t matcher_index : matcher_passes_to_run) {
+            if (run_matcher_pass(matcher_index, node)) {
+                rewritten = true;
+                break;
             }
         }
-        // Otherwise we use default algorithm that iterates over all registered matcher passes
-        else {
-            for (auto& m_pass : m_matchers) {
-                // Skip passes that are disabled
-                if (pass_config->is_disabled(m_pass->get_type_info()))
-                    continue;
-
-                if (run_matcher_pass(m_pass, node)) {
-                    rewritten = true;
-                    break;
-                }
-            }
+    }
+
+    if (collect_statistics) {
+        for (size_t matcher_index = 0; matcher_index < m_matchers.size(); ++matcher_index) {
+            if (applied_count[matcher_index] == 0)
+                continue;
+            std::cout << std::setw(7) << static_cast<size_t>(elapsed_ms[matcher_index]) << "ms   "
+                      << m_matchers[matcher_index]->get_name() << ": " << matched_count[matcher_index] << " of "
+                      << applied_count[matcher_index] << " nodes matched\n";
         }
     }
     return rewritten;
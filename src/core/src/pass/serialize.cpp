@@ -5,10 +5,15 @@
 #include "openvino/pass/serialize.hpp"
 
 #include <array>
+#include <atomic>
 #include <cassert>
 #include <cstdint>
+#include <cstring>
 #include <fstream>
+#include <limits>
+#include <mutex>
 #include <ngraph/variant.hpp>
+#include <set>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -16,6 +21,8 @@
 #include "ngraph/ops.hpp"
 #include "ngraph/opsets/opset.hpp"
 #include "ngraph/opsets/opset1.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "openvino/op/util/framework_node.hpp"
 #include "openvino/pass/constant_folding.hpp"
 #include "pugixml.hpp"
@@ -60,63 +67,334 @@ std::string translate_type_name(const std::string& name) {
     return name;
 }
 
-size_t hash_combine(const void* v, int64_t size) {
-    constexpr auto cel_size = sizeof(size_t);
-    auto seed = static_cast<size_t>(size);
-    const auto data = static_cast<const size_t*>(v);
-    const auto d_end = std::next(data, size / cel_size);
-    // The constant value used as a magic number has been
-    // traditionally used e.g. in boost library's hash_combine.
-    // It happens to be derived from the golden ratio.
-    for (auto d = data; d != d_end; ++d) {
-        seed ^= *d + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-    }
-    size_t last_bytes{0};
-    std::memcpy(&last_bytes, d_end, size % cel_size);
-    seed ^= last_bytes + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-    return seed;
+// Byte ranges (e.g. constant data) are hashed with the xxHash64 algorithm.
+constexpr uint64_t prime64_1 = 11400714785074694791ULL;
+constexpr uint64_t prime64_2 = 14029467366897019727ULL;
+constexpr uint64_t prime64_3 = 1609587929392839161ULL;
+constexpr uint64_t prime64_4 = 9650029242287828579ULL;
+constexpr uint64_t prime64_5 = 2870177450012600261ULL;
+
+inline uint64_t rotl64(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+inline uint64_t read64(const uint8_t* p) {
+    uint64_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+inline uint32_t read32(const uint8_t* p) {
+    uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+inline uint64_t hash_round(uint64_t acc, uint64_t input) {
+    acc += input * prime64_2;
+    acc = rotl64(acc, 31);
+    return acc * prime64_1;
+}
+
+inline uint64_t merge_round(uint64_t acc, uint64_t value) {
+    acc ^= hash_round(0, value);
+    return acc * prime64_1 + prime64_4;
 }
 
+inline uint64_t avalanche(uint64_t h) {
+    h ^= h >> 33;
+    h *= prime64_2;
+    h ^= h >> 29;
+    h *= prime64_3;
+    h ^= h >> 32;
+    return h;
+}
+
+uint64_t hash_bytes(const void* data, size_t size, uint64_t seed) {
+    auto p = static_cast<const uint8_t*>(data);
+    const auto end = p + size;
+    uint64_t h;
+    if (size >= 32) {
+        const auto limit = end - 32;
+        uint64_t v1 = seed + prime64_1 + prime64_2;
+        uint64_t v2 = seed + prime64_2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - prime64_1;
+        do {
+            v1 = hash_round(v1, read64(p));
+            v2 = hash_round(v2, read64(p + 8));
+            v3 = hash_round(v3, read64(p + 16));
+            v4 = hash_round(v4, read64(p + 24));
+            p += 32;
+        } while (p <= limit);
+        h = rotl64(v1, 1) + rotl64(v2, 7) + rotl64(v3, 12) + rotl64(v4, 18);
+        h = merge_round(h, v1);
+        h = merge_round(h, v2);
+        h = merge_round(h, v3);
+        h = merge_round(h, v4);
+    } else {
+        h = seed + prime64_5;
+    }
+    h += static_cast<uint64_t>(size);
+    for (; p + 8 <= end; p += 8) {
+        h ^= hash_round(0, read64(p));
+        h = rotl64(h, 27) * prime64_1 + prime64_4;
+    }
+    if (p + 4 <= end) {
+        h ^= static_cast<uint64_t>(read32(p)) * prime64_1;
+        h = rotl64(h, 23) * prime64_2 + prime64_3;
+        p += 4;
+    }
+    for (; p < end; ++p) {
+        h ^= (*p) * prime64_5;
+        h = rotl64(h, 11) * prime64_1;
+    }
+    return avalanche(h);
+}
+
+// Constants larger than the chunk are hashed by chunks in parallel, the chunk size is fixed,
+// so the hash does not depend on the number of threads
+constexpr size_t constant_hash_chunk_size = 1 << 20;
+
+uint64_t combine_chunk_hashes(const std::vector<uint64_t>& chunk_hashes, size_t size) {
+    uint64_t h = prime64_5 + static_cast<uint64_t>(size);
+    for (const auto chunk_hash : chunk_hashes) {
+        h = merge_round(h, chunk_hash);
+    }
+    return avalanche(h);
+}
+
+using BufferPtr = std::shared_ptr<ngraph::runtime::AlignedBuffer>;
+// Type of the buffers which the IR frontend creates for the constants read from the memory mapped weights file
+using MappedWeightsBuffer = ngraph::runtime::SharedBuffer<BufferPtr>;
+
+// Process wide cache of the weights hashes. Only the constants which refer to the mapped weights file are cached:
+// the file is read only and is shared by all the models read from it, so compiling the same model again does not
+// read all the weights. The weak pointer detects that the buffer was released and its address was reused.
+class WeightsHashCache {
+public:
+    bool find(const BufferPtr& buffer, uint64_t& hash) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const auto found = m_hashes.find(buffer.get());
+        if (found == m_hashes.end() || found->second.first.lock() != buffer) {
+            return false;
+        }
+        hash = found->second.second;
+        return true;
+    }
+
+    void insert(const BufferPtr& buffer, uint64_t hash) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_hashes.size() >= 2 * m_prune_size) {
+            for (auto it = m_hashes.begin(); it != m_hashes.end();) {
+                it = it->second.first.expired() ? m_hashes.erase(it) : std::next(it);
+            }
+            m_prune_size = std::max(m_prune_size, m_hashes.size());
+        }
+        m_hashes[buffer.get()] = {buffer, hash};
+    }
+
+    static WeightsHashCache& get() {
+        static WeightsHashCache cache;
+        return cache;
+    }
+
+private:
+    std::mutex m_mutex;
+    using CachedHash = std::pair<std::weak_ptr<ngraph::runtime::AlignedBuffer>, uint64_t>;
+    std::unordered_map<const ngraph::runtime::AlignedBuffer*, CachedHash> m_hashes;
+    size_t m_prune_size = 1024;
+};
+
+// Collects the data buffers of the constants to hash them before the graph walk
+class ConstantBufferCollector : public ngraph::AttributeVisitor {
+public:
+    explicit ConstantBufferCollector(std::vector<BufferPtr>& buffers) : m_buffers(buffers) {}
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<BufferPtr>>(&adapter)) {
+            if (a->get()) {
+                m_buffers.push_back(a->get());
+            }
+        }
+    }
+
+private:
+    std::vector<BufferPtr>& m_buffers;
+};
+
+void collect_constant_buffers(const ov::Model& model, std::vector<BufferPtr>& buffers) {
+    for (const auto& node : model.get_ordered_ops()) {
+        if (ov::is_type<ov::op::v0::Constant>(node)) {
+            ConstantBufferCollector collector(buffers);
+            node->visit_attributes(collector);
+        } else if (const auto& multi_subgraph = ov::as_type_ptr<ov::op::util::MultiSubGraphOp>(node)) {
+            for (size_t i = 0; i < multi_subgraph->get_internal_subgraphs_size(); ++i) {
+                if (const auto& body = multi_subgraph->get_function(static_cast<int>(i))) {
+                    collect_constant_buffers(*body, buffers);
+                }
+            }
+        }
+    }
+}
+
+using ConstantHashes = std::unordered_map<const ngraph::runtime::AlignedBuffer*, uint64_t>;
+
+ConstantHashes hash_constants(const ov::Model& model) {
+    std::vector<BufferPtr> buffers;
+    collect_constant_buffers(model, buffers);
+
+    ConstantHashes hashes;
+    std::vector<BufferPtr> to_hash;
+    auto& cache = WeightsHashCache::get();
+    for (const auto& buffer : buffers) {
+        if (hashes.count(buffer.get())) {
+            continue;
+        }
+        uint64_t hash = 0;
+        if (std::dynamic_pointer_cast<MappedWeightsBuffer>(buffer) && cache.find(buffer, hash)) {
+            hashes[buffer.get()] = hash;
+        } else {
+            hashes[buffer.get()] = 0;
+            to_hash.push_back(buffer);
+        }
+    }
+
+    // every constant is split to chunks, all the chunks of all the constants are hashed in parallel
+    struct Chunk {
+        const char* data;
+        size_t size;
+        uint64_t* hash;
+    };
+    std::vector<std::vector<uint64_t>> chunk_hashes(to_hash.size());
+    std::vector<Chunk> chunks;
+    size_t total_size = 0;
+    for (size_t i = 0; i < to_hash.size(); ++i) {
+        const auto data = to_hash[i]->get_ptr<char>();
+        const auto size = to_hash[i]->size();
+        total_size += size;
+        chunk_hashes[i].resize(std::max<size_t>(1, (size + constant_hash_chunk_size - 1) / constant_hash_chunk_size));
+        for (size_t c = 0; c < chunk_hashes[i].size(); ++c) {
+            const auto offset = c * constant_hash_chunk_size;
+            chunks.push_back({data + offset, std::min(constant_hash_chunk_size, size - offset), &chunk_hashes[i][c]});
+        }
+    }
+    std::atomic<size_t> next_chunk{0};
+    auto hash_chunks = [&] {
+        for (auto c = next_chunk++; c < chunks.size(); c = next_chunk++) {
+            *chunks[c].hash = hash_bytes(chunks[c].data, chunks[c].size, 0);
+        }
+    };
+    // the threads follow the THREADING backend, so the hashing does not oversubscribe a caller's parallel region
+    const auto threads_num = total_size < 4 * constant_hash_chunk_size
+                                 ? size_t{1}
+                                 : std::min(ngraph::runtime::reference::parallel::get_max_threads(), chunks.size());
+    ngraph::runtime::reference::parallel::parallel_nt(threads_num, [&](size_t, size_t) {
+        hash_chunks();
+    });
+
+    for (size_t i = 0; i < to_hash.size(); ++i) {
+        const auto& buffer = to_hash[i];
+        const auto hash = chunk_hashes[i].size() == 1 ? chunk_hashes[i].front()
+                                                      : combine_chunk_hashes(chunk_hashes[i], buffer->size());
+        hashes[buffer.get()] = hash;
+        if (std::dynamic_pointer_cast<MappedWeightsBuffer>(buffer)) {
+            cache.insert(buffer, hash);
+        }
+    }
+    return hashes;
+}
+
+// Serial version of the hash calculated by hash_constants() for a constant which was not hashed in advance
+uint64_t hash_constant_data(const char* data, size_t size) {
+    if (size <= constant_hash_chunk_size) {
+        return hash_bytes(data, size, 0);
+    }
+    std::vector<uint64_t> chunk_hashes;
+    for (size_t offset = 0; offset < size; offset += constant_hash_chunk_size) {
+        chunk_hashes.push_back(hash_bytes(data + offset, std::min(constant_hash_chunk_size, size - offset), 0));
+    }
+    return combine_chunk_hashes(chunk_hashes, size);
+}
+
+// Writes the constant data to the weights stream. The data of equal constants is written once: the constants are
+// matched by the hashes calculated by hash_constants() in parallel before the serialization, and the data is
+// compared only when the hashes are equal. Small constants are accumulated in a buffer, so the stream gets large
+// writes only, and the write position is tracked by the writer instead of querying the stream.
 class ConstantWriter {
 public:
     using FilePosition = int64_t;
-    using HashValue = size_t;
-    using ConstWritePositions = std::unordered_map<HashValue, std::pair<FilePosition, void const*>>;
+    using HashValue = uint64_t;
 
-    ConstantWriter(std::ostream& bin_data, bool enable_compression = true)
+    struct WrittenConstant {
+        FilePosition offset;
+        const char* data;
+        size_t size;
+    };
+    using ConstWritePositions = std::unordered_map<HashValue, WrittenConstant>;
+
+    ConstantWriter(std::ostream& bin_data, ConstantHashes constant_hashes = {}, bool enable_compression = true)
         : m_binary_output(bin_data),
-          m_enable_compression(enable_compression),
-          m_blob_offset(bin_data.tellp()) {}
+          m_constant_hashes(std::move(constant_hashes)),
+          m_enable_compression(enable_compression) {}
 
-    FilePosition write(const char* ptr, size_t size) {
-        const FilePosition write_pos = m_binary_output.tellp();
-        const auto offset = write_pos - m_blob_offset;
+    FilePosition write(const ngraph::runtime::AlignedBuffer& buffer) {
+        const auto ptr = buffer.get_ptr<char>();
+        const auto size = buffer.size();
+        const FilePosition offset = m_position;
         if (!m_enable_compression) {
-            m_binary_output.write(ptr, size);
+            write_data(ptr, size);
             return offset;
         }
-        // This hash is weak (but efficient) and must be replace with some other
-        // more stable hash algorithm. For example current hash algorithms gives
-        // the same hash for {2, 2} and {0, 128} arrays. So we have to compare
-        // values when finding a match in hash map.
-        const HashValue hash = hash_combine(ptr, size);
+        const auto found_hash = m_constant_hashes.find(&buffer);
+        const HashValue hash =
+            found_hash != m_constant_hashes.end() ? found_hash->second : hash_constant_data(ptr, size);
         const auto found = m_hash_to_file_positions.find(hash);
-        if (found != end(m_hash_to_file_positions) &&
-            memcmp(static_cast<void const*>(ptr), found->second.second, size) == 0) {
-            return found->second.first;
+        if (found != end(m_hash_to_file_positions)) {
+            const auto& written = found->second;
+            if (written.size == size && (written.data == ptr || memcmp(ptr, written.data, size) == 0)) {
+                return written.offset;
+            }
         }
 
-        m_binary_output.write(ptr, size);
-        m_hash_to_file_positions.insert({hash, {offset, static_cast<void const*>(ptr)}});
+        write_data(ptr, size);
+        m_hash_to_file_positions.insert({hash, {offset, ptr, size}});
 
         return offset;
     }
 
+    /// Writes the buffered data to the stream, must be called before the stream is used by anybody else
+    void flush() {
+        if (!m_buffer.empty()) {
+            m_binary_output.write(m_buffer.data(), m_buffer.size());
+            m_buffer.clear();
+        }
+    }
+
 private:
+    static constexpr size_t buffer_size = 4 * 1024 * 1024;
+
+    void write_data(const char* ptr, size_t size) {
+        if (m_buffer.size() + size > buffer_size) {
+            flush();
+        }
+        if (size >= buffer_size) {
+            m_binary_output.write(ptr, size);
+        } else {
+            if (m_buffer.capacity() < buffer_size) {
+                m_buffer.reserve(buffer_size);
+            }
+            m_buffer.insert(m_buffer.end(), ptr, ptr + size);
+        }
+        m_position += size;
+    }
+
     ConstWritePositions m_hash_to_file_positions;
     std::ostream& m_binary_output;
+    ConstantHashes m_constant_hashes;
     bool m_enable_compression;
-    FilePosition m_blob_offset;  // blob offset inside output stream
+    FilePosition m_position = 0;  // write position relative to the blob offset inside output stream
+    std::vector<char> m_buffer;
 };
 
 void ngfunction_2_ir(pugi::xml_node& node,
@@ -422,7 +700,7 @@ public:
                            &adapter)) {
             if (name == "value" && translate_type_name(m_node_type_name) == "Const") {
                 const int64_t size = a->get()->size();
-                int64_t offset = m_constant_write_handler.write(static_cast<const char*>(a->get()->get_ptr()), size);
+                int64_t offset = m_constant_write_handler.write(*a->get());
 
                 m_xml_node.append_attribute("offset").set_value(offset);
                 m_xml_node.append_attribute("size").set_value(size);
@@ -1004,9 +1282,10 @@ void serializeFunc(std::ostream& xml_file,
     std::string name = "net";
     pugi::xml_document xml_doc;
     pugi::xml_node net_node = xml_doc.append_child(name.c_str());
-    ConstantWriter constant_write_handler(bin_file);
+    ConstantWriter constant_write_handler(bin_file, hash_constants(*f));
     XmlSerializer visitor(net_node, name, custom_opsets, constant_write_handler, version, deterministic);
     visitor.on_attribute(name, f);
+    constant_write_handler.flush();
 
     xml_doc.save(xml_file);
     xml_file.flush();
@@ -1138,10 +1417,11 @@ bool pass::StreamSerialize::run_on_model(const std::shared_ptr<ngraph::Function>
     std::string name = "net";
     pugi::xml_document xml_doc;
     pugi::xml_node net_node = xml_doc.append_child(name.c_str());
-    ConstantWriter constant_write_handler(m_stream);
+    ConstantWriter constant_write_handler(m_stream, hash_constants(*f));
     XmlSerializer visitor(net_node, name, m_custom_opsets, constant_write_handler, version);
     std::shared_ptr<ov::Model> fun = f;
     visitor.on_attribute(name, fun);
+    constant_write_handler.flush();
 
     // IR
     hdr.model_offset = m_stream.tellp();
@@ -1166,52 +1446,297 @@ bool pass::StreamSerialize::run_on_model(const std::shared_ptr<ngraph::Function>
 /// -------- Hash calculation pass -------------
 
 namespace {
-template <typename T>
-static uint64_t hash_combine(uint64_t seed, const T& a) {
-    // Hash combine formula from boost
-    return seed ^ (std::hash<T>()(a) + 0x9e3779b9 + (seed << 6) + (seed >> 2));
-}
+// The hash of the model is calculated directly on the graph: op types, attributes, topology and constant data,
+// so no XML document is built.
+class ModelHasher {
+public:
+    void update(uint64_t value) {
+        m_state ^= hash_round(0, value);
+        m_state = rotl64(m_state, 27) * prime64_1 + prime64_4;
+    }
+
+    void update(const std::string& value) {
+        update(hash_bytes(value.data(), value.size(), 0));
+    }
+
+    void update_float(double value) {
+        uint64_t bits;
+        static_assert(sizeof(bits) == sizeof(value), "Unexpected double size");
+        std::memcpy(&bits, &value, sizeof(bits));
+        update(bits);
+    }
+
+    void update(const ov::Dimension& dim) {
+        update(static_cast<uint64_t>(dim.get_min_length()));
+        update(static_cast<uint64_t>(dim.get_max_length()));
+    }
 
-class OstreamHashWrapper final : public std::streambuf {
-    uint64_t m_res = 0;
+    void update(const ov::PartialShape& shape) {
+        if (shape.rank().is_dynamic()) {
+            update(std::numeric_limits<uint64_t>::max());
+            return;
+        }
+        update(static_cast<uint64_t>(shape.size()));
+        for (const auto& dim : shape) {
+            update(dim);
+        }
+    }
 
+    void update(const ov::element::Type& type) {
+        update(type.get_type_name());
+    }
+
+    uint64_t get() const {
+        return avalanche(m_state);
+    }
+
+private:
+    uint64_t m_state = prime64_5;
+};
+
+void hash_model(ModelHasher& hasher, const ov::Model& model, const ConstantHashes& constant_hashes);
+
+class HashVisitor : public ngraph::AttributeVisitor {
 public:
-    uint64_t getResult() const {
-        return m_res;
+    HashVisitor(ModelHasher& hasher, const ConstantHashes& constant_hashes)
+        : m_hasher(hasher),
+          m_constant_hashes(constant_hashes) {}
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        using InputDescriptions = std::vector<std::shared_ptr<ngraph::op::util::MultiSubGraphOp::InputDescription>>;
+        using OutputDescriptions = std::vector<std::shared_ptr<ngraph::op::util::MultiSubGraphOp::OutputDescription>>;
+
+        m_hasher.update(name);
+        if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<BufferPtr>>(&adapter)) {
+            // only the buffers of the Constant ops are hashed in advance, the rest are hashed here
+            const auto& buffer = a->get();
+            const auto found = m_constant_hashes.find(buffer.get());
+            if (found != m_constant_hashes.end()) {
+                m_hasher.update(found->second);
+            } else if (buffer) {
+                m_hasher.update(hash_constant_data(buffer->get_ptr<char>(), buffer->size()));
+            } else {
+                m_hasher.update(uint64_t{0});
+            }
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<InputDescriptions>>(&adapter)) {
+            for (const auto& input_description : a->get()) {
+                m_hasher.update(input_description->get_type_info().name);
+                m_hasher.update(input_description->m_input_index);
+                m_hasher.update(input_description->m_body_parameter_index);
+                if (auto slice_input =
+                        ov::as_type_ptr<ngraph::op::util::SubGraphOp::SliceInputDescription>(input_description)) {
+                    m_hasher.update(static_cast<uint64_t>(slice_input->m_start));
+                    m_hasher.update(static_cast<uint64_t>(slice_input->m_stride));
+                    m_hasher.update(static_cast<uint64_t>(slice_input->m_part_size));
+                    m_hasher.update(static_cast<uint64_t>(slice_input->m_end));
+                    m_hasher.update(static_cast<uint64_t>(slice_input->m_axis));
+                } else if (auto merged_input = ov::as_type_ptr<ngraph::op::util::SubGraphOp::MergedInputDescription>(
+                               input_description)) {
+                    m_hasher.update(merged_input->m_body_value_index);
+                }
+            }
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<OutputDescriptions>>(&adapter)) {
+            for (const auto& output_description : a->get()) {
+                m_hasher.update(output_description->get_type_info().name);
+                m_hasher.update(output_description->m_body_value_index);
+                m_hasher.update(output_description->m_output_index);
+                if (auto concat_output =
+                        ov::as_type_ptr<ngraph::op::util::SubGraphOp::ConcatOutputDescription>(output_description)) {
+                    m_hasher.update(static_cast<uint64_t>(concat_output->m_start));
+                    m_hasher.update(static_cast<uint64_t>(concat_output->m_stride));
+                    m_hasher.update(static_cast<uint64_t>(concat_output->m_part_size));
+                    m_hasher.update(static_cast<uint64_t>(concat_output->m_end));
+                    m_hasher.update(static_cast<uint64_t>(concat_output->m_axis));
+                } else if (auto body_output =
+                               ov::as_type_ptr<ngraph::op::util::SubGraphOp::BodyOutputDescription>(
+                                   output_description)) {
+                    m_hasher.update(static_cast<uint64_t>(body_output->m_iteration));
+                }
+            }
+        } else if (const auto& a =
+                       ngraph::as_type<ngraph::AttributeAdapter<ngraph::op::v5::Loop::SpecialBodyPorts>>(&adapter)) {
+            m_hasher.update(static_cast<uint64_t>(a->get().current_iteration_input_idx));
+            m_hasher.update(static_cast<uint64_t>(a->get().body_condition_output_idx));
+        } else if (const auto& a =
+                       ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::Variable>>>(&adapter)) {
+            const auto& info = a->get()->get_info();
+            m_hasher.update(info.variable_id);
+            m_hasher.update(info.data_type);
+            m_hasher.update(info.data_shape);
+        } else if (const auto& a =
+                       ngraph::as_type<ngraph::AttributeAdapter<ov::op::util::FrameworkNodeAttrs>>(&adapter)) {
+            const auto& attrs = a->get();
+            m_hasher.update(attrs.get_type_name());
+            m_hasher.update(attrs.get_opset_name());
+            // the attributes are stored in an unordered map
+            const std::map<std::string, std::string> sorted_attrs(attrs.begin(), attrs.end());
+            for (const auto& attr : sorted_attrs) {
+                m_hasher.update(attr.first);
+                m_hasher.update(attr.second);
+            }
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::element::TypeVector>>(&adapter)) {
+            for (const auto& type : a->get()) {
+                m_hasher.update(type);
+            }
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<ov::PartialShape>>(&adapter)) {
+            m_hasher.update(a->get());
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<ov::Dimension>>(&adapter)) {
+            m_hasher.update(a->get());
+        } else if (const auto& a = ov::as_type<ov::AttributeAdapter<std::set<std::string>>>(&adapter)) {
+            for (const auto& value : a->get()) {
+                m_hasher.update(value);
+            }
+        } else {
+            throw ngraph_error("Unsupported attribute type for hash calculation: " + name);
+        }
     }
 
-    std::streamsize xsputn(const char* s, std::streamsize n) override {
-        auto* intS = (const std::streamsize*)s;
-        std::streamsize n64 = n / static_cast<std::streamsize>(sizeof(std::streamsize));
-        std::streamsize i = 0;
-        // Using 64-bit values executes much faster than char
-        while (i++ < n64) {
-            m_res += *(intS++);
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& adapter) override {
+        m_hasher.update(name);
+        m_hasher.update(static_cast<uint64_t>(adapter.get()));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override {
+        m_hasher.update(name);
+        m_hasher.update(adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override {
+        m_hasher.update(name);
+        m_hasher.update(static_cast<uint64_t>(adapter.get()));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override {
+        m_hasher.update(name);
+        m_hasher.update_float(adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int>>& adapter) override {
+        update_values(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        update_values(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        update_values(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override {
+        m_hasher.update(name);
+        m_hasher.update(static_cast<uint64_t>(adapter.get().size()));
+        for (const auto value : adapter.get()) {
+            m_hasher.update_float(value);
         }
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& adapter) override {
+        m_hasher.update(name);
+        m_hasher.update(static_cast<uint64_t>(adapter.get().size()));
+        for (const auto& value : adapter.get()) {
+            m_hasher.update(value);
+        }
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::shared_ptr<Function>>& adapter) override {
+        m_hasher.update(name);
+        hash_model(m_hasher, *adapter.get(), m_constant_hashes);
+    }
 
-        std::streamsize rest = n % static_cast<std::streamsize>(sizeof(std::streamsize));
-        for (i = 0; i < rest; i++) {
-            m_res += s[n - rest + i];
+private:
+    template <typename T>
+    void update_values(const std::string& name, const std::vector<T>& values) {
+        m_hasher.update(name);
+        m_hasher.update(static_cast<uint64_t>(values.size()));
+        for (const auto value : values) {
+            m_hasher.update(static_cast<uint64_t>(value));
         }
-        return n;
     }
+
+    ModelHasher& m_hasher;
+    const ConstantHashes& m_constant_hashes;
 };
-}  // namespace
 
-bool pass::Hash::run_on_model(const std::shared_ptr<ov::Model>& f) {
-    OstreamHashWrapper xmlHash;
-    OstreamHashWrapper binHash;
-    std::ostream xml(&xmlHash);
-    std::ostream bin(&binHash);
+void hash_runtime_info(ModelHasher& hasher, const RTMap& attributes, const ConstantHashes& constant_hashes) {
+    for (const auto& item : attributes) {
+        if (item.second.is<ov::RuntimeAttribute>()) {
+            const auto& rt_attribute = item.second.as<ov::RuntimeAttribute>();
+            ModelHasher attribute_hasher;
+            attribute_hasher.update(rt_attribute.get_type_info().name);
+            attribute_hasher.update(rt_attribute.get_type_info().get_version());
+            HashVisitor visitor(attribute_hasher, constant_hashes);
+            // the attributes which can not be visited are not serialized, so they are skipped as well
+            if (const_cast<ov::RuntimeAttribute&>(rt_attribute).visit_attributes(visitor)) {
+                hasher.update(attribute_hasher.get());
+            }
+        }
+    }
+}
+
+void hash_model(ModelHasher& hasher, const ov::Model& model, const ConstantHashes& constant_hashes) {
+    // Auto-generated names are skipped, so the same graph built twice has the same hash
+    if (!is_name_auto_generated(model)) {
+        hasher.update(model.get_friendly_name());
+    }
+    const auto ordered_ops = model.get_ordered_ops();
+    std::unordered_map<const ngraph::Node*, uint64_t> node_ids;
+    for (const auto& node : ordered_ops) {
+        node_ids.emplace(node.get(), node_ids.size());
+    }
+    auto node_id = [&](const std::shared_ptr<ngraph::Node>& node) {
+        const auto found = node_ids.find(node.get());
+        NGRAPH_CHECK(found != node_ids.end(), "Internal error");
+        return found->second;
+    };
+
+    hasher.update(static_cast<uint64_t>(ordered_ops.size()));
+    for (const auto& node : ordered_ops) {
+        const auto& type_info = node->get_type_info();
+        hasher.update(type_info.name);
+        hasher.update(type_info.get_version());
+        if (!is_name_auto_generated(*node)) {
+            hasher.update(node->get_friendly_name());
+        }
+        hash_runtime_info(hasher, node->get_rt_info(), constant_hashes);
+
+        hasher.update(static_cast<uint64_t>(node->get_input_size()));
+        for (const auto& input : node->inputs()) {
+            const auto source = input.get_source_output();
+            hasher.update(node_id(source.get_node_shared_ptr()));
+            hasher.update(static_cast<uint64_t>(source.get_index()));
+            hasher.update(input.get_element_type());
+            hasher.update(input.get_partial_shape());
+            hash_runtime_info(hasher, input.get_rt_info(), constant_hashes);
+        }
+        hasher.update(static_cast<uint64_t>(node->get_output_size()));
+        for (const auto& output : node->outputs()) {
+            hasher.update(output.get_element_type());
+            hasher.update(output.get_partial_shape());
+            // the tensor names are stored in an unordered set
+            const auto& tensor_names = output.get_tensor().get_names();
+            const std::set<std::string> sorted_names(tensor_names.begin(), tensor_names.end());
+            hasher.update(static_cast<uint64_t>(sorted_names.size()));
+            for (const auto& name : sorted_names) {
+                hasher.update(name);
+            }
+            hash_runtime_info(hasher, output.get_rt_info(), constant_hashes);
+        }
 
-    // Determinism is important for hash calculation
-    serializeFunc(xml, bin, f, Serialize::Version::UNSPECIFIED, {}, true);
+        auto_pad_resolving(node.get());  // Pads are ignored for nodes with auto_pad, like in serialization
+        HashVisitor visitor(hasher, constant_hashes);
+        NGRAPH_CHECK(node->visit_attributes(visitor), "Visitor API is not supported in ", node);
+    }
 
-    uint64_t seed = 0;
-    seed = hash_combine(seed, xmlHash.getResult());
-    seed = hash_combine(seed, binHash.getResult());
+    for (const auto& param : model.get_parameters()) {
+        hasher.update(node_id(param));
+    }
+    for (const auto& result : model.get_results()) {
+        hasher.update(node_id(result));
+    }
+    for (const auto& sink : model.get_sinks()) {
+        hasher.update(node_id(sink));
+    }
+}
+}  // namespace
+
+bool pass::Hash::run_on_model(const std::shared_ptr<ov::Model>& f) {
+    const auto constant_hashes = hash_constants(*f);
+    ModelHasher hasher;
+    hash_model(hasher, *f, constant_hashes);
 
-    m_hash = seed;
+    m_hash = hasher.get();
     // Return false because we didn't change nGraph Function
     return false;
 }
@@ -3372,3 +3372,151 @@ TEST(constant_folding, constant_loop) {
     range_test_check(result_node_0->cast_vector<float>(), expected_0);
     range_test_check(result_node_1->cast_vector<float>(), expected_1);
 }
+
+namespace {
+std::shared_ptr<Function> get_model_with_loops(size_t loops_num, bool shared_body = false) {
+    auto X = make_shared<opset5::Parameter>(element::f32, Shape{2, 1, 3});
+    auto trip_count = std::make_shared<ngraph::opset5::Constant>(ngraph::element::i64, ngraph::Shape{1}, 2);
+    auto exec_condition = std::make_shared<ngraph::opset5::Constant>(ngraph::element::boolean, ngraph::Shape{1}, true);
+
+    ResultVector results;
+    std::shared_ptr<Function> body;
+    for (size_t i = 0; i < loops_num; ++i) {
+        // Body with the foldable Add of two constants
+        auto Xi = make_shared<opset5::Parameter>(element::f32, PartialShape::dynamic());
+        auto body_condition = std::make_shared<ngraph::opset5::Constant>(ngraph::element::boolean, ngraph::Shape{1}, true);
+        auto a = make_shared<opset5::Constant>(element::f32, Shape{1, 1, 3}, std::vector<float>{1, 2, 3});
+        auto b = make_shared<opset5::Constant>(element::f32, Shape{1, 1, 3}, std::vector<float>{static_cast<float>(i)});
+        auto sum = make_shared<opset5::Add>(Xi, make_shared<opset5::Add>(a, b));
+        if (!shared_body || !body) {
+            body = make_shared<ngraph::Function>(OutputVector{body_condition, sum}, ParameterVector{Xi});
+        } else {
+            // the bodies are different models sharing the condition and the constant Add of the first body
+            const auto& previous_sum = body->get_results().at(1)->get_input_node_shared_ptr(0);
+            sum = make_shared<opset5::Add>(Xi, previous_sum->input_value(1));
+            body = make_shared<ngraph::Function>(OutputVector{body->get_results().at(0)->input_value(0), sum},
+                                                 ParameterVector{Xi});
+        }
+
+        auto loop = make_shared<opset5::Loop>(trip_count, exec_condition);
+        loop->set_function(body);
+        loop->set_special_body_ports(ngraph::opset5::Loop::SpecialBodyPorts{-1, 0});
+        loop->set_sliced_input(Xi, X, 0, 1, 1, -1, 0);
+        results.push_back(make_shared<opset5::Result>(loop->get_concatenated_slices(sum, 0, 1, 1, -1, 0)));
+    }
+    return make_shared<Function>(results, ParameterVector{X});
+}
+
+class ConstantFoldingSubModels : public testing::TestWithParam<size_t> {};
+}  // namespace
+
+TEST_P(ConstantFoldingSubModels, fold_loop_bodies) {
+    const size_t loops_num = 8;
+    auto f = get_model_with_loops(loops_num);
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>()->set_sub_models_threads(GetParam());
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<opset5::Loop>(f), loops_num);
+    for (size_t i = 0; i < loops_num; ++i) {
+        auto loop = ov::as_type_ptr<opset5::Loop>(f->get_results().at(i)->get_input_node_shared_ptr(0));
+        ASSERT_TRUE(loop);
+        auto body = loop->get_function();
+        ASSERT_EQ(count_ops_of_type<opset5::Add>(body), 1);
+        auto add = body->get_results().at(1)->get_input_node_shared_ptr(0);
+        auto folded = ov::as_type_ptr<op::Constant>(add->get_input_node_shared_ptr(1));
+        ASSERT_TRUE(folded);
+        const std::vector<float> expected{1.f + i, 2.f + i, 3.f + i};
+        ASSERT_TRUE(test::all_close_f(folded->cast_vector<float>(), expected, MIN_FLOAT_TOLERANCE_BITS));
+    }
+}
+
+TEST_P(ConstantFoldingSubModels, fold_loop_bodies_sharing_nodes) {
+    const size_t loops_num = 8;
+    auto f = get_model_with_loops(loops_num, true);
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>()->set_sub_models_threads(GetParam());
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<opset5::Loop>(f), loops_num);
+    for (size_t i = 0; i < loops_num; ++i) {
+        auto loop = ov::as_type_ptr<opset5::Loop>(f->get_results().at(i)->get_input_node_shared_ptr(0));
+        ASSERT_TRUE(loop);
+        auto body = loop->get_function();
+        ASSERT_EQ(count_ops_of_type<opset5::Add>(body), 1);
+        auto add = body->get_results().at(1)->get_input_node_shared_ptr(0);
+        auto folded = ov::as_type_ptr<op::Constant>(add->get_input_node_shared_ptr(1));
+        ASSERT_TRUE(folded);
+        const std::vector<float> expected{1.f, 2.f, 3.f};
+        ASSERT_TRUE(test::all_close_f(folded->cast_vector<float>(), expected, MIN_FLOAT_TOLERANCE_BITS));
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(constant_folding, ConstantFoldingSubModels, testing::Values(0, 1, 3));
+
+TEST(constant_folding, large_constants) {
+    Shape shape_a{64, 128, 64};
+    Shape shape_b{128, 1};
+    vector<float> values_a(shape_size(shape_a));
+    vector<float> values_b(shape_size(shape_b));
+    for (size_t i = 0; i < values_a.size(); ++i) {
+        values_a[i] = static_cast<float>(i % 1000);
+    }
+    for (size_t i = 0; i < values_b.size(); ++i) {
+        values_b[i] = static_cast<float>(i * 1000);
+    }
+    auto a = make_shared<op::Constant>(element::f32, shape_a, values_a);
+    auto b = make_shared<op::Constant>(element::f32, shape_b, values_b);
+    auto add = make_shared<op::v1::Add>(a, b);
+    auto order = make_shared<op::Constant>(element::i64, Shape{3}, vector<int64_t>{2, 0, 1});
+    auto transpose = make_shared<op::v1::Transpose>(add, order);
+    auto convert = make_shared<op::v0::Convert>(transpose, element::i32);
+    auto f = make_shared<Function>(convert, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f), 1);
+    auto values_out = get_result_constant<int32_t>(f, 0);
+    ASSERT_EQ(values_out.size(), values_a.size());
+    for (size_t i = 0; i < shape_a[0]; ++i) {
+        for (size_t j = 0; j < shape_a[1]; ++j) {
+            for (size_t k = 0; k < shape_a[2]; ++k) {
+                const auto expected = values_a[(i * shape_a[1] + j) * shape_a[2] + k] + values_b[j];
+                ASSERT_EQ(values_out[(k * shape_a[0] + i) * shape_a[1] + j], static_cast<int32_t>(expected));
+            }
+        }
+    }
+}
+
+TEST(constant_folding, independent_nodes) {
+    const size_t nodes_count = 32;
+    OutputVector outputs;
+    for (size_t i = 0; i < nodes_count; ++i) {
+        auto a = make_shared<op::Constant>(element::i32, Shape{16}, vector<int32_t>(16, static_cast<int32_t>(i)));
+        auto b = make_shared<op::Constant>(element::i32, Shape{1}, vector<int32_t>{1});
+        auto add = make_shared<op::v1::Add>(a, b);
+        add->set_friendly_name("add_" + to_string(i));
+        auto multiply = make_shared<op::v1::Multiply>(add, a);
+        multiply->set_friendly_name("multiply_" + to_string(i));
+        outputs.push_back(multiply);
+    }
+    auto f = make_shared<Function>(outputs, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::v1::Add>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Multiply>(f), 0);
+    for (size_t i = 0; i < nodes_count; ++i) {
+        auto new_const = ov::as_type_ptr<op::Constant>(f->get_results().at(i)->input_value(0).get_node_shared_ptr());
+        ASSERT_TRUE(new_const);
+        ASSERT_EQ(new_const->get_friendly_name(), "multiply_" + to_string(i));
+        const auto value = static_cast<int32_t>((i + 1) * i);
+        ASSERT_EQ(new_const->cast_vector<int32_t>(), vector<int32_t>(16, value));
+    }
+}
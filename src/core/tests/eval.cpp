@@ -30,6 +30,7 @@
 #include "ngraph/op/floor.hpp"
 #include "ngraph/op/gather.hpp"
 #include "ngraph/op/log.hpp"
+#include "ngraph/op/matmul.hpp"
 #include "ngraph/op/max_pool.hpp"
 #include "ngraph/op/min.hpp"
 #include "ngraph/op/minimum.hpp"
@@ -39,6 +40,7 @@
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/op/range.hpp"
 #include "ngraph/op/reduce_logical_and.hpp"
+#include "ngraph/op/reduce_sum.hpp"
 #include "ngraph/op/relu.hpp"
 #include "ngraph/op/reshape.hpp"
 #include "ngraph/op/round.hpp"
@@ -1814,3 +1816,55 @@ TEST(eval, evaluate_softsign_9) {
     for (size_t i = 0; i < result_tensor[0].get_size(); ++i)
         EXPECT_NEAR(result_data[i], out[i], 1e-6F);
 }
+
+TEST(eval, evaluate_reduce_sum_large) {
+    // large enough to split the reduction among threads
+    const Shape data_shape{64, 32, 128};
+    auto arg = make_shared<op::Parameter>(element::f32, data_shape);
+    auto axes = op::Constant::create(element::i64, Shape{2}, {1, 2});
+    auto reduce = make_shared<op::v1::ReduceSum>(arg, axes, true);
+    auto fun = make_shared<Function>(OutputVector{reduce}, ParameterVector{arg});
+    vector<float> data(shape_size(data_shape));
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<float>(i % 7);
+    }
+    vector<float> expected(data_shape[0], 0);
+    for (size_t i = 0; i < data.size(); ++i) {
+        expected[i / (data_shape[1] * data_shape[2])] += data[i];
+    }
+    auto result_tensor = make_shared<HostTensor>();
+
+    ASSERT_TRUE(fun->evaluate({result_tensor}, {make_host_tensor<element::Type_t::f32>(data_shape, data)}));
+    EXPECT_EQ(result_tensor->get_shape(), (Shape{64, 1, 1}));
+    ASSERT_EQ(read_vector<float>(result_tensor), expected);
+}
+
+TEST(eval, evaluate_matmul_large) {
+    // large enough to split the output rows among threads
+    const size_t I = 256, K = 64, J = 48;
+    auto arg0 = make_shared<op::Parameter>(element::f32, Shape{I, K});
+    auto arg1 = make_shared<op::Parameter>(element::f32, Shape{K, J});
+    auto matmul = make_shared<op::MatMul>(arg0, arg1);
+    auto fun = make_shared<Function>(OutputVector{matmul}, ParameterVector{arg0, arg1});
+    vector<float> a(I * K), b(K * J), expected(I * J, 0);
+    for (size_t i = 0; i < a.size(); ++i) {
+        a[i] = static_cast<float>(i % 5);
+    }
+    for (size_t i = 0; i < b.size(); ++i) {
+        b[i] = static_cast<float>(i % 3);
+    }
+    for (size_t i = 0; i < I; ++i) {
+        for (size_t k = 0; k < K; ++k) {
+            for (size_t j = 0; j < J; ++j) {
+                expected[i * J + j] += a[i * K + k] * b[k * J + j];
+            }
+        }
+    }
+    auto result_tensor = make_shared<HostTensor>();
+
+    ASSERT_TRUE(fun->evaluate(
+        {result_tensor},
+        {make_host_tensor<element::Type_t::f32>(Shape{I, K}, a), make_host_tensor<element::Type_t::f32>(Shape{K, J}, b)}));
+    EXPECT_EQ(result_tensor->get_shape(), (Shape{I, J}));
+    ASSERT_EQ(read_vector<float>(result_tensor), expected);
+}
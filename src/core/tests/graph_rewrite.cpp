@@ -265,6 +265,33 @@ TEST(GraphRewriteTest, TypeBasedMatcherPassOrder2) {
     ASSERT_EQ(count_ops_of_type<opset3::Tanh>(f), 1);
 }
 
+TEST(GraphRewriteTest, TypeBasedAndAnyInputMatcherPasses) {
+    auto f = get_function();
+    const auto ordered_ops = f->get_ordered_ops();
+
+    NodeVector order;
+    Anchor anchor;
+    anchor.add_matcher<GatherNodesPass>(order);
+    anchor.add_matcher<TypeBasedTestPass>()->set_callback(get_callback());
+    anchor.run_on_function(f);
+
+    ASSERT_EQ(order, ordered_ops);
+    ASSERT_EQ(count_ops_of_type<opset3::Relu>(f), 1);
+}
+
+TEST(GraphRewriteTest, NoRootOperationsInModel) {
+    auto f = get_function();
+
+    NodeVector order;
+    Anchor anchor;
+    anchor.add_matcher<GatherNodesPass, false>(order);
+    anchor.add_matcher<TypeBasedTestPassDerived>()->set_callback(get_callback());
+
+    ASSERT_FALSE(anchor.run_on_function(f));
+    ASSERT_TRUE(order.empty());
+    ASSERT_EQ(count_ops_of_type<opset3::Tanh>(f), 0);
+}
+
 TEST(PassConfigTest, Test1) {
     {
         auto f = get_function();
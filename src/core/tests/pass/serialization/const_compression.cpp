@@ -207,3 +207,52 @@ TEST_F(SerializatioConstantCompressionTest, IdenticalConstantsDifferentTypesI32I
 
     ASSERT_TRUE(file_size(bin_1) == unique_const_count * ov::shape_size(shape) * sizeof(int32_t));
 }
+
+TEST_F(SerializatioConstantCompressionTest, IdenticalLargeConstants) {
+    constexpr int unique_const_count = 1;
+    // larger than the write buffer and hashed by several chunks
+    const ov::Shape shape{3, 1024, 1024};
+
+    std::vector<float> data(ov::shape_size(shape));
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<float>(i % 1000);
+    }
+    auto A = ov::opset8::Constant::create(ov::element::f32, shape, data);
+    auto B = ov::opset8::Constant::create(ov::element::f32, shape, data);
+    data.back() = -1.f;
+    auto C = ov::opset8::Constant::create(ov::element::f32, shape, data);
+
+    auto ngraph_a = std::make_shared<ov::Model>(ov::NodeVector{A, B}, ov::ParameterVector{});
+
+    ov::pass::Serialize(m_out_xml_path_1, m_out_bin_path_1).run_on_model(ngraph_a);
+    std::ifstream bin_1(m_out_bin_path_1, std::ios::binary);
+
+    ASSERT_TRUE(file_size(bin_1) == unique_const_count * ov::shape_size(shape) * sizeof(float));
+    bin_1.close();
+
+    auto ngraph_b = std::make_shared<ov::Model>(ov::NodeVector{A, B, C}, ov::ParameterVector{});
+
+    ov::pass::Serialize(m_out_xml_path_1, m_out_bin_path_1).run_on_model(ngraph_b);
+    std::ifstream bin_2(m_out_bin_path_1, std::ios::binary);
+
+    ASSERT_TRUE(file_size(bin_2) == 2 * ov::shape_size(shape) * sizeof(float));
+}
+
+TEST_F(SerializatioConstantCompressionTest, SmallAndLargeConstants) {
+    const ov::Shape small_shape{2, 2};
+    const ov::Shape large_shape{5, 1024, 1024};
+
+    auto A = ov::opset8::Constant::create(ov::element::i32, small_shape, {1, 2, 3, 4});
+    auto B = ov::opset8::Constant::create(ov::element::u8,
+                                          large_shape,
+                                          std::vector<uint8_t>(ov::shape_size(large_shape), 7));
+    auto C = ov::opset8::Constant::create(ov::element::i32, small_shape, {5, 6, 7, 8});
+    auto D = ov::opset8::Constant::create(ov::element::i32, small_shape, {1, 2, 3, 4});
+
+    auto ngraph_a = std::make_shared<ov::Model>(ov::NodeVector{A, B, C, D}, ov::ParameterVector{});
+
+    ov::pass::Serialize(m_out_xml_path_1, m_out_bin_path_1).run_on_model(ngraph_a);
+    std::ifstream bin_1(m_out_bin_path_1, std::ios::binary);
+
+    ASSERT_TRUE(file_size(bin_1) == 2 * ov::shape_size(small_shape) * sizeof(int32_t) + ov::shape_size(large_shape));
+}
@@ -20,7 +20,8 @@ namespace InferenceEngine {
  * @ingroup ie_dev_api_threading
  * @brief CPU Streams executor implementation. The executor splits the CPU into groups of threads,
  *        that can be pinned to cores or NUMA nodes.
- *        It uses custom threads to pull tasks from single queue.
+ *        Every stream thread has its own lock-free task queue for the tasks bound to it, the tasks which are not bound
+ *        to a stream go to the shared lock-free queue. Idle streams steal the tasks of the streams busy for too long.
  */
 class INFERENCE_ENGINE_API_CLASS(CPUStreamsExecutor) : public IStreamsExecutor {
 public:
@@ -42,6 +43,15 @@ public:
 
     void run(Task task) override;
 
+    /**
+     * @brief Runs the task on the stream selected by the affinity key.
+     *        Tasks with the same key are queued to the same stream, so they reuse its warm caches and NUMA node memory.
+     *        The task can still be stolen by an idle stream, so a stream busy with a long task does not delay it.
+     * @param task A task to start
+     * @param affinityKey A key to select the stream, for example an infer request index
+     */
+    void run(Task task, std::size_t affinityKey);
+
     void Execute(Task task) override;
 
     int GetStreamId() override;
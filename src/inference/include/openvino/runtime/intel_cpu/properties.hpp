@@ -0,0 +1,147 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header for advanced hardware related properties for CPU plugin
+ *        To use in set_property, compile_model, import_model, get_property methods
+ *
+ * @file openvino/runtime/intel_cpu/properties.hpp
+ */
+#pragma once
+
+#include "openvino/runtime/properties.hpp"
+
+namespace ov {
+
+/**
+ * @defgroup ov_runtime_cpu_prop_cpp_api Intel CPU specific properties
+ * @ingroup ov_runtime_cpp_api
+ * Set of Intel CPU specific properties.
+ */
+
+/**
+ * @brief Namespace with Intel CPU specific properties
+ */
+namespace intel_cpu {
+
+/**
+ * @brief Input shapes the compiled model is warmed up with before the first inference.
+ * For every listed shape set the CPU plugin runs the graph of each stream once, so primitives and JIT kernels
+ * for these shapes are created at compile (or import) time instead of during the first inference.
+ * The format follows benchmark_app `-data_shape`: `input_name[1,3,224,224][1,3,320,320],other_input[1,10][2,10]`.
+ * The input name may be omitted for single input models: `[1,3,224,224][1,3,320,320]`.
+ * Setting the property on a compiled model triggers the warm-up immediately.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ */
+static constexpr Property<std::string, PropertyMutability::RW> warm_up_shapes{"CPU_WARM_UP_SHAPES"};
+
+/**
+ * @brief Read-only property to get the compilation and first inference timeline of the compiled model as Chrome trace
+ * JSON (can be opened with chrome://tracing or Perfetto).
+ * The timeline contains the transformation pipeline stages, the graph initialization phases, primitive creation of
+ * every node and the first inference of every stream graph. Model reading is reported for imported models only.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ */
+static constexpr Property<std::string, PropertyMutability::RO> first_inference_timeline{"CPU_FIRST_INFERENCE_TIMELINE"};
+
+/**
+ * @brief Read-only property to get the NUMA placement of the stream graphs of the compiled model as JSON array.
+ * Every created stream graph is reported with its NUMA node and the bytes of the weights and the activations bound
+ * to the node. The memory is bound only if the streams are pinned to NUMA nodes and there are several nodes,
+ * the node is -1 otherwise.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ */
+static constexpr Property<std::string, PropertyMutability::RO> numa_placement{"CPU_NUMA_PLACEMENT"};
+
+/**
+ * @brief Huge pages backing of the weights and activations memory of the compiled model (Linux only).
+ * Supported values:
+ *  - `NO` (default) - the memory is allocated as usual
+ *  - `TRANSPARENT` - buffers of 2MB and more are aligned to 2MB and advised to use transparent huge pages
+ *  - `HUGETLB_2MB`, `HUGETLB_1GB` - buffers of at least the page size are mapped from the preallocated hugetlbfs pool
+ *    (see /proc/sys/vm/nr_hugepages), transparent huge pages are used if the pool is exhausted
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ */
+static constexpr Property<std::string, PropertyMutability::RW> huge_pages{"CPU_HUGE_PAGES"};
+
+/**
+ * @brief Read-only property to get the huge pages coverage of the compiled model memory as JSON object:
+ * `{"allocated_bytes":...,"huge_pages_bytes":...,"hugetlb_fallbacks":...}`, where huge_pages_bytes is the part of
+ * the currently allocated bytes backed by huge pages and hugetlb_fallbacks is the number of buffers not served
+ * by the hugetlbfs pool. The bytes advised to use transparent huge pages are reported as huge pages backed.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ */
+static constexpr Property<std::string, PropertyMutability::RO> huge_pages_statistics{"CPU_HUGE_PAGES_STATISTICS"};
+
+/**
+ * @brief Enables the asynchronous input preprocessing stage of the CPU inference requests (disabled by default).
+ * The conversion of the inputs to the precision and layout of the compiled model inputs (e.g. u8 NHWC to f32 NCHW)
+ * runs on a separate executor, so the inputs of the next request are converted while the streams execute the
+ * previous ones. The stage durations are reported by the profiling info as `InputPreprocessing` and `InputPush`.
+ * Synchronous inference and dynamic shapes inputs are converted on the graph stream as usual.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ */
+static constexpr Property<bool, PropertyMutability::RW> async_preprocessing{"CPU_ASYNC_PREPROCESSING"};
+/**
+ * @brief Enables the fusion of the attention blocks MatMul(Q, K^T) -> [Multiply] -> [Add(mask)] -> Softmax -> MatMul(V)
+ * into a single node computing the attention by blocks without the full scores tensor (disabled by default).
+ * The fused node saves the memory of the scores, but it is not faster than the oneDNN MatMul and Softmax primitives,
+ * so it is meant for long sequences the scores tensor is too large for.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ */
+static constexpr Property<bool, PropertyMutability::RW> attention_fusion{"CPU_ATTENTION_FUSION"};
+
+/**
+ * @brief Enables the fusion of the input preprocessing chain built by ov::preprocess::PrePostProcessor (color
+ * conversion, element type conversion, resize, channels reordering, mean/scale and layout conversion) into a single
+ * node converting the input image in one pass (disabled by default).
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ */
+static constexpr Property<bool, PropertyMutability::RW> image_preprocess_fusion{"CPU_IMAGE_PREPROCESS_FUSION"};
+
+/**
+ * @brief Enables sampling of the hardware performance counters around every node execution (Linux only, disabled by
+ * default). Implies ov::enable_profiling. The CPU cycles, retired instructions, and last level cache misses
+ * of the threads executing the graph are accumulated per node and reported by the profiling info in the execution
+ * type of the node together with the derived metrics:
+ * `jit_avx2_FP32 [ipc=1.52 llc_mpki=3.10 dram_gbps=12.40 dram_bytes_per_instr=0.21]`, where dram_gbps is the DRAM
+ * traffic estimated by the LLC misses (64 bytes each) divided by the node execution time.
+ * If the counters can't be opened (e.g. /proc/sys/kernel/perf_event_paranoid forbids it), only the time is reported.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ */
+static constexpr Property<bool, PropertyMutability::RW> hw_perf_counters{"CPU_HW_PERF_COUNTERS"};
+
+/**
+ * @brief Enables the calibration of the number of streams for ov::hint::PerformanceMode::THROUGHPUT (disabled by
+ * default). At compile time the model is compiled and inferred on synthetic inputs with several numbers of streams
+ * (the static heuristic value, the number of cores and its halves) for a short time each, the fastest one is used.
+ * The calibration is skipped if the streams are set explicitly and for dynamic shapes models. The picked value is
+ * stored in the exported model, so the models loaded from the model cache (ov::cache_dir) on the same host are not
+ * calibrated again.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ */
+static constexpr Property<bool, PropertyMutability::RW> streams_auto_tuning{"CPU_STREAMS_AUTO_TUNING"};
+
+/**
+ * @brief Input shapes the dynamic shapes model gets static graph variants for.
+ * Every listed shape set is compiled as a separate graph with static shapes, so its memory is planned and the shape
+ * specific fusions are applied at compile time. The inferences with exactly these input shapes run on the static
+ * graph, the other ones on the dynamic graph. The format is the one of ov::intel_cpu::warm_up_shapes.
+ * The shape sets the model can not be specialized for (e.g. data dependent shapes) are inferred by the dynamic graph.
+ * The models with states (ReadValue/Assign) are always inferred by the dynamic graph.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ */
+static constexpr Property<std::string, PropertyMutability::RW> static_shape_variants{"CPU_STATIC_SHAPE_VARIANTS"};
+
+/**
+ * @brief The number of inferences with the same input shapes after which the dynamic shapes model gets a static
+ * graph variant for these shapes (0 by default, which disables the detection). The variant is compiled by a separate
+ * task of the streams executor while the dynamic graph keeps inferring the shapes. At most 8 variants are detected.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> static_shape_variants_threshold{
+    "CPU_STATIC_SHAPE_VARIANTS_THRESHOLD"};
+
+}  // namespace intel_cpu
+}  // namespace ov
@@ -6,8 +6,10 @@
 
 #include <atomic>
 #include <cassert>
+#include <chrono>
 #include <climits>
 #include <condition_variable>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <openvino/itt.hpp>
@@ -17,6 +19,10 @@
 #include <utility>
 #include <vector>
 
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#    include <intrin.h>
+#endif
+
 #include "ie_parallel_custom_arena.hpp"
 #include "ie_system_conf.h"
 #include "threading/ie_thread_affinity.hpp"
@@ -25,7 +31,119 @@
 using namespace openvino;
 
 namespace InferenceEngine {
+namespace {
+inline void CpuRelax() {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_pause();
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    __builtin_ia32_pause();
+#else
+    std::this_thread::yield();
+#endif
+}
+
+/**
+ * @brief Bounded multi-producer multi-consumer queue (D. Vyukov's algorithm).
+ *        Every cell has a sequence number which tells producers and consumers whether the cell is free or filled,
+ *        so push and pop take one CAS on the position without any lock.
+ */
+template <typename T>
+class BoundedMPMCQueue {
+public:
+    explicit BoundedMPMCQueue(std::size_t capacity) {
+        std::size_t size = 1;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        _mask = size - 1;
+        _cells.reset(new Cell[size]);
+        for (std::size_t i = 0; i < size; ++i) {
+            _cells[i]._sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Moves the value to the queue
+     * @return false if the queue is full, the value is not moved in this case
+     */
+    bool TryPush(T& value) {
+        Cell* cell = nullptr;
+        auto pos = _enqueuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            const auto seq = cell->_sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->_data = std::move(value);
+        cell->_sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Moves the front value from the queue
+     * @return false if the queue is empty
+     */
+    bool TryPop(T& value) {
+        Cell* cell = nullptr;
+        auto pos = _dequeuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            const auto seq = cell->_sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+        value = std::move(cell->_data);
+        cell->_data = {};
+        cell->_sequence.store(pos + _mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Approximate check, a concurrent push or pop can change the result right after the call
+     */
+    bool Empty() const {
+        return _enqueuePos.load(std::memory_order_relaxed) == _dequeuePos.load(std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr std::size_t cacheLineSize = 64;
+    struct Cell {
+        std::atomic<std::size_t> _sequence{0};
+        T _data;
+    };
+
+    std::unique_ptr<Cell[]> _cells;
+    std::size_t _mask = 0;
+    alignas(cacheLineSize) std::atomic<std::size_t> _enqueuePos{0};
+    alignas(cacheLineSize) std::atomic<std::size_t> _dequeuePos{0};
+};
+}  // namespace
+
 struct CPUStreamsExecutor::Impl {
+    // Capacity of every stream queue, tasks which do not fit are put to the shared overflow queue
+    static constexpr std::size_t streamQueueCapacity = 1024;
+    // Number of attempts to find a task before the stream thread is parked
+    static constexpr int spinCount = 256;
+    // Time a stream should be busy with one task before the tasks bound to it can be stolen by other streams
+    static constexpr std::int64_t stealDelayNs = 50000;
+
     struct Stream {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
         struct Observer : public custom::task_scheduler_observer {
@@ -215,35 +333,151 @@ struct CPUStreamsExecutor::Impl {
             }
         }
 #endif
+        for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            _streamQueues.emplace_back(new BoundedMPMCQueue<Task>{streamQueueCapacity});
+            _streamStates.emplace_back(new StreamState);
+        }
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
-                for (bool stopped = false; !stopped;) {
+                auto& state = *_streamStates[streamId];
+                for (;;) {
                     Task task;
-                    {
-                        std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] {
-                            return !_taskQueue.empty() || (stopped = _isStopped);
-                        });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
-                        }
+                    bool found = PopTask(streamId, task);
+                    // spin before parking to avoid the wake up latency for the short gaps between tasks
+                    for (int spin = 0; !found && spin < spinCount; ++spin) {
+                        CpuRelax();
+                        found = PopTask(streamId, task);
                     }
-                    if (task) {
-                        Execute(task, *(_streams.local()));
+                    if (!found) {
+                        std::unique_lock<std::mutex> lock(state._mutex);
+                        state._isParked.store(true, std::memory_order_relaxed);
+                        _parkedCount.fetch_add(1, std::memory_order_relaxed);
+                        // pairs with the fence in Enqueue(): either the task is seen here or the parked thread there
+                        std::atomic_thread_fence(std::memory_order_seq_cst);
+                        if (!HasTasks(streamId) && !_isStopped) {
+                            if (HasBoundTasks()) {
+                                // tasks of busy streams can be stolen later, so wake up to check them
+                                state._condVar.wait_for(lock, std::chrono::nanoseconds{stealDelayNs});
+                            } else {
+                                state._condVar.wait(lock);
+                            }
+                        }
+                        state._isParked.store(false, std::memory_order_relaxed);
+                        _parkedCount.fetch_sub(1, std::memory_order_relaxed);
+                        if (_isStopped && !HasTasks(streamId)) {
+                            break;
+                        }
+                        continue;
                     }
+                    state._busySince.store(Now(), std::memory_order_relaxed);
+                    Execute(task, *(_streams.local()));
+                    state._busySince.store(0, std::memory_order_relaxed);
                 }
             });
         }
     }
 
+    static std::int64_t Now() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    // A task bound to another stream is stolen only if that stream is busy with one task for longer than
+    // stealDelay, so the short gaps between the tasks of the same infer request do not move it to another stream
+    bool CanStealFrom(const std::size_t queueIdx, const std::int64_t now) const {
+        const auto busySince = _streamStates[queueIdx]->_busySince.load(std::memory_order_relaxed);
+        return busySince != 0 && now - busySince > stealDelayNs;
+    }
+
+    // The own stream queue goes first, then the shared queues and tasks stolen from busy streams
+    bool PopTask(const int streamId, Task& task) {
+        if (_streamQueues[streamId]->TryPop(task) || _sharedQueue.TryPop(task)) {
+            return true;
+        }
+        if (_overflowSize.load(std::memory_order_acquire) != 0) {
+            std::lock_guard<std::mutex> lock(_overflowMutex);
+            if (!_taskQueue.empty()) {
+                task = std::move(_taskQueue.front());
+                _taskQueue.pop();
+                _overflowSize.fetch_sub(1, std::memory_order_release);
+                return true;
+            }
+        }
+        const auto numQueues = _streamQueues.size();
+        const auto now = Now();
+        for (std::size_t i = 1; i < numQueues; ++i) {
+            const auto queueIdx = (streamId + i) % numQueues;
+            if (!_streamQueues[queueIdx]->Empty() && CanStealFrom(queueIdx, now) &&
+                _streamQueues[queueIdx]->TryPop(task)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool HasTasks(const int streamId) const {
+        if (!_streamQueues[streamId]->Empty() || !_sharedQueue.Empty() ||
+            _overflowSize.load(std::memory_order_acquire) != 0) {
+            return true;
+        }
+        const auto now = Now();
+        for (std::size_t queueIdx = 0; queueIdx < _streamQueues.size(); ++queueIdx) {
+            if (!_streamQueues[queueIdx]->Empty() && CanStealFrom(queueIdx, now)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool HasBoundTasks() const {
+        for (auto& queue : _streamQueues) {
+            if (!queue->Empty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void UnparkAny() {
+        if (_parkedCount.load(std::memory_order_relaxed) != 0) {
+            for (auto& state : _streamStates) {
+                if (state->_isParked.load(std::memory_order_relaxed)) {
+                    state->Unpark();
+                    break;
+                }
+            }
+        }
+    }
+
+    void PushOverflow(Task task) {
+        std::lock_guard<std::mutex> lock(_overflowMutex);
+        _taskQueue.emplace(std::move(task));
+        _overflowSize.fetch_add(1, std::memory_order_release);
+    }
+
+    // The task is bound to the stream and is executed by it unless the stream is busy for too long
+    void Enqueue(Task task, const std::size_t streamIdx) {
+        if (!_streamQueues[streamIdx]->TryPush(task)) {
+            PushOverflow(std::move(task));
+        }
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (_streamStates[streamIdx]->_isParked.load(std::memory_order_relaxed)) {
+            _streamStates[streamIdx]->Unpark();
+        } else {
+            // the target stream is busy, a parked stream will steal the task if the stream does not get free soon
+            UnparkAny();
+        }
+    }
+
+    // The task is not bound to any stream and is executed by the first free one
     void Enqueue(Task task) {
-        {
-            std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+        if (!_sharedQueue.TryPush(task)) {
+            PushOverflow(std::move(task));
         }
-        _queueCondVar.notify_one();
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        UnparkAny();
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -280,10 +514,27 @@ struct CPUStreamsExecutor::Impl {
     int _streamId = 0;
     std::queue<int> _streamIdQueue;
     std::vector<std::thread> _threads;
-    std::mutex _mutex;
-    std::condition_variable _queueCondVar;
+    struct StreamState {
+        void Unpark() {
+            { std::lock_guard<std::mutex> lock(_mutex); }
+            _condVar.notify_one();
+        }
+        std::mutex _mutex;
+        std::condition_variable _condVar;
+        std::atomic<bool> _isParked{false};
+        // start time of the current task in nanoseconds, zero if the stream is free
+        std::atomic<std::int64_t> _busySince{0};
+    };
+    std::vector<std::unique_ptr<BoundedMPMCQueue<Task>>> _streamQueues;
+    std::vector<std::unique_ptr<StreamState>> _streamStates;
+    // queue for the tasks which are not bound to a stream
+    BoundedMPMCQueue<Task> _sharedQueue{streamQueueCapacity};
+    std::atomic<int> _parkedCount{0};
+    // overflow queue for the tasks which do not fit the stream queues
+    std::mutex _overflowMutex;
     std::queue<Task> _taskQueue;
-    bool _isStopped = false;
+    std::atomic<std::size_t> _overflowSize{0};
+    std::atomic<bool> _isStopped{false};
     std::vector<int> _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>> _streams;
 #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
@@ -309,11 +560,10 @@ int CPUStreamsExecutor::GetNumaNodeId() {
 CPUStreamsExecutor::CPUStreamsExecutor(const IStreamsExecutor::Config& config) : _impl{new Impl{config}} {}
 
 CPUStreamsExecutor::~CPUStreamsExecutor() {
-    {
-        std::lock_guard<std::mutex> lock(_impl->_mutex);
-        _impl->_isStopped = true;
+    _impl->_isStopped = true;
+    for (auto& state : _impl->_streamStates) {
+        state->Unpark();
     }
-    _impl->_queueCondVar.notify_all();
     for (auto& thread : _impl->_threads) {
         if (thread.joinable()) {
             thread.join();
@@ -333,4 +583,12 @@ void CPUStreamsExecutor::run(Task task) {
     }
 }
 
+void CPUStreamsExecutor::run(Task task, std::size_t affinityKey) {
+    if (0 == _impl->_config._streams) {
+        _impl->Defer(std::move(task));
+    } else {
+        _impl->Enqueue(std::move(task), affinityKey % _impl->_streamQueues.size());
+    }
+}
+
 }  // namespace InferenceEngine
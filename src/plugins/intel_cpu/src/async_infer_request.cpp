@@ -3,13 +3,48 @@
 //
 
 #include "async_infer_request.h"
+#include <threading/ie_cpu_streams_executor.hpp>
+#include <atomic>
 #include <memory>
 
+namespace {
+// Binds all the pipeline tasks of a request to the same stream, so the stream graph caches stay warm for the request.
+struct StreamAffinityExecutor : public InferenceEngine::ITaskExecutor {
+    StreamAffinityExecutor(const InferenceEngine::CPUStreamsExecutor::Ptr& streamsExecutor, std::size_t affinityKey)
+        : _streamsExecutor{streamsExecutor}, _affinityKey{affinityKey} {}
+    void run(InferenceEngine::Task task) override {
+        _streamsExecutor->run(std::move(task), _affinityKey);
+    }
+    InferenceEngine::CPUStreamsExecutor::Ptr _streamsExecutor;
+    std::size_t _affinityKey;
+};
+}   // namespace
+
 ov::intel_cpu::AsyncInferRequest::AsyncInferRequest(const InferenceEngine::IInferRequestInternal::Ptr& inferRequest,
                                                     const InferenceEngine::ITaskExecutor::Ptr& taskExecutor,
                                                     const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor)
     : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor) {
     static_cast<InferRequestBase*>(inferRequest.get())->SetAsyncRequest(this);
+
+    auto streamsExecutor = std::dynamic_pointer_cast<InferenceEngine::CPUStreamsExecutor>(taskExecutor);
+    if (streamsExecutor) {
+        static std::atomic<std::size_t> requestsCounter{0};
+        auto syncRequest = static_cast<InferRequestBase*>(inferRequest.get());
+        auto streamExecutor = std::make_shared<StreamAffinityExecutor>(streamsExecutor, requestsCounter++);
+        if (auto preprocessExecutor = syncRequest->GetPreprocessExecutor()) {
+            // the inputs are converted while the stream executes the graph for the previous request
+            _pipeline = {{preprocessExecutor, [syncRequest] {
+                              syncRequest->PreprocessInputs();
+                          }},
+                         {streamExecutor, [syncRequest] {
+                              syncRequest->InferPreprocessed();
+                          }}};
+        } else {
+            _pipeline = {{streamExecutor, [syncRequest] {
+                              syncRequest->InferImpl();
+                          }}};
+        }
+    }
 }
 
 ov::intel_cpu::AsyncInferRequest::~AsyncInferRequest() {
@@ -7,6 +7,7 @@
 #include <string>
 #include <map>
 #include <algorithm>
+#include <sstream>
 
 #include "ie_plugin_config.hpp"
 #include "ie_common.h"
@@ -16,6 +17,7 @@
 #include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 #include "openvino/core/type/element_type_traits.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
 #include <cpu/x64/cpu_isa_traits.hpp>
 
 namespace ov {
@@ -23,6 +25,63 @@ namespace intel_cpu {
 
 using namespace InferenceEngine;
 
+namespace {
+/**
+ * Parses the warm-up shapes string "name[1,3,224,224][1,3,320,320],name2[1,10][2,10]" into shape sets.
+ * The i-th shape set takes the i-th bracket of every input, inputs with fewer brackets repeat the last one.
+ */
+std::vector<std::map<std::string, std::vector<size_t>>> parseWarmUpShapes(const std::string& str, const std::string& key) {
+    auto throwWrongValue = [&str, &key]() {
+        IE_THROW() << "Wrong value " << str << " for property key " << key
+                   << ". Expected format: input_name[1,3,224,224][1,3,320,320],other_input_name[1,10][2,10]";
+    };
+
+    std::map<std::string, std::vector<std::vector<size_t>>> inputShapes;
+    size_t numSets = 0;
+    size_t pos = 0;
+    while (pos < str.size()) {
+        const auto bracketPos = str.find('[', pos);
+        if (bracketPos == std::string::npos)
+            throwWrongValue();
+        const auto name = str.substr(pos, bracketPos - pos);
+        if (inputShapes.count(name))
+            throwWrongValue();
+        auto& shapes = inputShapes[name];
+        pos = bracketPos;
+        while (pos < str.size() && str[pos] == '[') {
+            const auto closePos = str.find(']', pos);
+            if (closePos == std::string::npos)
+                throwWrongValue();
+            std::vector<size_t> dims;
+            std::stringstream dimsStream(str.substr(pos + 1, closePos - pos - 1));
+            std::string dim;
+            while (std::getline(dimsStream, dim, ',')) {
+                if (dim.empty() || dim.find_first_not_of("0123456789") != std::string::npos)
+                    throwWrongValue();
+                dims.push_back(std::stoul(dim));
+            }
+            shapes.push_back(dims);
+            pos = closePos + 1;
+        }
+        numSets = std::max(numSets, shapes.size());
+        if (pos < str.size()) {
+            if (str[pos] != ',')
+                throwWrongValue();
+            pos++;
+        }
+    }
+    if (inputShapes.count("") && inputShapes.size() > 1)
+        throwWrongValue();
+
+    std::vector<std::map<std::string, std::vector<size_t>>> shapeSets(numSets);
+    for (size_t i = 0; i < numSets; i++) {
+        for (const auto& input : inputShapes)
+            shapeSets[i][input.first] = input.second[std::min(i, input.second.size() - 1)];
+    }
+    return shapeSets;
+}
+}   // namespace
+
 Config::Config() {
     // this is default mode
     streamExecutorConfig._threadBindingType = InferenceEngine::IStreamsExecutor::CORES;
@@ -137,6 +196,80 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             }
         } else if (key == PluginConfigParams::KEY_CACHE_DIR) {
             cache_dir = val;
+        } else if (key == ov::intel_cpu::warm_up_shapes.name()) {
+            warmUpShapeSets = parseWarmUpShapes(val, key);
+            warmUpShapes = val;
+        } else if (key == ov::intel_cpu::huge_pages.name()) {
+            if (val == PluginConfigParams::NO) {
+                hugePages = HugePagesMode::Disabled;
+            } else if (val == "TRANSPARENT") {
+                hugePages = HugePagesMode::Transparent;
+            } else if (val == "HUGETLB_2MB") {
+                hugePages = HugePagesMode::HugeTLB2MB;
+            } else if (val == "HUGETLB_1GB") {
+                hugePages = HugePagesMode::HugeTLB1GB;
+            } else {
+                IE_THROW() << "Wrong value " << val << " for property key " << ov::intel_cpu::huge_pages.name()
+                           << ". Supported values: NO, TRANSPARENT, HUGETLB_2MB, HUGETLB_1GB";
+            }
+        } else if (key == ov::intel_cpu::async_preprocessing.name()) {
+            if (val == PluginConfigParams::YES) {
+                asyncPreprocessing = true;
+            } else if (val == PluginConfigParams::NO) {
+                asyncPreprocessing = false;
+            } else {
+                IE_THROW() << "Wrong value " << val << " for property key " << ov::intel_cpu::async_preprocessing.name()
+                           << ". Expected only YES/NO";
+            }
+        } else if (key == ov::intel_cpu::attention_fusion.name()) {
+            if (val == PluginConfigParams::YES) {
+                attentionFusion = true;
+            } else if (val == PluginConfigParams::NO) {
+                attentionFusion = false;
+            } else {
+                IE_THROW() << "Wrong value " << val << " for property key " << ov::intel_cpu::attention_fusion.name()
+                           << ". Expected only YES/NO";
+            }
+        } else if (key == ov::intel_cpu::image_preprocess_fusion.name()) {
+            if (val == PluginConfigParams::YES) {
+                imagePreprocessFusion = true;
+            } else if (val == PluginConfigParams::NO) {
+                imagePreprocessFusion = false;
+            } else {
+                IE_THROW() << "Wrong value " << val << " for property key " << ov::intel_cpu::image_preprocess_fusion.name()
+                           << ". Expected only YES/NO";
+            }
+        } else if (key == ov::intel_cpu::hw_perf_counters.name()) {
+            if (val == PluginConfigParams::YES) {
+                collectHwPerfCounters = true;
+            } else if (val == PluginConfigParams::NO) {
+                collectHwPerfCounters = false;
+            } else {
+                IE_THROW() << "Wrong value " << val << " for property key " << ov::intel_cpu::hw_perf_counters.name()
+                           << ". Expected only YES/NO";
+            }
+        } else if (key == ov::intel_cpu::streams_auto_tuning.name()) {
+            if (val == PluginConfigParams::YES) {
+                streamsAutoTuning = true;
+            } else if (val == PluginConfigParams::NO) {
+                streamsAutoTuning = false;
+            } else {
+                IE_THROW() << "Wrong value " << val << " for property key " << ov::intel_cpu::streams_auto_tuning.name()
+                           << ". Expected only YES/NO";
+            }
+        } else if (key == ov::intel_cpu::static_shape_variants.name()) {
+            staticShapeVariantSets = parseWarmUpShapes(val, key);
+            staticShapeVariants = val;
+        } else if (key == ov::intel_cpu::static_shape_variants_threshold.name()) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value " << val << " for property key " << key << ". Expected only integer numbers";
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value " << val << " for property key " << key << ". Expected non negative number";
+            staticShapeVariantsThreshold = static_cast<uint32_t>(val_i);
         } else if (PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_CAPACITY == key) {
             int val_i = -1;
             try {
@@ -159,10 +292,27 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
     if (exclusiveAsyncRequests)  // Exclusive request feature disables the streams
         streamExecutorConfig._streams = 1;
 
+    // the hardware counters are reported through the profiling info
+    if (collectHwPerfCounters)
+        collectPerfCounters = true;
+
     CPU_DEBUG_CAP_ENABLE(readDebugCapsProperties());
     updateProperties();
 }
 
+std::string Config::toString(HugePagesMode mode) {
+    switch (mode) {
+    case HugePagesMode::Transparent:
+        return "TRANSPARENT";
+    case HugePagesMode::HugeTLB2MB:
+        return "HUGETLB_2MB";
+    case HugePagesMode::HugeTLB1GB:
+        return "HUGETLB_1GB";
+    default:
+        return PluginConfigParams::NO;
+    }
+}
+
 void Config::updateProperties() {
     if (!_config.empty())
         return;
@@ -212,6 +362,20 @@ void Config::updateProperties() {
     _config.insert({ PluginConfigParams::KEY_PERFORMANCE_HINT_NUM_REQUESTS,
             std::to_string(perfHintsConfig.ovPerfHintNumRequests) });
     _config.insert({PluginConfigParams::KEY_CACHE_DIR, cache_dir});
+    _config.insert({ov::intel_cpu::warm_up_shapes.name(), warmUpShapes});
+    _config.insert({ov::intel_cpu::huge_pages.name(), toString(hugePages)});
+    _config.insert({ov::intel_cpu::async_preprocessing.name(),
+                    asyncPreprocessing ? PluginConfigParams::YES : PluginConfigParams::NO});
+    _config.insert({ov::intel_cpu::attention_fusion.name(),
+                    attentionFusion ? PluginConfigParams::YES : PluginConfigParams::NO});
+    _config.insert({ov::intel_cpu::image_preprocess_fusion.name(),
+                    imagePreprocessFusion ? PluginConfigParams::YES : PluginConfigParams::NO});
+    _config.insert({ov::intel_cpu::hw_perf_counters.name(),
+                    collectHwPerfCounters ? PluginConfigParams::YES : PluginConfigParams::NO});
+    _config.insert({ov::intel_cpu::streams_auto_tuning.name(),
+                    streamsAutoTuning ? PluginConfigParams::YES : PluginConfigParams::NO});
+    _config.insert({ov::intel_cpu::static_shape_variants.name(), staticShapeVariants});
+    _config.insert({ov::intel_cpu::static_shape_variants_threshold.name(), std::to_string(staticShapeVariantsThreshold)});
 }
 
 #ifdef CPU_DEBUG_CAPS
@@ -10,6 +10,7 @@
 
 #include <string>
 #include <map>
+#include <vector>
 
 namespace ov {
 namespace intel_cpu {
@@ -22,6 +23,13 @@ struct Config {
         On,
     };
 
+    enum class HugePagesMode {
+        Disabled,
+        Transparent,
+        HugeTLB2MB,
+        HugeTLB1GB,
+    };
+
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
@@ -42,6 +50,38 @@ struct Config {
 
     std::string cache_dir{};
 
+    // Input shape sets the compiled model is warmed up with. An empty input name stands for the only model input.
+    std::string warmUpShapes{};
+    std::vector<std::map<std::string, std::vector<size_t>>> warmUpShapeSets;
+
+    HugePagesMode hugePages = HugePagesMode::Disabled;
+
+    // Converts the request inputs on a separate executor before the graph stream runs the request
+    bool asyncPreprocessing = false;
+
+    // Fuses the attention blocks into the ScaledDotProductAttention node
+    bool attentionFusion = false;
+
+    // Fuses the input preprocessing chain into the ImagePreprocess node
+    bool imagePreprocessFusion = false;
+
+    // Samples the hardware performance counters around every node execution, implies collectPerfCounters
+    bool collectHwPerfCounters = false;
+
+    // Calibrates the number of streams of the throughput hint on the host at compile time
+    bool streamsAutoTuning = false;
+    // The number of streams picked by the calibration and the host signature it was picked on, stored in the
+    // exported model. Zero if the streams were not calibrated.
+    int tunedStreams = 0;
+    std::string tunedStreamsHost{};
+
+    // Input shape sets the dynamic shapes model is compiled as static graphs for, same format as the warm-up shapes
+    std::string staticShapeVariants{};
+    std::vector<std::map<std::string, std::vector<size_t>>> staticShapeVariantSets;
+    // The number of inferences with the same input shapes after which a static graph is built for them, 0 - never
+    uint32_t staticShapeVariantsThreshold = 0;
+    static std::string toString(HugePagesMode mode);
+
     void readProperties(const std::map<std::string, std::string> &config);
     void updateProperties();
     std::map<std::string, std::string> _config;
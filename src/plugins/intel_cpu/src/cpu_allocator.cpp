@@ -0,0 +1,130 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_allocator.h"
+
+#include <cstdint>
+#include <new>
+
+#include <common/utils.hpp>
+
+#if defined(__linux__)
+#    include <sys/mman.h>
+#endif
+
+#if defined(__linux__) && !defined(MAP_HUGE_SHIFT)
+#    define MAP_HUGE_SHIFT 26
+#endif
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+size_t roundUp(size_t size, size_t alignment) {
+    return (size + alignment - 1) / alignment * alignment;
+}
+
+#if defined(__linux__)
+int pageSizeShift(size_t pageSize) {
+    int result = 0;
+    while (pageSize >>= 1)
+        ++result;
+    return result;
+}
+#endif
+}   // namespace
+
+HugePagesAllocator::HugePagesAllocator(size_t hugeTLBPageSize) : hugeTLBPageSize(hugeTLBPageSize) {}
+
+void* HugePagesAllocator::mapHugeTLB(size_t size) {
+#if defined(__linux__) && defined(MAP_HUGETLB)
+    const auto mappedSize = roundUp(size, hugeTLBPageSize);
+    const int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | (pageSizeShift(hugeTLBPageSize) << MAP_HUGE_SHIFT);
+    // the private mapping reserves the pages on mmap, so the exhausted pool is reported here and not on the first touch
+    void* ptr = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, flags, -1, 0);
+    if (ptr == MAP_FAILED)
+        return nullptr;
+    mappings[ptr] = {mappedSize, true};
+    return ptr;
+#else
+    return nullptr;
+#endif
+}
+
+void* HugePagesAllocator::mapTransparent(size_t size, bool& hugePages) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    // the kernel backs by huge pages only the aligned huge page ranges, so the buffer is aligned to the huge page
+    const auto alignedSize = roundUp(size, transparentHugePageSize);
+    const auto mappedSize = alignedSize + transparentHugePageSize;
+    void* base = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED)
+        return nullptr;
+
+    const auto begin = reinterpret_cast<uintptr_t>(base);
+    const auto alignedBegin = roundUp(begin, transparentHugePageSize);
+    if (alignedBegin != begin)
+        munmap(base, alignedBegin - begin);
+    const auto tail = begin + mappedSize - (alignedBegin + alignedSize);
+    if (tail != 0)
+        munmap(reinterpret_cast<void*>(alignedBegin + alignedSize), tail);
+
+    void* ptr = reinterpret_cast<void*>(alignedBegin);
+    hugePages = madvise(ptr, alignedSize, MADV_HUGEPAGE) == 0;
+    mappings[ptr] = {alignedSize, hugePages};
+    return ptr;
+#else
+    return nullptr;
+#endif
+}
+
+void* HugePagesAllocator::allocate(size_t size, size_t alignment) {
+    std::lock_guard<std::mutex> lock{guard};
+    void* ptr = nullptr;
+    bool hugePages = false;
+    if (hugeTLBPageSize != 0 && size >= hugeTLBPageSize && alignment <= hugeTLBPageSize) {
+        ptr = mapHugeTLB(size);
+        hugePages = ptr != nullptr;
+        if (!ptr)
+            statistics.hugeTLBFallbacks++;
+    }
+    if (!ptr && size >= transparentHugePageSize && alignment <= transparentHugePageSize)
+        ptr = mapTransparent(size, hugePages);
+    if (!ptr) {
+        ptr = dnnl::impl::malloc(size, static_cast<int>(alignment));
+        if (!ptr)
+            throw std::bad_alloc();
+    }
+
+    statistics.allocatedBytes += size;
+    if (hugePages)
+        statistics.hugePagesBytes += size;
+    return ptr;
+}
+
+void HugePagesAllocator::deallocate(void* ptr, size_t size) noexcept {
+    if (!ptr)
+        return;
+
+    std::lock_guard<std::mutex> lock{guard};
+    statistics.allocatedBytes -= size;
+    auto mapping = mappings.find(ptr);
+    if (mapping == mappings.end()) {
+        dnnl::impl::free(ptr);
+        return;
+    }
+    if (mapping->second.hugePages)
+        statistics.hugePagesBytes -= size;
+#if defined(__linux__)
+    munmap(ptr, mapping->second.size);
+#endif
+    mappings.erase(mapping);
+}
+
+HugePagesAllocator::Statistics HugePagesAllocator::getStatistics() const {
+    std::lock_guard<std::mutex> lock{guard};
+    return statistics;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,87 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @interface IMemoryAllocator
+ * @brief An interface to the allocator of the memory buffers owned by the memory managers
+ */
+class IMemoryAllocator {
+public:
+    virtual ~IMemoryAllocator() = default;
+
+    /**
+     * @brief Allocates a memory buffer, throws std::bad_alloc on failure
+     * @param size - size of the buffer in bytes
+     * @param alignment - required alignment of the buffer
+     * @return A pointer to the allocated buffer
+     */
+    virtual void* allocate(size_t size, size_t alignment) = 0;
+
+    /**
+     * @brief Releases the memory buffer returned by allocate
+     * @param ptr - pointer to the buffer
+     * @param size - size of the buffer passed to allocate
+     */
+    virtual void deallocate(void* ptr, size_t size) noexcept = 0;
+};
+
+using MemoryAllocatorPtr = std::shared_ptr<IMemoryAllocator>;
+
+/**
+ * @brief An allocator backing big buffers by huge pages to reduce TLB misses on big activations and weights.
+ * Buffers of at least hugePageSize bytes are mapped from the preallocated hugetlbfs pool (2MB or 1GB pages)
+ * if it is requested, other buffers of at least 2MB are mapped with transparent huge pages advice.
+ * If the hugetlbfs pool is exhausted the transparent huge pages are used, smaller buffers are allocated as usual.
+ */
+class HugePagesAllocator : public IMemoryAllocator {
+public:
+    struct Statistics {
+        size_t allocatedBytes = 0;   // bytes of all the alive buffers
+        size_t hugePagesBytes = 0;   // bytes of the alive buffers backed by huge pages
+        size_t hugeTLBFallbacks = 0; // number of the buffers not served by the hugetlbfs pool
+    };
+
+    /**
+     * @param hugeTLBPageSize - size of the hugetlbfs pages to use (2MB or 1GB), 0 to use transparent huge pages only
+     */
+    explicit HugePagesAllocator(size_t hugeTLBPageSize = 0);
+
+    void* allocate(size_t size, size_t alignment) override;
+    void deallocate(void* ptr, size_t size) noexcept override;
+
+    /**
+     * @brief Returns the huge pages coverage of the buffers allocated by this object.
+     * The transparent huge pages are advice only, so the kernel may back such buffers by the regular pages.
+     */
+    Statistics getStatistics() const;
+
+    static constexpr size_t transparentHugePageSize = 2 * 1024 * 1024;
+
+private:
+    struct Mapping {
+        size_t size;
+        bool hugePages;
+    };
+
+    void* mapHugeTLB(size_t size);
+    void* mapTransparent(size_t size, bool& hugePages);
+
+    const size_t hugeTLBPageSize;
+    mutable std::mutex guard;
+    std::unordered_map<void*, Mapping> mappings;
+    Statistics statistics;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
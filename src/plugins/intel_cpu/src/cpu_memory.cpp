@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <cstring>
 #include <vector>
 #include <numeric>
 #include <unordered_set>
@@ -37,6 +39,9 @@ Memory::Memory(const dnnl::engine& eng) :
     eng(eng), mgrHandle(std::make_shared<DnnlMemoryMngr>(std::unique_ptr<MemoryMngrWithReuse>(new MemoryMngrWithReuse())), this) {}
 Memory::Memory(const dnnl::engine& eng, std::unique_ptr<IMemoryMngr> mngr) :
     eng(eng), mgrHandle(std::make_shared<DnnlMemoryMngr>(std::move(mngr)), this) {}
+Memory::Memory(const dnnl::engine& eng, MemoryAllocatorPtr allocator) :
+    eng(eng), mgrHandle(std::make_shared<DnnlMemoryMngr>(
+        std::unique_ptr<MemoryMngrWithReuse>(new MemoryMngrWithReuse(std::move(allocator)))), this) {}
 
 size_t Memory::GetSize() const {
     auto size = getDesc().getCurrentMemSize();
@@ -177,13 +182,21 @@ bool MemoryMngrWithReuse::resize(size_t size) {
     constexpr int cacheLineSize = 64;
     bool sizeChanged = false;
     if (size > _memUpperBound) {
-        void *ptr = dnnl::impl::malloc(size, cacheLineSize);
-        if (!ptr) {
-            throw std::bad_alloc();
+        if (_allocator) {
+            void *ptr = _allocator->allocate(size, cacheLineSize);
+            auto allocator = _allocator;
+            _data = decltype(_data)(ptr, [allocator, size](void *data) {
+                allocator->deallocate(data, size);
+            });
+        } else {
+            void *ptr = dnnl::impl::malloc(size, cacheLineSize);
+            if (!ptr) {
+                throw std::bad_alloc();
+            }
+            _data = decltype(_data)(ptr, destroy);
         }
         _memUpperBound = size;
         _useExternalStorage = false;
-        _data = decltype(_data)(ptr, destroy);
         sizeChanged = true;
     }
     return sizeChanged;
@@ -239,5 +252,96 @@ void DnnlMemoryMngr::notifyUpdate() {
         }
     }
 }
+
+std::vector<DnnlMemoryMngrPtr> MemoryPartitions::create(DnnlMemoryMngrPtr base, size_t count, bool growable) {
+    std::shared_ptr<MemoryPartitions> partitions(new MemoryPartitions(std::move(base), count, growable));
+    partitions->_basePtr = partitions->_base->getRawPtr();
+
+    std::vector<DnnlMemoryMngrPtr> mngrs;
+    for (size_t i = 0; i < count; i++) {
+        mngrs.push_back(std::make_shared<DnnlMemoryMngr>(std::unique_ptr<IMemoryMngr>(new PartitionMemoryMngr(partitions, i))));
+        partitions->_partitions.push_back(mngrs.back());
+    }
+    return mngrs;
+}
+
+size_t MemoryPartitions::getOffset(size_t idx) const noexcept {
+    return std::accumulate(_sizes.begin(), _sizes.begin() + idx, static_cast<size_t>(0));
+}
+
+void* MemoryPartitions::getRawPtr(size_t idx) const noexcept {
+    auto data = static_cast<uint8_t*>(_base->getRawPtr());
+    return data ? data + getOffset(idx) : nullptr;
+}
+
+bool MemoryPartitions::resize(size_t idx, size_t size) {
+    const size_t oldSize = _sizes[idx];
+    // the base buffer of the views may be reallocated by its owner
+    if (oldSize == size && _base->getRawPtr() == _basePtr)
+        return false;
+
+    const size_t offset = getOffset(idx);
+    const size_t oldTotal = std::accumulate(_sizes.begin(), _sizes.end(), static_cast<size_t>(0));
+    const size_t tailOffset = offset + oldSize;
+    const size_t tailSize = oldTotal - tailOffset;
+    const size_t total = oldTotal - oldSize + size;
+    _sizes[idx] = size;
+
+    if (_growable) {
+        auto data = static_cast<uint8_t*>(_base->getRawPtr());
+        if (total > _capacity) {
+            // the base manager doesn't keep the data on reallocation, the headroom amortizes the copies of the growing partitions
+            std::vector<uint8_t> kept;
+            if (data)
+                kept.assign(data, data + oldTotal);
+            _capacity = total + total / 2;
+            _base->resize(_capacity);
+            data = static_cast<uint8_t*>(_base->getRawPtr());
+            if (!kept.empty()) {
+                cpu_memcpy(data, kept.data(), offset + std::min(oldSize, size));
+                cpu_memcpy(data + offset + size, kept.data() + tailOffset, tailSize);
+            }
+        } else if (data && size != oldSize && tailSize > 0) {
+            std::memmove(data + offset + size, data + tailOffset, tailSize);
+        }
+    }
+
+    void* basePtr = _base->getRawPtr();
+    if (basePtr != _basePtr) {
+        _basePtr = basePtr;
+        notifyPartitions(0);
+        return true;
+    }
+    if (size != oldSize)
+        notifyPartitions(idx + 1);
+    return false;
+}
+
+bool MemoryPartitions::hasExtBuffer() const noexcept {
+    return _base->hasExtBuffer();
+}
+
+void MemoryPartitions::notifyPartitions(size_t from) {
+    for (size_t i = from; i < _partitions.size(); i++) {
+        if (auto partition = _partitions[i].lock())
+            partition->notifyUpdate();
+    }
+}
+
+void* PartitionMemoryMngr::getRawPtr() const noexcept {
+    return _partitions->getRawPtr(_idx);
+}
+
+void PartitionMemoryMngr::setExtBuff(void* ptr, size_t size) {
+    IE_THROW() << "A partition of the memory buffer can't be bound to an external buffer";
+}
+
+bool PartitionMemoryMngr::resize(size_t size) {
+    return _partitions->resize(_idx, size);
+}
+
+bool PartitionMemoryMngr::hasExtBuffer() const noexcept {
+    return _partitions->hasExtBuffer();
+}
 }   // namespace intel_cpu
 }   // namespace ov
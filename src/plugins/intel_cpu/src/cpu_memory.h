@@ -12,6 +12,7 @@
 #include <cpu_shape.h>
 
 #include "memory_desc/dnnl_memory_desc.h"
+#include "cpu_allocator.h"
 
 #include <string>
 #include <functional>
@@ -71,10 +72,12 @@ public:
 
 /**
  * @brief An implementation of the mem manager where memory reallocation occures only if bigger buffer is requested.
+ * The buffers are allocated by the given allocator (e.g. backed by huge pages) or by the default oneDNN allocator.
  */
 class MemoryMngrWithReuse : public IMemoryMngr {
 public:
-    MemoryMngrWithReuse() : _data(nullptr, release) {}
+    explicit MemoryMngrWithReuse(MemoryAllocatorPtr allocator = nullptr)
+        : _allocator(std::move(allocator)), _data(nullptr, release) {}
     void* getRawPtr() const noexcept override;
     void setExtBuff(void* ptr, size_t size) override;
     bool resize(size_t size) override;
@@ -83,7 +86,8 @@ public:
 private:
     bool _useExternalStorage = false;
     size_t _memUpperBound = 0ul;
-    std::unique_ptr<void, void (*)(void *)> _data;
+    MemoryAllocatorPtr _allocator;
+    std::unique_ptr<void, std::function<void(void *)>> _data;
 
     static void release(void *ptr);
     static void destroy(void *ptr);
@@ -101,8 +105,6 @@ public:
     bool hasExtBuffer() const noexcept override;
     void registerMemory(Memory* memPtr);
     void unregisterMemory(Memory* memPtr);
-
-private:
     void notifyUpdate();
 
 private:
@@ -113,6 +115,59 @@ private:
 using DnnlMemoryMngrPtr = std::shared_ptr<DnnlMemoryMngr>;
 using DnnlMemoryMngrCPtr = std::shared_ptr<const DnnlMemoryMngr>;
 
+/**
+ * @brief Splits the buffer of the base memory manager into consecutive partitions, the offset of a partition is the total size
+ * of the preceding ones. It allows the inputs of the dynamic in-place Concat and the outputs of the dynamic in-place Split
+ * to be views of a single buffer.
+ */
+class MemoryPartitions {
+public:
+    /**
+     * @brief Creates the memory managers of the partitions
+     * @param base - memory manager of the whole buffer
+     * @param count - number of the partitions
+     * @param growable - if true, the partitions grow the base buffer with a headroom and keep their data when they are moved,
+     * otherwise the base buffer is defined by its owner and the partitions are only views of its data
+     * @return The memory managers of the partitions
+     */
+    static std::vector<DnnlMemoryMngrPtr> create(DnnlMemoryMngrPtr base, size_t count, bool growable);
+
+    void* getRawPtr(size_t idx) const noexcept;
+    bool resize(size_t idx, size_t size);
+    bool hasExtBuffer() const noexcept;
+
+private:
+    MemoryPartitions(DnnlMemoryMngrPtr base, size_t count, bool growable)
+        : _base(std::move(base)), _sizes(count, 0), _growable(growable) {}
+
+    size_t getOffset(size_t idx) const noexcept;
+    void notifyPartitions(size_t from);
+
+    DnnlMemoryMngrPtr _base;
+    std::vector<size_t> _sizes;
+    std::vector<std::weak_ptr<DnnlMemoryMngr>> _partitions;
+    void* _basePtr = nullptr;
+    size_t _capacity = 0;
+    bool _growable;
+};
+
+/**
+ * @brief A memory manager of a single partition of the MemoryPartitions buffer
+ */
+class PartitionMemoryMngr : public IMemoryMngr {
+public:
+    PartitionMemoryMngr(std::shared_ptr<MemoryPartitions> partitions, size_t idx)
+        : _partitions(std::move(partitions)), _idx(idx) {}
+    void* getRawPtr() const noexcept override;
+    void setExtBuff(void* ptr, size_t size) override;
+    bool resize(size_t size) override;
+    bool hasExtBuffer() const noexcept override;
+
+private:
+    std::shared_ptr<MemoryPartitions> _partitions;
+    size_t _idx;
+};
+
 class DnnlMemMngrHandle {
 public:
     DnnlMemMngrHandle(DnnlMemoryMngrPtr pMgr, Memory* pMem) : _pMgr(pMgr), _pMem(pMem) {
@@ -157,6 +212,7 @@ class Memory {
 public:
     explicit Memory(const dnnl::engine& eng);
     Memory(const dnnl::engine& eng, std::unique_ptr<IMemoryMngr> mngr);
+    Memory(const dnnl::engine& eng, MemoryAllocatorPtr allocator);
 
     Memory(const Memory&) = delete;
     Memory& operator= (const Memory&) = delete;
@@ -191,6 +191,9 @@ const InferenceEngine::details::caseless_unordered_map<std::string, Type> type_t
         { "Subgraph", Type::Subgraph},
         { "PriorBox", Type::PriorBox},
         { "PriorBoxClustered", Type::PriorBoxClustered},
+        { "ImagePreprocess", Type::ImagePreprocess},
+        { "ScaledDotProductAttention", Type::ScaledDotProductAttention},
+        { "KVCache", Type::KVCache},
 };
 
 Type TypeFromName(const std::string& type) {
@@ -376,6 +379,12 @@ std::string NameFromType(const Type type) {
             return "Reference";
         case Type::Subgraph:
             return "Subgraph";
+        case Type::ImagePreprocess:
+            return "ImagePreprocess";
+        case Type::ScaledDotProductAttention:
+            return "ScaledDotProductAttention";
+        case Type::KVCache:
+            return "KVCache";
         default:
             return "Unknown";
     }
@@ -105,6 +105,9 @@ enum class Type {
     Subgraph,
     PriorBox,
     PriorBoxClustered,
+    ImagePreprocess,
+    ScaledDotProductAttention,
+    KVCache,
 };
 
 enum class Algorithm {
@@ -33,6 +33,12 @@ bool Edge::isUseExternalMemory() const {
     return useExternalMemory;
 }
 
+WeightsSharing::SharedMemory::Ptr Edge::getExternalMemory() const {
+    if (!useExternalMemory)
+        IE_THROW() << "Edge " << name() << " doesn't use external memory";
+    return externalCache->get(externalKey);
+}
+
 bool Edge::isDropped() const {
     bool not_in_parent = true;
     bool not_in_child = true;
@@ -259,6 +265,10 @@ int Edge::getOutputNum() const {
 }
 
 void Edge::allocate(const void* mem_ptr) {
+    allocate(mem_ptr, nullptr);
+}
+
+void Edge::allocate(const void* mem_ptr, const MemoryAllocatorPtr& allocator) {
     if (status != Status::NeedAllocation)
         return;
 
@@ -271,7 +281,7 @@ void Edge::allocate(const void* mem_ptr) {
         IE_THROW() << "Cannot allocate memory for incompatible descriptors.";
 
     auto parentPtr = getParent();
-    memoryPtr.reset(new Memory(parentPtr->getEngine()));
+    memoryPtr.reset(new Memory(parentPtr->getEngine(), allocator));
 
     memoryPtr->Create(inputDesc, mem_ptr, false);  // no pads zeroing
     status = Status::Allocated;
@@ -288,7 +298,8 @@ std::string Edge::name() const {
     return  result.str();
 }
 
-void Edge::externalAllocate(WeightsSharing::Ptr weightsCache) {
+void Edge::externalAllocate(WeightsSharing::Ptr weightsCache, const std::string& sharedKey,
+                            const MemoryAllocatorPtr& allocator) {
     auto isInPlace = [](const NodePtr node, int port) -> bool {
         const auto& selected_pd = node->getSelectedPrimitiveDescriptor();
         if (selected_pd == nullptr)
@@ -317,17 +328,19 @@ void Edge::externalAllocate(WeightsSharing::Ptr weightsCache) {
     bool isConcurrentUpdatePossible = isInPlace(getParent(), getInputNum()) || isInPlace(getChild(), getOutputNum()) || !isTheOnlyChildEdgeAtPort;
 
     if (weightsCache && !isConcurrentUpdatePossible) {
-        auto alloc = [this] () {
-            allocate();
+        auto alloc = [this, &allocator] () {
+            allocate(nullptr, allocator);
             return memoryPtr;
         };
 
-        auto ptr = weightsCache->findOrCreate(name(), alloc, false);
+        externalCache = weightsCache;
+        externalKey = sharedKey.empty() ? name() : sharedKey;
+        auto ptr = weightsCache->findOrCreate(externalKey, alloc, false);
         memoryPtr = *ptr;
         useExternalMemory = true;
         status = Status::Allocated;
     } else {
-        allocate();
+        allocate(nullptr, allocator);
     }
 }
 
@@ -51,7 +51,8 @@ public:
 
     void init();
     void allocate(const void* mem_ptr = nullptr);
-    void externalAllocate(WeightsSharing::Ptr weightsCache);
+    void externalAllocate(WeightsSharing::Ptr weightsCache, const std::string& sharedKey = {},
+                          const MemoryAllocatorPtr& allocator = nullptr);
     void reuse(MemoryPtr ptr);
     void validate();
     void drop();
@@ -65,6 +66,7 @@ public:
     ReorderStatus needReorder();
     bool isDropped() const;
     bool isUseExternalMemory() const;
+    WeightsSharing::SharedMemory::Ptr getExternalMemory() const;
 
     int getInputNum() const;
     int getOutputNum() const;
@@ -81,6 +83,7 @@ public:
 
 private:
     std::string name() const;
+    void allocate(const void* mem_ptr, const MemoryAllocatorPtr& allocator);
 
     std::weak_ptr<Node> parent;
     std::weak_ptr<Node> child;
@@ -88,6 +91,8 @@ private:
     int child_port;
 
     bool useExternalMemory = false;
+    WeightsSharing::Ptr externalCache;
+    std::string externalKey;
     EdgeWeakPtr memoryFromEdge;
     MemoryPtr memoryPtr;
     Status status = Status::Uninitialized;
@@ -13,6 +13,8 @@
 #include "serialize.h"
 #include "ngraph/type/element_type.hpp"
 #include "nodes/memory.hpp"
+#include "nodes/kv_cache.h"
+#include "utils/general_utils.h"
 #include <threading/ie_executor_manager.hpp>
 #define FIX_62820 0
 #if FIX_62820 && ((IE_THREAD == IE_THREAD_TBB) || (IE_THREAD == IE_THREAD_TBB_AUTO))
@@ -26,12 +28,14 @@
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
 #include "ie_icore.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
 #include "openvino/util/common_util.hpp"
 
 #include <algorithm>
 #include <unordered_set>
 #include <utility>
 #include <cstring>
+#include <sstream>
 
 using namespace InferenceEngine;
 using namespace InferenceEngine::details;
@@ -64,15 +68,34 @@ struct ImmediateSerialExecutor : public ITaskExecutor {
     std::mutex _mutex;
 };
 
+namespace {
+std::shared_ptr<HugePagesAllocator> createHugePagesAllocator(Config::HugePagesMode mode) {
+    switch (mode) {
+    case Config::HugePagesMode::Transparent:
+        return std::make_shared<HugePagesAllocator>();
+    case Config::HugePagesMode::HugeTLB2MB:
+        return std::make_shared<HugePagesAllocator>(2ul * 1024 * 1024);
+    case Config::HugePagesMode::HugeTLB1GB:
+        return std::make_shared<HugePagesAllocator>(1024ul * 1024 * 1024);
+    default:
+        return nullptr;
+    }
+}
+}   // namespace
+
 ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
                          const Config &cfg,
                          const ExtensionManager::Ptr& extMgr,
-                         const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin) :
+                         const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin,
+                         const Timeline::Ptr& timeline) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
     _cfg{cfg},
     _name{network.getName()},
-    _network(network) {
+    _timeline{timeline},
+    _network(network),
+    _hugePagesAllocator{createHugePagesAllocator(cfg.hugePages)},
+    _numaNodesWeights{_hugePagesAllocator} {
     SetPointerToPlugin(plugin);
     auto function = network.getFunction();
     if (function == nullptr) {
@@ -119,6 +142,13 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
     } else {
         _callbackExecutor = _taskExecutor;
     }
+    if (_cfg.asyncPreprocessing && !cfg.exclusiveAsyncRequests && 0 != cfg.streamExecutorConfig._streams) {
+        // one single threaded stream per graph stream, so every request in flight converts its inputs in parallel
+        const int preprocessStreams = std::max(1, _cfg.streamExecutorConfig._streams);
+        _preprocessExecutor = _plugin->executorManager()->getIdleCPUStreamsExecutor(
+                                IStreamsExecutor::Config{"CPUPreprocessExecutor", preprocessStreams, 1,
+                                                         IStreamsExecutor::ThreadBindingType::NONE});
+    }
 
     int streams = std::max(1, _cfg.streamExecutorConfig._streams);
     std::vector<Task> tasks; tasks.resize(streams);
@@ -160,29 +190,58 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
                     state_name = state_name.substr(0, suffix_idx);
 
                 memoryStates.emplace_back(new VariableState(state_name, state_store));
+            } else if (node->getType() == Type::KVCache) {
+                auto kvCacheNode = dynamic_cast<node::KVCache*>(node.get());
+                if (!kvCacheNode) {
+                    IE_THROW() << "Cannot cast " << node->getName() << " to KVCache";
+                }
+                memoryStates.emplace_back(kvCacheNode->makeState());
             }
         }
     }
+
+    // Warm-up restores the stores of the states, so it does not affect initial values of the states.
+    WarmUp();
+
+    CreateStaticVariants();
 }
 
-ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
+int ExecNetwork::GetGraphIdx(int& numaNodeId) const {
     int streamId = 0;
-    int numaNodeId = 0;
+    numaNodeId = 0;
     auto streamsExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
     if (nullptr != streamsExecutor) {
         streamId = streamsExecutor->GetStreamId();
         numaNodeId = streamsExecutor->GetNumaNodeId();
     }
-    auto graphLock = GraphGuard::Lock(_graphs[streamId % _graphs.size()]);
+    return streamId % _graphs.size();
+}
+
+ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
+    int numaNodeId = 0;
+    const int graphIdx = GetGraphIdx(numaNodeId);
+    auto streamsExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
+    auto graphLock = GraphGuard::Lock(_graphs[graphIdx]);
     if (!graphLock._graph.IsReady()) {
         std::exception_ptr exception;
         auto makeGraph = [&] {
             try {
+                bool bindToNuma = false;
                 {
                     std::lock_guard<std::mutex> lock{_cfgMutex};
                     graphLock._graph.setConfig(_cfg);
+                    // the streams threads run on their NUMA nodes, so the graph memory is bound to the same node
+                    bindToNuma = _cfg.streamExecutorConfig._threadBindingType ==
+                                     InferenceEngine::IStreamsExecutor::ThreadBindingType::NUMA &&
+                                 getAvailableNUMANodes().size() > 1;
                 }
+                graphLock._graph.setTimeline(_timeline);
+                graphLock._graph.setNumaNodeId(nullptr != streamsExecutor && bindToNuma ? numaNodeId : -1);
+                graphLock._graph.setMemoryAllocator(_hugePagesAllocator);
                 graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights[numaNodeId]);
+                std::lock_guard<std::mutex> lock{_numaPlacementMutex};
+                _numaPlacement[graphIdx] = graphLock._graph.getNumaPlacement();
+                _graphNumaNodeIds[graphIdx] = numaNodeId;
             } catch(...) {
                 exception = std::current_exception();
             }
@@ -199,6 +258,196 @@ ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
     return graphLock;
 }
 
+void ExecNetwork::WarmUp() {
+    std::vector<std::map<std::string, VectorDims>> shapeSets;
+    {
+        std::lock_guard<std::mutex> lock{_cfgMutex};
+        shapeSets = _cfg.warmUpShapeSets;
+    }
+    if (shapeSets.empty())
+        return;
+
+    // every task warms up its own graph, so each graph is warmed up once whichever stream runs the task
+    std::vector<Task> tasks(_graphs.size());
+    for (size_t graphIdx = 0; graphIdx < _graphs.size(); graphIdx++) {
+        tasks[graphIdx] = [this, graphIdx, &shapeSets] {
+            auto graphLock = GraphGuard::Lock(_graphs[graphIdx]);
+            for (const auto& shapes : shapeSets)
+                graphLock._graph.WarmUp(shapes);
+        };
+    }
+    if (_cfg.streamExecutorConfig._streams != 0) {
+        _taskExecutor->runAndWait(tasks);
+    } else {
+        for (const auto& task : tasks)
+            task();
+    }
+}
+
+void ExecNetwork::CreateStaticVariants() {
+    std::vector<ShapeSignature> declaredShapes;
+    {
+        auto graphLock = GetGraph();
+        auto& graph = graphLock._graph;
+        const auto& nodes = graph.GetNodes();
+        // the states are stored in the graph, so the models with states are always inferred by the same graph
+        _staticVariantsEnabled = graph.hasDynamicInput() && _cfg.isNewApi && _cfg.batchLimit == 0 &&
+                                 (_cfg.staticShapeVariantsThreshold > 0 || !_cfg.staticShapeVariantSets.empty()) &&
+                                 std::none_of(nodes.begin(), nodes.end(), [](const NodePtr& node) {
+                                     return one_of(node->getType(), Type::MemoryInput, Type::KVCache);
+                                 });
+        if (!_staticVariantsEnabled)
+            return;
+        if (_cfg.staticShapeVariantsThreshold > 0) {
+            // a single thread compiles the detected variants one by one in the background
+            _compileExecutor = _plugin->executorManager()->getIdleCPUStreamsExecutor(
+                                    IStreamsExecutor::Config{"CPUCompileExecutor", 1, 1,
+                                                             IStreamsExecutor::ThreadBindingType::NONE});
+        }
+
+        // the signature of the declared shapes is completed with the static inputs to match the request inputs
+        const auto& inputs = graph.GetInputNodesMap();
+        for (const auto& shapeSet : _cfg.staticShapeVariantSets) {
+            ShapeSignature shapes;
+            for (const auto& shape : shapeSet) {
+                if (shape.first.empty() && inputs.size() != 1)
+                    IE_THROW() << "Static shape variant without an input name is allowed only for models with a single input";
+                const auto& name = shape.first.empty() ? inputs.begin()->first : shape.first;
+                const auto input = inputs.find(name);
+                if (input == inputs.end())
+                    IE_THROW() << "Static shape variants contain unknown input " << name;
+                if (!input->second->getOutputShapeAtPort(0).isCompatible(shape.second))
+                    IE_THROW() << "Static shape variant " << vec2str(shape.second) << " is not compatible with input " << name
+                               << " shape " << input->second->getOutputShapeAtPort(0).toString();
+                shapes[name] = shape.second;
+            }
+            for (const auto& input : inputs) {
+                if (shapes.count(input.first))
+                    continue;
+                const auto& shape = input.second->getOutputShapeAtPort(0);
+                if (!shape.isStatic())
+                    IE_THROW() << "Static shape variant is not specified for dynamic input " << input.first;
+                shapes[input.first] = shape.getStaticDims();
+            }
+            declaredShapes.push_back(shapes);
+        }
+    }
+
+    for (const auto& shapes : declaredShapes)
+        _staticVariants.emplace(shapes, std::make_shared<StaticVariant>(shapes, _graphs.size(), _hugePagesAllocator));
+    if (_staticVariants.empty())
+        return;
+
+    // the stream graphs are created already, so the static graphs are created for every stream in place
+    for (int graphIdx = 0; graphIdx < static_cast<int>(_graphs.size()); graphIdx++) {
+        for (auto& variant : _staticVariants)
+            CreateStaticVariantGraph(*variant.second, graphIdx);
+    }
+}
+
+void ExecNetwork::CreateStaticVariantGraph(StaticVariant& variant, int graphIdx) const {
+    auto graphLock = GraphGuard::Lock(variant.graphs[graphIdx]);
+    if (graphLock._graph.IsReady() || variant.failed)
+        return;
+
+    try {
+        std::shared_ptr<const CNNNetwork> network;
+        {
+            std::lock_guard<std::mutex> lock{variant.networkMutex};
+            if (!variant.network) {
+                auto reshaped = std::make_shared<CNNNetwork>(cloneNetwork(_network));
+                const auto function = reshaped->getFunction();
+                for (const auto& parameter : function->get_parameters()) {
+                    const auto shape = variant.shapes.find(parameter->get_friendly_name());
+                    if (shape != variant.shapes.end())
+                        parameter->set_partial_shape(ov::PartialShape(ov::Shape(shape->second)));
+                }
+                function->validate_nodes_and_infer_types();
+                if (function->is_dynamic())
+                    IE_THROW() << "The model has data dependent shapes";
+                variant.network = reshaped;
+            }
+            network = variant.network;
+        }
+
+        // the graph is bound to the NUMA node of the stream graph, not of the thread it is created on
+        int numaNodeId = 0;
+        int placementNumaNodeId = -1;
+        {
+            std::lock_guard<std::mutex> lock{_numaPlacementMutex};
+            const auto placement = _numaPlacement.find(graphIdx);
+            if (placement != _numaPlacement.end())
+                placementNumaNodeId = placement->second.numaNodeId;
+            const auto streamNumaNodeId = _graphNumaNodeIds.find(graphIdx);
+            if (streamNumaNodeId != _graphNumaNodeIds.end())
+                numaNodeId = streamNumaNodeId->second;
+        }
+        {
+            std::lock_guard<std::mutex> lock{_cfgMutex};
+            graphLock._graph.setConfig(_cfg);
+        }
+        graphLock._graph.setNumaNodeId(placementNumaNodeId);
+        graphLock._graph.setMemoryAllocator(_hugePagesAllocator);
+        graphLock._graph.CreateGraph(*network, extensionManager, variant.weights[numaNodeId]);
+    } catch (...) {
+        // the model can not be specialized for the shapes, so they are inferred by the dynamic graphs
+        variant.failed = true;
+    }
+}
+
+std::unique_ptr<ExecNetwork::GraphGuard::Lock> ExecNetwork::GetStaticVariantGraph(const ShapeSignature& shapes) {
+    std::shared_ptr<StaticVariant> variant;
+    {
+        std::lock_guard<std::mutex> lock{_staticVariantsMutex};
+        const auto found = _staticVariants.find(shapes);
+        if (found != _staticVariants.end()) {
+            variant = found->second;
+        } else {
+            if (_cfg.staticShapeVariantsThreshold == 0 || _detectedStaticVariants >= maxDetectedStaticVariants)
+                return nullptr;
+            // the counters are reset when there are too many shapes, so they do not grow with every new shape
+            if (_shapeSignatureHits.size() >= maxTrackedShapeSignatures && !_shapeSignatureHits.count(shapes))
+                _shapeSignatureHits.clear();
+            if (++_shapeSignatureHits[shapes] < _cfg.staticShapeVariantsThreshold)
+                return nullptr;
+            _shapeSignatureHits.erase(shapes);
+            variant = std::make_shared<StaticVariant>(shapes, _graphs.size(), _hugePagesAllocator);
+            _staticVariants.emplace(shapes, variant);
+            _detectedStaticVariants++;
+        }
+    }
+    if (variant->failed)
+        return nullptr;
+
+    int numaNodeId = 0;
+    const int graphIdx = GetGraphIdx(numaNodeId);
+    std::unique_ptr<GraphGuard::Lock> graphLock(new GraphGuard::Lock(variant->graphs[graphIdx]));
+    if (graphLock->_graph.IsReady())
+        return graphLock;
+
+    // The graph is created on the compile executor, so the compilation does not occupy the stream of the request.
+    // The task creates the graph of the current stream, the next request on the other streams queues it again.
+    if (_compileExecutor && !variant->buildPending.exchange(true)) {
+        auto self = std::static_pointer_cast<ExecNetwork>(shared_from_this());
+        _compileExecutor->run([self, variant, graphIdx] {
+            self->CreateStaticVariantGraph(*variant, graphIdx);
+            variant->buildPending = false;
+        });
+    }
+    return nullptr;
+}
+
+void ExecNetwork::SetConfig(const std::map<std::string, Parameter> &config) {
+    std::map<std::string, std::string> properties;
+    for (const auto& property : config) {
+        if (property.first != ov::intel_cpu::warm_up_shapes.name())
+            IE_THROW(NotImplemented) << "Property " << property.first << " can not be changed for the compiled model";
+        properties[property.first] = property.second.as<std::string>();
+    }
+    setProperty(properties);
+    WarmUp();
+}
+
 void ExecNetwork::setProperty(const std::map<std::string, std::string> &properties) {
     {
         std::lock_guard<std::mutex> lock{_cfgMutex};
@@ -300,6 +549,9 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
     auto RO_property = [](const std::string& propertyName) {
         return ov::PropertyName(propertyName, ov::PropertyMutability::RO);
     };
+    auto RW_property = [](const std::string& propertyName) {
+        return ov::PropertyName(propertyName, ov::PropertyMutability::RW);
+    };
 
     if (name == ov::supported_properties) {
         return std::vector<ov::PropertyName> {
@@ -313,6 +565,18 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
             RO_property(ov::hint::inference_precision.name()),
             RO_property(ov::hint::performance_mode.name()),
             RO_property(ov::hint::num_requests.name()),
+            RW_property(ov::intel_cpu::warm_up_shapes.name()),
+            RO_property(ov::intel_cpu::first_inference_timeline.name()),
+            RO_property(ov::intel_cpu::numa_placement.name()),
+            RO_property(ov::intel_cpu::huge_pages.name()),
+            RO_property(ov::intel_cpu::huge_pages_statistics.name()),
+            RO_property(ov::intel_cpu::async_preprocessing.name()),
+            RO_property(ov::intel_cpu::attention_fusion.name()),
+            RO_property(ov::intel_cpu::image_preprocess_fusion.name()),
+            RO_property(ov::intel_cpu::hw_perf_counters.name()),
+            RO_property(ov::intel_cpu::streams_auto_tuning.name()),
+            RO_property(ov::intel_cpu::static_shape_variants.name()),
+            RO_property(ov::intel_cpu::static_shape_variants_threshold.name()),
         };
     }
 
@@ -355,6 +619,48 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
     } else if (name == ov::hint::num_requests) {
         const auto perfHintNumRequests = config.perfHintsConfig.ovPerfHintNumRequests;
         return decltype(ov::hint::num_requests)::value_type(perfHintNumRequests);
+    } else if (name == ov::intel_cpu::warm_up_shapes) {
+        return decltype(ov::intel_cpu::warm_up_shapes)::value_type(config.warmUpShapes);
+    } else if (name == ov::intel_cpu::first_inference_timeline) {
+        return decltype(ov::intel_cpu::first_inference_timeline)::value_type(_timeline ? _timeline->toChromeTrace() : "{}");
+    } else if (name == ov::intel_cpu::numa_placement) {
+        std::lock_guard<std::mutex> lock{_numaPlacementMutex};
+        std::ostringstream placement;
+        const char* separator = "";
+        placement << "[";
+        for (const auto& graphPlacement : _numaPlacement) {
+            placement << separator << "{\"graph\":" << graphPlacement.first
+                      << ",\"numa_node\":" << graphPlacement.second.numaNodeId
+                      << ",\"weights_bytes\":" << graphPlacement.second.weightsSize
+                      << ",\"activations_bytes\":" << graphPlacement.second.activationsSize << "}";
+            separator = ",";
+        }
+        placement << "]";
+        return decltype(ov::intel_cpu::numa_placement)::value_type(placement.str());
+    } else if (name == ov::intel_cpu::huge_pages) {
+        return decltype(ov::intel_cpu::huge_pages)::value_type(Config::toString(config.hugePages));
+    } else if (name == ov::intel_cpu::async_preprocessing) {
+        return decltype(ov::intel_cpu::async_preprocessing)::value_type(_preprocessExecutor != nullptr);
+    } else if (name == ov::intel_cpu::attention_fusion) {
+        return decltype(ov::intel_cpu::attention_fusion)::value_type(config.attentionFusion);
+    } else if (name == ov::intel_cpu::image_preprocess_fusion) {
+        return decltype(ov::intel_cpu::image_preprocess_fusion)::value_type(config.imagePreprocessFusion);
+    } else if (name == ov::intel_cpu::hw_perf_counters) {
+        return decltype(ov::intel_cpu::hw_perf_counters)::value_type(config.collectHwPerfCounters);
+    } else if (name == ov::intel_cpu::streams_auto_tuning) {
+        return decltype(ov::intel_cpu::streams_auto_tuning)::value_type(config.streamsAutoTuning);
+    } else if (name == ov::intel_cpu::static_shape_variants) {
+        return decltype(ov::intel_cpu::static_shape_variants)::value_type(config.staticShapeVariants);
+    } else if (name == ov::intel_cpu::static_shape_variants_threshold) {
+        return decltype(ov::intel_cpu::static_shape_variants_threshold)::value_type(config.staticShapeVariantsThreshold);
+    } else if (name == ov::intel_cpu::huge_pages_statistics) {
+        const auto statistics = _hugePagesAllocator ? _hugePagesAllocator->getStatistics()
+                                                    : HugePagesAllocator::Statistics{};
+        std::ostringstream json;
+        json << "{\"allocated_bytes\":" << statistics.allocatedBytes
+             << ",\"huge_pages_bytes\":" << statistics.hugePagesBytes
+             << ",\"hugetlb_fallbacks\":" << statistics.hugeTLBFallbacks << "}";
+        return decltype(ov::intel_cpu::huge_pages_statistics)::value_type(json.str());
     }
     /* Internally legacy parameters are used with new API as part of migration procedure.
      * This fallback can be removed as soon as migration completed */
@@ -544,7 +850,14 @@ bool ExecNetwork::CanProcessDynBatch(const InferenceEngine::CNNNetwork &network)
 }
 
 void ExecNetwork::Export(std::ostream& modelStream) {
-    CNNNetworkSerializer serializer(modelStream, extensionManager);
+    std::string warmUpShapes;
+    StreamsTuner::Result tunedStreams{};
+    {
+        std::lock_guard<std::mutex> lock{_cfgMutex};
+        warmUpShapes = _cfg.warmUpShapes;
+        tunedStreams = {_cfg.tunedStreams, _cfg.tunedStreamsHost};
+    }
+    CNNNetworkSerializer serializer(modelStream, extensionManager, warmUpShapes, tunedStreams);
     serializer <<_network;
 }
 
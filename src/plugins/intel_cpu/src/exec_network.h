@@ -36,10 +36,13 @@ public:
 
     ExecNetwork(const InferenceEngine::CNNNetwork &network, const Config &cfg,
                 const ExtensionManager::Ptr &extMgr,
-                const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin);
+                const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin,
+                const Timeline::Ptr &timeline = nullptr);
 
     void setProperty(const std::map<std::string, std::string> &properties);
 
+    void SetConfig(const std::map<std::string, InferenceEngine::Parameter> &config) override;
+
     InferenceEngine::Parameter GetConfig(const std::string &name) const override;
 
     InferenceEngine::Parameter GetMetric(const std::string &name) const override;
@@ -57,6 +60,9 @@ protected:
     Config                                      _cfg;
     std::atomic_int                             _numRequests = {0};
     std::string                                 _name;
+    Timeline::Ptr                               _timeline;
+    InferenceEngine::ITaskExecutor::Ptr         _preprocessExecutor;  // runs the async input preprocessing stage
+    InferenceEngine::ITaskExecutor::Ptr         _compileExecutor;     // creates the static graphs of the hot shapes
     struct GraphGuard : public Graph {
         std::mutex  _mutex;
         struct Lock : public std::unique_lock<std::mutex> {
@@ -67,7 +73,40 @@ protected:
 
     // WARNING: Do not use _graphs directly.
     mutable std::deque<GraphGuard>              _graphs;
+    std::shared_ptr<HugePagesAllocator>                _hugePagesAllocator;
     mutable NumaNodesWeights                           _numaNodesWeights;
+    mutable std::mutex                                 _numaPlacementMutex;
+    mutable std::map<int, Graph::NumaPlacement>        _numaPlacement;  // per graph index
+    mutable std::map<int, int>                         _graphNumaNodeIds;  // NUMA node of the stream per graph index
+
+    // Input shapes by input name
+    using ShapeSignature = std::map<std::string, VectorDims>;
+
+    /* The model reshaped to the static input shapes and its graphs, one per stream like _graphs.
+     * The graph of a stream shares the weights and the NUMA placement of the stream graph, the model is reshaped
+     * by the first graph created.
+     */
+    struct StaticVariant {
+        StaticVariant(ShapeSignature shapes, size_t numGraphs, const MemoryAllocatorPtr& weightsAllocator)
+            : shapes(std::move(shapes)), graphs(numGraphs), weights(weightsAllocator) {}
+
+        const ShapeSignature            shapes;
+        std::mutex                      networkMutex;
+        std::shared_ptr<const InferenceEngine::CNNNetwork> network;
+        std::atomic<bool>               failed{false};        // the model can not be specialized for the shapes
+        std::atomic<bool>               buildPending{false};  // a task creating a graph is queued to the compile executor
+        std::deque<GraphGuard>          graphs;
+        // the static graphs may reorder the weights differently, so they do not share them with the dynamic graphs
+        NumaNodesWeights                weights;
+    };
+    static constexpr size_t maxDetectedStaticVariants = 8;
+    static constexpr size_t maxTrackedShapeSignatures = 1024;
+
+    bool                                                      _staticVariantsEnabled = false;
+    std::mutex                                                _staticVariantsMutex;
+    std::map<ShapeSignature, std::shared_ptr<StaticVariant>>  _staticVariants;
+    std::map<ShapeSignature, uint32_t>                        _shapeSignatureHits;  // of the shapes without variants
+    size_t                                                    _detectedStaticVariants = 0;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -75,6 +114,26 @@ protected:
      */
     GraphGuard::Lock GetGraph() const;
 
+    // Index of the graph of the current stream in _graphs and the NUMA node of the stream
+    int GetGraphIdx(int& numaNodeId) const;
+
+    /* Returns the static graph of the current stream for the input shapes, nullptr if it is not created yet.
+     * Counts the inferences of the shapes and queues the creation of the static graphs of the hot shapes to the
+     * compile executor, so the streams keep inferring while the graphs are compiled.
+     */
+    std::unique_ptr<GraphGuard::Lock> GetStaticVariantGraph(const ShapeSignature& shapes);
+
+    // Creates the static graph with the index, the variant is marked as failed if the model can not be reshaped
+    void CreateStaticVariantGraph(StaticVariant& variant, int graphIdx) const;
+
+    // Creates the graphs of the variants of the configured shape sets for every stream
+    void CreateStaticVariants();
+
+    /* Runs the graph of every stream once per configured warm-up shape set.
+     * Every graph is warmed up once by a task of the streams, the memory of the graphs bound to NUMA nodes stays on them.
+     */
+    void WarmUp();
+
     bool canBeExecViaLegacyDynBatch(std::shared_ptr<const ov::Model> function, int64_t& maxBatchSize) const;
     bool CanProcessDynBatch(const InferenceEngine::CNNNetwork &network) const;
 
@@ -4,8 +4,11 @@
 
 #include "extension.h"
 #include "ngraph_transformations/op/fully_connected.hpp"
+#include "ngraph_transformations/op/image_preprocess.hpp"
+#include "ngraph_transformations/op/kv_cache.hpp"
 #include "ngraph_transformations/op/leaky_relu.hpp"
 #include "ngraph_transformations/op/power_static.hpp"
+#include "ngraph_transformations/op/scaled_dot_product_attention.hpp"
 #include "ngraph_transformations/op/swish_cpu.hpp"
 
 #include <ngraph/ngraph.hpp>
@@ -36,8 +39,11 @@ std::map<std::string, ngraph::OpSet> Extension::getOpSets() {
 
 #define NGRAPH_OP(NAME, NAMESPACE) opset.insert<NAMESPACE::NAME>();
         NGRAPH_OP(FullyConnectedNode, ov::intel_cpu)
+        NGRAPH_OP(ImagePreprocessNode, ov::intel_cpu)
+        NGRAPH_OP(KVCacheNode, ov::intel_cpu)
         NGRAPH_OP(LeakyReluNode, ov::intel_cpu)
         NGRAPH_OP(PowerStaticNode, ov::intel_cpu)
+        NGRAPH_OP(ScaledDotProductAttentionNode, ov::intel_cpu)
         NGRAPH_OP(SwishNode, ov::intel_cpu)
 #undef NGRAPH_OP
 
@@ -13,6 +13,8 @@
 #include <unordered_map>
 #include <memory>
 #include <utility>
+#include <sstream>
+#include <iomanip>
 
 #include "graph.h"
 #include "graph_dumper.h"
@@ -25,6 +27,8 @@
 #include "nodes/input.h"
 #include <nodes/reorder.h>
 #include "nodes/convert.h"
+#include "nodes/memory.hpp"
+#include "nodes/kv_cache.h"
 
 #include <ie_algorithm.hpp>
 #include <blob_factory.hpp>
@@ -39,6 +43,7 @@
 #include "utils/node_dumper.h"
 #include "utils/ngraph_utils.hpp"
 #include "utils/cpu_utils.hpp"
+#include "utils/numa.h"
 #include "utils/verbose.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
 
@@ -62,10 +67,30 @@ typedef std::vector<edge_cluster_t> edge_clusters_t;
 
 dnnl::engine Graph::eng(dnnl::engine::kind::cpu, 0);
 
+namespace {
+// "[ipc=1.52 llc_mpki=3.10 dram_gbps=12.40 dram_bytes_per_instr=0.21]" of the average node execution
+std::string formatHwPerfCounters(const PerfCount& perfCount) {
+    // the DRAM traffic is estimated by the last level cache misses
+    constexpr double cacheLineSize = 64.0;
+    const auto values = perfCount.hwAvg();
+    const double instructions = static_cast<double>(values.instructions);
+    const double dramBytes = cacheLineSize * values.llcMisses;
+    const double seconds = perfCount.avg() * 1e-6;
+
+    std::ostringstream result;
+    result << std::fixed << std::setprecision(2) << "[ipc=" << (values.cycles ? instructions / values.cycles : 0.0)
+           << " llc_mpki=" << (values.instructions ? 1000.0 * values.llcMisses / instructions : 0.0)
+           << " dram_gbps=" << (seconds > 0 ? dramBytes / seconds * 1e-9 : 0.0)
+           << " dram_bytes_per_instr=" << (values.instructions ? dramBytes / instructions : 0.0) << "]";
+    return result.str();
+}
+}   // namespace
+
 template<typename NET>
 void Graph::CreateGraph(NET &net, const ExtensionManager::Ptr& extMgr,
         WeightsSharing::Ptr &w_cache) {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "CreateGraph");
+    Timeline::Scope scope(timeline, "Graph", "CreateGraph");
 
     if (IsReady())
         ForgetGraphData();
@@ -74,7 +99,10 @@ void Graph::CreateGraph(NET &net, const ExtensionManager::Ptr& extMgr,
 
     rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
 
-    Replicate(net, extMgr);
+    {
+        Timeline::Scope scope(timeline, "Graph", "Replicate");
+        Replicate(net, extMgr);
+    }
     InitGraph();
 
     status = Ready;
@@ -380,7 +408,10 @@ void Graph::InitGraph() {
     SortTopologically();
     InitNodes();
 
-    optimizer.ApplyCommonGraphOptimizations(*this);
+    {
+        Timeline::Scope scope(timeline, "Graph", "ApplyCommonGraphOptimizations");
+        optimizer.ApplyCommonGraphOptimizations(*this);
+    }
     SortTopologically();
 
     InitDescriptors();
@@ -389,7 +420,10 @@ void Graph::InitGraph() {
 
     InitEdges();
 
-    optimizer.ApplyImplSpecificGraphOptimizations(*this);
+    {
+        Timeline::Scope scope(timeline, "Graph", "ApplyImplSpecificGraphOptimizations");
+        optimizer.ApplyImplSpecificGraphOptimizations(*this);
+    }
     SortTopologically();
 
     Allocate();
@@ -408,6 +442,7 @@ void Graph::InitGraph() {
 
 void Graph::InitNodes() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::InitNodes");
+    Timeline::Scope scope(timeline, "Graph", "InitNodes");
     for (auto &node : graphNodes) {
         node->init();
     }
@@ -415,6 +450,7 @@ void Graph::InitNodes() {
 
 void Graph::InitDescriptors() {
     OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::intel_cpu_LT, "InitDescriptors", "Prepare");
+    Timeline::Scope scope(timeline, "Graph", "InitDescriptors");
 
     for (auto &node : graphNodes) {
         if (node->getType() == Type::Input && _normalizePreprocMap.find(node->getName()) != _normalizePreprocMap.end()) {
@@ -440,6 +476,7 @@ void Graph::InitDescriptors() {
 
 void Graph::InitOptimalPrimitiveDescriptors() {
     OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, "Graph::InitOptimalPrimitiveDescriptors");
+    Timeline::Scope scope(timeline, "Graph", "InitOptimalPrimitiveDescriptors");
     for (auto &node : graphNodes) {
         OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, node->profiling.initOptimalPrimitiveDescriptor);
         node->initOptimalPrimitiveDescriptor();
@@ -448,6 +485,7 @@ void Graph::InitOptimalPrimitiveDescriptors() {
 
 void Graph::ExtractConstantAndExecutableNodes() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::ExtractConstantAndExecutableNodes");
+    Timeline::Scope scope(timeline, "Graph", "ExtractConstantAndExecutableNodes");
     for (const auto& graphNode : graphNodes) {
         if (graphNode->isConstant()) {
             constantGraphNodes.emplace_back(graphNode);
@@ -464,6 +502,7 @@ void Graph::ExtractConstantAndExecutableNodes() {
 
 void Graph::ExecuteConstantNodesOnly() const {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::ExecuteConstantNodesOnly");
+    Timeline::Scope scope(timeline, "Graph", "ExecuteConstantNodesOnly");
     dnnl::stream stream(eng);
 
     using shared_memory_ptr = WeightsSharing::SharedMemory::Ptr;
@@ -477,7 +516,7 @@ void Graph::ExecuteConstantNodesOnly() const {
             auto edgePtr = node->getChildEdgeAt(i);
             if (edgePtr) {
                 if (edgePtr->isUseExternalMemory()) {
-                    auto ptr = weightsCache->get(edgePtr->name());
+                    auto ptr = edgePtr->getExternalMemory();
                     outputs.emplace_back(ptr);
                     if (!ptr->isValid())
                         hasExternalInvalidEdges = true;
@@ -527,6 +566,7 @@ static bool isReorderAvailable(const MemoryDescPtr& parentDesc, const MemoryDesc
 
 void Graph::InitEdges() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::InitEdges");
+    Timeline::Scope scope(timeline, "Graph", "InitEdges");
 
     size_t numberOfEdges = graphEdges.size();
 
@@ -656,11 +696,77 @@ static edge_clusters_t findEdgeClusters(const std::vector<EdgePtr> & graphEdges)
     return edge_clusters;
 }
 
+static std::string getWeightsDescKey(const MemoryDesc& desc) {
+    if (!desc.isDefined() || !(desc.getType() & MemoryDescType::Blocked))
+        return {};
+    // extra data (e.g. int8 compensation) is not described by the blocking
+    if ((desc.getType() & MemoryDescType::Dnnl) &&
+        desc.as<DnnlMemoryDesc>()->getDnnlDesc().data.extra.flags != dnnl_memory_extra_flag_none)
+        return {};
+
+    const auto& blocked = *desc.as<BlockedMemoryDesc>();
+    std::ostringstream key;
+    key << desc.getPrecision().name()
+        << vec2str(blocked.getBlockDims()) << vec2str(blocked.getOrder()) << vec2str(blocked.getStrides())
+        << vec2str(blocked.getOffsetPaddingToData()) << blocked.getOffsetPadding();
+    return key.str();
+}
+
+/**
+ * Key of the constant edge data in the process weights store. The data produced by reorders of a Constant is defined by
+ * the Constant data and the memory descriptors only, so equal constants packed to the same layout by different
+ * compiled models get the same key. Returns an empty string if the data depends on other nodes or differ from the data
+ * shared with the same key.
+ */
+std::string Graph::getProcessWeightsKey(const EdgePtr& edge) const {
+    const auto parent = edge->getParent();
+    if (!parent->isConstant())
+        return {};
+
+    if (parent->getType() == Type::Input) {
+        auto constNode = std::static_pointer_cast<node::Input>(parent);
+        const auto memory = constNode->getMemoryPtr();
+        const auto descKey = memory ? getWeightsDescKey(memory->getDesc()) : std::string{};
+        if (descKey.empty())
+            return {};
+        const auto size = memory->GetSize();
+        char ptr[32];
+        snprintf(ptr, sizeof ptr, "%p", memory->GetPtr());
+        const auto hash = weightsCache->getDataHash(parent->getName() + "_" + ptr, memory->GetPtr(), size);
+        // the hash may collide, so the data are compared with the ones already shared with the same key
+        return weightsCache->getProcessWeights()->getSourceKey(
+            "const_" + std::to_string(size) + "_" + std::to_string(hash) + "_" + descKey, memory);
+    }
+
+    if (parent->getType() == Type::Reorder && parent->getParentEdges().size() == 1) {
+        auto reorder = std::static_pointer_cast<node::Reorder>(parent);
+        const auto srcKey = getProcessWeightsKey(parent->getParentEdgeAt(0));
+        const auto inputKey = getWeightsDescKey(reorder->getInput());
+        const auto outputKey = getWeightsDescKey(reorder->getOutput());
+        if (srcKey.empty() || inputKey.empty() || outputKey.empty())
+            return {};
+        return srcKey + "|" + inputKey + ">" + outputKey;
+    }
+
+    return {};
+}
+
+void Graph::bindToNumaNode(const MemoryPtr& memory, size_t& boundSize) const {
+    if (numaPlacement.numaNodeId < 0 || !memory || !memory->isAllocated())
+        return;
+    boundSize += intel_cpu::bindToNumaNode(memory->GetData(), memory->GetSize(), numaPlacement.numaNodeId);
+}
+
 void Graph::AllocateWithReuse() {
     edge_clusters_t edge_clusters = findEdgeClusters(graphEdges);
 
     size_t edge_clusters_count = edge_clusters.size();
 
+    // the weights are replicated per NUMA node by the weights caches, every copy is bound to its node
+    numaPlacement.weightsSize = 0;
+    numaPlacement.activationsSize = 0;
+    std::unordered_set<void*> boundConstants;
+
     for (size_t i = 0; i < edge_clusters_count;) {
         auto &cluster = edge_clusters[i];
         bool erase = false;
@@ -671,8 +777,17 @@ void Graph::AllocateWithReuse() {
                     auto constNode = std::static_pointer_cast<node::Input>(edge->getParent());
                     edge->reuse(std::const_pointer_cast<Memory>(constNode->getMemoryPtr()));
                 } else {
-                    edge->externalAllocate(weightsCache);
+                    // packed weights are shared by all the compiled models of the process if possible
+                    const auto processWeights = weightsCache ? weightsCache->getProcessWeights() : nullptr;
+                    const auto key = processWeights ? getProcessWeightsKey(edge) : std::string{};
+                    if (!key.empty())
+                        edge->externalAllocate(processWeights, key, memoryAllocator);
+                    else
+                        edge->externalAllocate(weightsCache, {}, memoryAllocator);
                 }
+                const auto& memory = edge->getMemoryPtr();
+                if (memory && memory->isAllocated() && boundConstants.insert(memory->GetData()).second)
+                    bindToNumaNode(memory, numaPlacement.weightsSize);
                 erase = true;
             }
         }
@@ -733,8 +848,9 @@ void Graph::AllocateWithReuse() {
     MemorySolver memSolver(boxes);
     size_t total_size = static_cast<size_t>(memSolver.solve()) * alignment;
 
-    memWorkspace = std::make_shared<Memory>(eng);
+    memWorkspace = std::make_shared<Memory>(eng, memoryAllocator);
     memWorkspace->Create(DnnlBlockedMemoryDesc(InferenceEngine::Precision::I8, Shape(InferenceEngine::SizeVector{total_size})));
+    bindToNumaNode(memWorkspace, numaPlacement.activationsSize);
 
     if (edge_clusters.empty())
         return;
@@ -765,6 +881,7 @@ void Graph::AllocateWithReuse() {
 
 void Graph::Allocate() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::Allocate");
+    Timeline::Scope scope(timeline, "Graph", "Allocate");
 
     // resolve edges. Define which will be a view on others
     //   NeedAllocation - real blob
@@ -775,7 +892,8 @@ void Graph::Allocate() {
     AllocateWithReuse();
 
     // Create dummy memory with undefined desc for edges that are need allocation but has not been allocated withing mem solver
-    for (auto& edge : graphEdges) edge->allocate();
+    // the memory of the dynamic shapes is reallocated on inference by the same allocator
+    for (auto& edge : graphEdges) edge->allocate(nullptr, memoryAllocator);
 
     // Resolve all other edges with status NotAllocated and in-place
     for (auto& node : graphNodes) node->resolveInPlaceEdges();
@@ -786,8 +904,10 @@ void Graph::Allocate() {
 
 void Graph::CreatePrimitives() {
     OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, "Graph::CreatePrimitives");
+    Timeline::Scope scope(timeline, "Graph", "CreatePrimitives");
     for (auto& node : graphNodes) {
         OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, node->profiling.createPrimitive);
+        Timeline::Scope nodeScope(timeline, "CreatePrimitive", node->getName());
         node->createPrimitive();
     }
 }
@@ -840,6 +960,13 @@ void Graph::PushInputData(const std::string& name, const InferenceEngine::Blob::
     }
 }
 
+NormalizePreprocess Graph::getNormalizePreprocess(const std::string& name) const {
+    auto normalize = _normalizePreprocMap.find(name);
+    if (normalize == _normalizePreprocMap.end())
+        IE_THROW() << "Input '" << name << "' doesn't have mean image or values";
+    return normalize->second;
+}
+
 void Graph::PullOutputData(BlobMap &out) {
     if (!IsReady())
         IE_THROW() << "Wrong state. Topology not ready.";
@@ -953,23 +1080,96 @@ inline void Graph::ExecuteNode(const NodePtr& node, const dnnl::stream& stream)
     }
 }
 
-void Graph::Infer(InferRequestBase* request) {
+void Graph::Infer(InferRequestBase* request, bool recordTimeline) {
     if (!IsReady()) {
         IE_THROW() << "Wrong state. Topology is not ready.";
     }
 
     dnnl::stream stream(eng);
 
-    for (const auto& node : executableGraphNodes) {
-        VERBOSE(node, config.verbose);
-        PERF(node, config.collectPerfCounters);
+    if (config.collectHwPerfCounters && !hwPerfCounters)
+        hwPerfCounters = std::make_shared<HwPerfCounters>();
+
+    // null after the first inference, so the following ones only check the pointer
+    const Timeline::Ptr inferTimeline = recordTimeline ? timeline : nullptr;
+    {
+        Timeline::Scope scope(inferTimeline, "FirstInference", "Infer");
+        for (const auto& node : executableGraphNodes) {
+            VERBOSE(node, config.verbose);
+            PERF(node, config.collectPerfCounters, hwPerfCounters.get());
 
-        if (request)
-            request->ThrowIfCanceled();
-        ExecuteNode(node, stream);
+            if (request)
+                request->ThrowIfCanceled();
+            Timeline::Scope nodeScope(inferTimeline, "FirstInference", node->getName());
+            ExecuteNode(node, stream);
+        }
     }
 
     if (infer_count != -1) infer_count++;
+    // Only the first inference is recorded, so the following ones are not affected by the timeline.
+    if (inferTimeline)
+        timeline.reset();
+}
+
+void Graph::WarmUp(const std::map<std::string, VectorDims>& shapes) {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::WarmUp");
+    if (!IsReady()) {
+        IE_THROW() << "Wrong state. Topology is not ready.";
+    }
+
+    for (const auto& shape : shapes) {
+        if (!shape.first.empty() && !inputNodesMap.count(shape.first))
+            IE_THROW() << "Warm-up shapes contain unknown input " << shape.first;
+        if (shape.first.empty() && inputNodesMap.size() != 1)
+            IE_THROW() << "Warm-up shape without an input name is allowed only for models with a single input";
+    }
+
+    for (const auto& input : inputNodesMap) {
+        const auto& node = input.second;
+        auto shapeIt = shapes.find(input.first);
+        if (shapeIt == shapes.end())
+            shapeIt = shapes.find("");
+
+        if (shapeIt != shapes.end()) {
+            const auto& dims = shapeIt->second;
+            if (!node->getOutputShapeAtPort(0).isCompatible(dims))
+                IE_THROW() << "Warm-up shape " << vec2str(dims) << " is not compatible with input " << input.first
+                           << " shape " << node->getOutputShapeAtPort(0).toString();
+            if (node->isDynamicNode())
+                node->redefineOutputMemory({dims});
+        } else if (node->isDynamicNode()) {
+            IE_THROW() << "Warm-up shape is not specified for dynamic input " << input.first;
+        }
+
+        for (size_t i = 0; i < node->getChildEdges().size(); i++)
+            node->getChildEdgeAt(i)->getMemoryPtr()->FillZero();
+    }
+
+    // The infer requests copy the initial values of the states from the stores of the MemoryInput nodes, so the stores
+    // are restored after the warm-up. KVCache appends the warm-up values to its own empty state.
+    std::vector<std::pair<MemoryPtr, std::vector<uint8_t>>> stores;
+    for (const auto& node : graphNodes) {
+        if (node->getType() == Type::MemoryInput) {
+            auto memoryNode = dynamic_cast<node::MemoryInput*>(node.get());
+            if (!memoryNode)
+                IE_THROW() << "Cannot cast " << node->getName() << " to MemoryInput";
+            const auto store = memoryNode->getStore();
+            const auto data = static_cast<const uint8_t*>(store->GetPtr());
+            if (data)
+                stores.emplace_back(store, std::vector<uint8_t>(data, data + store->GetSize()));
+        } else if (node->getType() == Type::KVCache) {
+            auto kvCacheNode = dynamic_cast<node::KVCache*>(node.get());
+            if (!kvCacheNode)
+                IE_THROW() << "Cannot cast " << node->getName() << " to KVCache";
+            kvCacheNode->bindState(kvCacheNode->makeState());
+        }
+    }
+
+    // the warm-up is a part of the compilation, so it is not recorded as the first inference
+    Infer(nullptr, false);
+
+    for (const auto& store : stores)
+        cpu_memcpy(store.first->GetPtr(), store.second.data(), store.second.size());
 }
 
 void Graph::VisitNode(NodePtr node, std::vector<NodePtr>& sortedNodes) {
@@ -1069,6 +1269,8 @@ void Graph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEnginePr
         pc.status = pc.cpu_uSec > 0 ? InferenceEngine::InferenceEngineProfileInfo::EXECUTED
                                     : InferenceEngine::InferenceEngineProfileInfo::NOT_RUN;
         std::string pdType = node->getPrimitiveDescriptorType();
+        if (node->PerfCounter().hasHwValues())
+            pdType += " " + formatHwPerfCounters(node->PerfCounter());
         size_t typeLen = sizeof(pc.exec_type) / sizeof(pc.exec_type[0]);
         pdType.copy(pc.exec_type, typeLen, 0);
         size_t layerTypeLen = sizeof(pc.layer_type) / sizeof(pc.layer_type[0]);
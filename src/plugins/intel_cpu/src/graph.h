@@ -11,6 +11,8 @@
 #include "node.h"
 #include "edge.h"
 #include "cache/multi_cache.h"
+#include "utils/hw_perf_counters.h"
+#include "utils/timeline.h"
 #include <map>
 #include <string>
 #include <vector>
@@ -49,6 +51,36 @@ public:
     void setProperty(const std::map<std::string, std::string> &properties);
     Config getProperty() const;
 
+    // The timeline records the graph creation and the first inference, it is released after the first inference.
+    void setTimeline(const Timeline::Ptr& timeline) {
+        this->timeline = timeline;
+    }
+
+    /**
+     * @brief Placement of the graph memory on the NUMA node of the graph stream.
+     * The sizes are the bytes of the constant data (weights) and the activations workspace bound to the node.
+     */
+    struct NumaPlacement {
+        int numaNodeId = -1;  // -1 if the placement is left to the OS
+        size_t weightsSize = 0;
+        size_t activationsSize = 0;
+    };
+
+    // The constant data and the activations workspace are bound to the NUMA node, should be set before the creation.
+    void setNumaNodeId(int numaNodeId) {
+        numaPlacement = NumaPlacement{};
+        numaPlacement.numaNodeId = numaNodeId;
+    }
+
+    const NumaPlacement& getNumaPlacement() const {
+        return numaPlacement;
+    }
+
+    // The allocator of the graph memory (e.g. huge pages), used whether the weights are cached or not.
+    void setMemoryAllocator(const MemoryAllocatorPtr& allocator) {
+        memoryAllocator = allocator;
+    }
+
     template<typename NET>
     void CreateGraph(NET &network,
                      const ExtensionManager::Ptr& extMgr,
@@ -59,14 +91,25 @@ public:
                      WeightsSharing::Ptr &w_cache,
                      std::string name);
 
-    bool hasMeanImageFor(const std::string& name) {
+    bool hasMeanImageFor(const std::string& name) const {
         return _normalizePreprocMap.find(name) != _normalizePreprocMap.end();
     }
 
     void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in);
+    // copy of the mean image or values of the input (see hasMeanImageFor) to normalize the input data without the graph
+    NormalizePreprocess getNormalizePreprocess(const std::string& name) const;
     void PullOutputData(InferenceEngine::BlobMap &out);
 
-    void Infer(InferRequestBase* request = nullptr);
+    void Infer(InferRequestBase* request = nullptr, bool recordTimeline = true);
+
+    /**
+     * @brief Runs the graph once on zero filled inputs of the given shapes, so the primitives and JIT kernels for
+     * these shapes are created and stored in the runtime cache before the first user inference.
+     * @param shapes
+     * input shapes by input name; an empty name stands for the only graph input.
+     * Every dynamic input must have a shape, static inputs may be omitted.
+     */
+    void WarmUp(const std::map<std::string, VectorDims>& shapes);
 
     const std::vector<NodePtr>& GetNodes() const {
         return graphNodes;
@@ -237,6 +280,8 @@ protected:
     void InitEdges();
     void Allocate();
     void AllocateWithReuse();
+    std::string getProcessWeightsKey(const EdgePtr& edge) const;
+    void bindToNumaNode(const MemoryPtr& memory, size_t& boundSize) const;
     void CreatePrimitives();
     void ExtractConstantAndExecutableNodes();
     void ExecuteNode(const NodePtr& node, const dnnl::stream& stream) const;
@@ -260,6 +305,13 @@ private:
 
     MultiCachePtr rtParamsCache;
 
+    Timeline::Ptr timeline;
+    // opened on the first inference in the arena of the stream the graph is executed in
+    HwPerfCounters::Ptr hwPerfCounters;
+
+    NumaPlacement numaPlacement;
+    MemoryAllocatorPtr memoryAllocator;
+
     void EnforceBF16();
 };
 
@@ -17,6 +17,7 @@
 #include "nodes/common/cpu_convert.h"
 #include "memory_state.h"
 #include "nodes/memory.hpp"
+#include "nodes/kv_cache.h"
 #include "nodes/common/cpu_memcpy.h"
 #include "async_infer_request.h"
 #include <debug.h>
@@ -25,6 +26,7 @@
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include <transformations/utils/utils.hpp>
 #include <ie_ngraph_utils.hpp>
+#include <chrono>
 
 namespace ov {
 namespace intel_cpu {
@@ -39,6 +41,21 @@ void InferRequestBase::CreateInferRequest() {
 
     initBlobs();
 
+    // the preprocessing stage runs in the threads of its own executor, so it uses this snapshot instead of the graphs
+    // of the stream executor
+    if (GetPreprocessExecutor() && graph->IsReady() && !graph->hasDynamicInput() && graph->getConfig().batchLimit == 0) {
+        preprocessEngine = graph->getEngine();
+        for (const auto& inputNode : graph->GetInputNodesMap()) {
+            const auto& inputName = inputNode.first;
+            PreprocessInputInfo info;
+            info.dstDesc = inputNode.second->getChildEdgeAt(0)->getMemory().getDesc().clone();
+            info.shape = inputNode.second->getOutputShapeAtPort(0);
+            if (graph->hasMeanImageFor(inputName))
+                info.normalize = std::make_shared<NormalizePreprocess>(graph->getNormalizePreprocess(inputName));
+            preprocessInputsInfo.emplace(inputName, std::move(info));
+        }
+    }
+
     // Save all MemoryLayer data tensors. Will use insight about mechanics
     // of MemoryLayer implementation. It uses output edge of MemoryLayer
     // producer as storage for tensor to keep it between infer calls.
@@ -57,6 +74,12 @@ void InferRequestBase::CreateInferRequest() {
                 state_name = state_name.substr(0, suffix_idx);
 
             memoryStates.emplace_back(new VariableState(state_name, state_store));
+        } else if (node->getType() == Type::KVCache) {
+            auto kvCacheNode = dynamic_cast<node::KVCache*>(node.get());
+            if (!kvCacheNode) {
+                IE_THROW() << "Cannot cast " << node->getName() << " to KVCache";
+            }
+            memoryStates.emplace_back(kvCacheNode->makeState());
         }
     }
 }
@@ -66,6 +89,9 @@ InferRequestBase::~InferRequestBase() {
 }
 
 void InferRequestBase::pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision inPrec) {
+    if (usePreprocessedInputs && pushPreprocessedInput(inputName, inputBlob))
+        return;
+
     auto& tensorDesc = inputBlob->getTensorDesc();
     bool needConvert = inPrec != tensorDesc.getPrecision();
 
@@ -110,6 +136,17 @@ void InferRequestBase::PushStates() {
                     cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
                 }
             }
+        } else if (node->getType() == Type::KVCache) {
+            auto cur_node = dynamic_cast<node::KVCache*>(node.get());
+            if (!cur_node) {
+                IE_THROW() << "Cannot cast " << node->getName() << " to KVCache";
+            }
+            // the state is bound instead of copied, the node updates it in place
+            for (const auto& state : memoryStates) {
+                if (state->GetName() == cur_node->getVariableId()) {
+                    cur_node->bindState(std::dynamic_pointer_cast<KVCacheState>(state));
+                }
+            }
         }
     }
 }
@@ -158,6 +195,25 @@ void InferRequestBase::InferImpl() {
     ThrowIfCanceled();
     convertBatchedInputBlobs();
 
+    // the hot input shapes are inferred by the static graph once it is created for them
+    std::unique_ptr<ExecNetwork::GraphGuard::Lock> staticGraphLock;
+    // the static graph is used only while it is locked, so the request points to the stream graph again on return
+    struct StreamGraphRestorer {
+        Graph*& graph;
+        Graph* const streamGraph;
+        ~StreamGraphRestorer() {
+            graph = streamGraph;
+        }
+    } streamGraphRestorer{graph, graph};
+    if (graph->hasDynamicInput() && execNetwork->_staticVariantsEnabled) {
+        ExecNetwork::ShapeSignature shapes;
+        for (const auto& input : _inputs)
+            shapes[input.first] = input.second->getTensorDesc().getDims();
+        staticGraphLock = execNetwork->GetStaticVariantGraph(shapes);
+        if (staticGraphLock)
+            graph = &(staticGraphLock->_graph);
+    }
+
     if (graph->hasDynamicInput()) {
         redefineMemoryForInputNodes();
     } else if (graph->getProperty().isNewApi && graph->getProperty().batchLimit > 0) {
@@ -171,13 +227,17 @@ void InferRequestBase::InferImpl() {
 
     ThrowIfCanceled();
 
+    const auto pushStart = std::chrono::steady_clock::now();
     PushInputData();
+    pushInputsTime = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - pushStart).count();
 
     if (memoryStates.size() != 0) {
         PushStates();
     }
 
     graph->Infer(this);
+    inferredGraph = graph;
 
     if (memoryStates.size() != 0) {
         PullStates();
@@ -189,13 +249,130 @@ void InferRequestBase::InferImpl() {
 }
 
 std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> InferRequestBase::GetPerformanceCounts() const {
-    if (!graph || !graph->IsReady())
+    // the counters of the last inference are reported by the graph it ran on, the stream or the static one
+    const Graph* profiledGraph = inferredGraph ? inferredGraph : graph;
+    if (!profiledGraph || !profiledGraph->IsReady())
         IE_THROW() << "Graph is not ready!";
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> perfMap;
-    graph->GetPerfData(perfMap);
+    profiledGraph->GetPerfData(perfMap);
+    if (GetPreprocessExecutor())
+        addPreprocessingPerfCounts(perfMap);
     return perfMap;
 }
 
+void InferRequestBase::addPreprocessingPerfCounts(
+        std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>& perfMap) const {
+    auto addStage = [&perfMap](const std::string& name, const std::string& execType, uint64_t time) {
+        InferenceEngine::InferenceEngineProfileInfo& pc = perfMap[name];
+        pc.execution_index = 0;
+        pc.cpu_uSec = pc.realTime_uSec = static_cast<long long>(time);
+        pc.status = time > 0 ? InferenceEngine::InferenceEngineProfileInfo::EXECUTED
+                             : InferenceEngine::InferenceEngineProfileInfo::NOT_RUN;
+        execType.copy(pc.exec_type, sizeof(pc.exec_type) / sizeof(pc.exec_type[0]), 0);
+        std::string("Preprocessing").copy(pc.layer_type, sizeof(pc.layer_type) / sizeof(pc.layer_type[0]), 0);
+    };
+    // the conversion on the preprocessing executor and the copy of the inputs on the graph stream
+    addStage("InputPreprocessing", "async", preprocessingTime);
+    addStage("InputPush", "stream", pushInputsTime);
+}
+
+InferenceEngine::ITaskExecutor::Ptr InferRequestBase::GetPreprocessExecutor() const {
+    return execNetwork->_preprocessExecutor;
+}
+
+void InferRequestBase::PreprocessInputs() {
+    OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, "InferRequestBase::PreprocessInputs");
+    const auto start = std::chrono::steady_clock::now();
+    ThrowIfCanceled();
+
+    preprocessingTime = 0;
+    for (auto& preprocessed : preprocessedInputs)
+        preprocessed.second.source = nullptr;
+
+    // the inputs processed by the graph stream anyway (dynamic shapes, batched inputs, legacy resize and color
+    // conversion) are not converted here
+    for (const auto& input : _inputs) {
+        const auto& inputName = input.first;
+        const auto& inputBlob = input.second;
+        const auto info = preprocessInputsInfo.find(inputName);
+        if (info == preprocessInputsInfo.end() || _preProcData.count(inputName) || _batched_inputs.count(inputName))
+            continue;
+
+        const auto& tensorDesc = inputBlob->getTensorDesc();
+        const void* srcData = inputBlob->cbuffer().as<const void *>();
+        if (tensorDesc.getLayout() == InferenceEngine::ANY || srcData == nullptr)
+            continue;
+
+        const auto& normalize = info->second.normalize;
+        const auto inPrec = normToInputSupportedPrec(input, normalize != nullptr);
+        if (normalize && inPrec != InferenceEngine::Precision::FP32)
+            continue;
+        const auto& dstDesc = *info->second.dstDesc;
+        // plain copies are cheap, they are done by the graph stream
+        if (!normalize && inPrec == tensorDesc.getPrecision() &&
+            MemoryDescUtils::convertToDnnlBlockedMemoryDesc(tensorDesc).isCompatible(dstDesc))
+            continue;
+
+        auto srcTensorDesc = tensorDesc;
+        if (inPrec != tensorDesc.getPrecision()) {
+            // the buffer is reused by the following inputs and requests, the data is copied to the preprocessed memory
+            conversionBuffer.resize(inputBlob->size() * inPrec.size());
+            cpu_convert(srcData, conversionBuffer.data(), tensorDesc.getPrecision(), inPrec, inputBlob->size());
+            srcData = conversionBuffer.data();
+            srcTensorDesc = InferenceEngine::TensorDesc(inPrec, tensorDesc.getDims(), tensorDesc.getLayout());
+        }
+
+        Memory srcMemory(preprocessEngine);
+        srcMemory.Create(MemoryDescUtils::convertToDnnlBlockedMemoryDesc(srcTensorDesc), srcData, false);
+
+        auto& preprocessed = preprocessedInputs[inputName];
+        if (!preprocessed.memory || !preprocessed.memory->getDesc().isCompatible(dstDesc)) {
+            preprocessed.memory = std::make_shared<Memory>(preprocessEngine);
+            preprocessed.memory->Create(dstDesc);
+        }
+        preprocessed.memory->SetData(srcMemory, false);
+        if (normalize)
+            normalize->NormalizeImage(info->second.shape, static_cast<float*>(preprocessed.memory->GetData()),
+                                      tensorDesc.getLayout());
+        preprocessed.source = inputBlob;
+    }
+
+    preprocessingTime = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count();
+}
+
+void InferRequestBase::InferPreprocessed() {
+    usePreprocessedInputs = true;
+    try {
+        InferImpl();
+    } catch (...) {
+        usePreprocessedInputs = false;
+        throw;
+    }
+    usePreprocessedInputs = false;
+}
+
+bool InferRequestBase::pushPreprocessedInput(const std::string& inputName,
+                                             const InferenceEngine::Blob::Ptr& inputBlob) {
+    auto preprocessed = preprocessedInputs.find(inputName);
+    if (preprocessed == preprocessedInputs.end() || preprocessed->second.source != inputBlob)
+        return false;
+    preprocessed->second.source = nullptr;
+
+    const auto& inputNodes = graph->GetInputNodesMap();
+    const auto inputNode = inputNodes.find(inputName);
+    if (inputNode == inputNodes.end())
+        return false;
+
+    // the stream graphs may differ from the graph the input was converted for
+    auto& dstMemory = inputNode->second->getChildEdgeAt(0)->getMemory();
+    if (!preprocessed->second.memory->getDesc().isCompatible(dstMemory.getDesc()))
+        return false;
+
+    dstMemory.SetData(*preprocessed->second.memory, false);
+    return true;
+}
+
 static inline void changeEdgePtr(const EdgePtr &edge, void *newPtr) {
     edge->getMemoryPtr()->setDataHandle(newPtr);
 }
@@ -324,10 +501,11 @@ void InferRequestBase::ThrowIfCanceled() const {
 }
 
 InferenceEngine::Precision
-InferRequestBase::normToInputSupportedPrec(const std::pair<const std::string, InferenceEngine::Blob::Ptr>& input) const {
+InferRequestBase::normToInputSupportedPrec(const std::pair<const std::string, InferenceEngine::Blob::Ptr>& input,
+                                           bool hasMeanImage) const {
     const auto& inputTensorDesc = input.second->getTensorDesc();
     auto inPrec = inputTensorDesc.getPrecision();
-    if (graph->hasMeanImageFor(input.first) && one_of(inPrec, InferenceEngine::Precision::U8, InferenceEngine::Precision::BOOL)) {
+    if (hasMeanImage && one_of(inPrec, InferenceEngine::Precision::U8, InferenceEngine::Precision::BOOL)) {
         inPrec = InferenceEngine::Precision::FP32;
     } else {
         inPrec = normalizeToSupportedPrecision(inPrec);
@@ -613,7 +791,7 @@ void LegacyInferRequest::PushInputData() {
             inputBlob->getTensorDesc().setLayout(_networkInputs[inputName]->getLayout());
         }
 
-        pushInput(inputName, inputBlob, normToInputSupportedPrec(input));
+        pushInput(inputName, inputBlob, normToInputSupportedPrec(input, graph->hasMeanImageFor(inputName)));
     }
 }
 
@@ -880,7 +1058,7 @@ void InferRequest::PushInputData() {
             IE_THROW() << "Input blobs map contains not registered during IInferencePlugin::LoadNetwork blob with name " << inputName;
         }
 
-        pushInput(inputName, input.second, normToInputSupportedPrec(input));
+        pushInput(inputName, input.second, normToInputSupportedPrec(input, graph->hasMeanImageFor(inputName)));
     }
 }
 
@@ -8,6 +8,7 @@
 #include <memory>
 #include <string>
 #include <map>
+#include <unordered_map>
 #include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
 
 namespace ov {
@@ -37,6 +38,23 @@ public:
      */
     void ThrowIfCanceled() const;
 
+    /**
+     * @brief Returns the executor of the asynchronous input preprocessing stage, nullptr if the stage is disabled
+     */
+    InferenceEngine::ITaskExecutor::Ptr GetPreprocessExecutor() const;
+
+    /**
+     * @brief Converts the inputs to the precision and layout of the graph inputs outside of the graph stream.
+     * The first stage of the asynchronous pipeline, so the inputs of the request are converted while the stream
+     * executes the graph for another request. The converted inputs are used by the following InferPreprocessed call.
+     */
+    void PreprocessInputs();
+
+    /**
+     * @brief Runs the inference on the inputs converted by PreprocessInputs
+     */
+    void InferPreprocessed();
+
 protected:
     InferRequestBase(InferenceEngine::InputsDataMap networkInputs,
                      InferenceEngine::OutputsDataMap networkOutputs,
@@ -49,13 +67,15 @@ protected:
     : IInferRequestInternal(inputs, outputs), execNetwork(execNetwork_) {}
 
     void CreateInferRequest();
-    InferenceEngine::Precision normToInputSupportedPrec(const std::pair<const std::string, InferenceEngine::Blob::Ptr>& input) const;
+    InferenceEngine::Precision normToInputSupportedPrec(const std::pair<const std::string, InferenceEngine::Blob::Ptr>& input,
+                                                        bool hasMeanImage) const;
     void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision dataType);
 
     virtual void initBlobs() = 0;
     virtual void PushInputData() = 0;
 
     Graph* graph = nullptr;
+    Graph* inferredGraph = nullptr;  // the graph of the last inference, it is not restored to the stream graph
     std::unordered_map<std::string, void*> externalPtr;
 
 private:
@@ -64,6 +84,27 @@ private:
     void redefineMemoryForInputNodes();
 
     void changeDefaultPtr();
+    bool pushPreprocessedInput(const std::string& inputName, const InferenceEngine::Blob::Ptr& inputBlob);
+    void addPreprocessingPerfCounts(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>& perfMap) const;
+
+    struct PreprocessedInput {
+        InferenceEngine::Blob::Ptr source;  // the input blob the memory is converted from, nullptr if not converted
+        MemoryPtr memory;                   // the input data in the precision and layout of the graph input
+    };
+    std::unordered_map<std::string, PreprocessedInput> preprocessedInputs;
+    // the graph inputs read on the request creation, empty if the inputs are not preprocessed asynchronously
+    struct PreprocessInputInfo {
+        MemoryDescPtr dstDesc;                          // the desc of the graph input memory
+        Shape shape;
+        std::shared_ptr<NormalizePreprocess> normalize; // mean image or values of the input, nullptr if not set
+    };
+    std::unordered_map<std::string, PreprocessInputInfo> preprocessInputsInfo;
+    dnnl::engine preprocessEngine;
+    std::vector<uint8_t> conversionBuffer;  // the inputs converted to the graph input precision
+    bool usePreprocessedInputs = false;
+    uint64_t preprocessingTime = 0;  // microseconds
+    uint64_t pushInputsTime = 0;     // microseconds
+
     std::shared_ptr<ExecNetwork>        execNetwork;
     openvino::itt::handle_t             profilingTask;
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> memoryStates;
@@ -5,6 +5,9 @@
 #include "memory_state.h"
 #include "dnnl_extension_utils.h"
 #include "blob_factory.hpp"
+#include "ie_parallel.hpp"
+
+#include <numeric>
 
 using namespace InferenceEngine;
 
@@ -15,6 +18,80 @@ void VariableState::Reset() {
     std::memset(state->buffer(), 0, state->byteSize());
 }
 
+namespace {
+DnnlMemoryMngrPtr makeStorage() {
+    return std::make_shared<DnnlMemoryMngr>(std::unique_ptr<IMemoryMngr>(new MemoryMngrWithReuse()));
+}
+
+// copies the slices of the dimensions before the axis between the buffers with the lengths of the slices along the axis
+void copySlices(const uint8_t* src, size_t srcLength, uint8_t* dst, size_t dstLength, const VectorDims& dims, size_t axis,
+                size_t dataSize) {
+    const auto slices = std::accumulate(dims.begin(), dims.begin() + axis, size_t{1}, std::multiplies<size_t>());
+    const auto rowSize = std::accumulate(dims.begin() + axis + 1, dims.end(), dataSize, std::multiplies<size_t>());
+    const auto sliceSize = dims[axis] * rowSize;
+    if (sliceSize == 0)
+        return;
+    parallel_for(slices, [&](size_t i) {
+        cpu_memcpy(dst + i * dstLength * rowSize, src + i * srcLength * rowSize, sliceSize);
+    });
+}
+}   // namespace
+
+KVCacheState::KVCacheState(std::string name, Precision precision, VectorDims dims, size_t axis)
+    : IVariableStateInternal{name}, precision(precision), dims(std::move(dims)), axis(axis), storage(makeStorage()) {}
+
+void KVCacheState::Reset() {
+    dims[axis] = 0;
+}
+
+VectorDims KVCacheState::getStrides() const {
+    VectorDims strides(dims.size(), 1);
+    for (size_t i = dims.size() - 1; i > 0; i--)
+        strides[i - 1] = strides[i] * (i == axis ? capacity : dims[i]);
+    return strides;
+}
+
+void KVCacheState::reserve(const VectorDims& newDims) {
+    bool sameSlices = newDims.size() == dims.size();
+    for (size_t i = 0; sameSlices && i < dims.size(); i++)
+        sameSlices = i == axis || newDims[i] == dims[i];
+    if (sameSlices && newDims[axis] <= capacity)
+        return;
+
+    // the headroom is doubled, so the stored values are moved a logarithmic number of times while the cache grows
+    const size_t newCapacity = sameSlices ? std::max(newDims[axis], capacity * 2) : newDims[axis];
+    auto layout = newDims;
+    layout[axis] = newCapacity;
+    auto newStorage = makeStorage();
+    newStorage->resize(std::accumulate(layout.begin(), layout.end(), precision.size(), std::multiplies<size_t>()));
+    if (sameSlices) {
+        copySlices(static_cast<const uint8_t*>(storage->getRawPtr()), capacity, static_cast<uint8_t*>(newStorage->getRawPtr()),
+                   newCapacity, dims, axis, precision.size());
+    }
+    storage = newStorage;
+    capacity = newCapacity;
+}
+
+void KVCacheState::SetState(const Blob::Ptr& newState) {
+    const auto& desc = newState->getTensorDesc();
+    const auto& newDims = desc.getDims();
+    if (desc.getPrecision() != precision || newDims.size() != dims.size())
+        IE_THROW() << "State " << name << " expects " << precision.name() << " tensor of rank " << dims.size();
+
+    dims[axis] = 0;
+    reserve(newDims);
+    copySlices(newState->cbuffer().as<const uint8_t*>(), newDims[axis], static_cast<uint8_t*>(storage->getRawPtr()), capacity,
+               newDims, axis, precision.size());
+    dims = newDims;
+}
+
+Blob::CPtr KVCacheState::GetState() const {
+    auto blob = make_blob_with_precision(TensorDesc(precision, dims, TensorDesc::getLayoutByDims(dims)));
+    blob->allocate();
+    copySlices(static_cast<const uint8_t*>(storage->getRawPtr()), capacity, blob->buffer().as<uint8_t*>(), dims[axis], dims, axis,
+               precision.size());
+    return blob;
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
-
@@ -27,5 +27,52 @@ public:
     void Reset() override;
 };
 
+/**
+ * @brief The state of the KVCache node in the layout of the variable. Every slice of the dimensions before the axis
+ * keeps a headroom after its stored values, so the appended values are written in place and the stored ones are moved
+ * only when the headroom is exhausted. The state is bound to the node for the inference of its request.
+ */
+class KVCacheState : public InferenceEngine::IVariableStateInternal {
+public:
+    KVCacheState(std::string name, InferenceEngine::Precision precision, VectorDims dims, size_t axis);
+
+    void Reset() override;
+    void SetState(const InferenceEngine::Blob::Ptr& newState) override;
+    InferenceEngine::Blob::CPtr GetState() const override;
+
+    DnnlMemoryMngrPtr getStorage() const {
+        return storage;
+    }
+
+    // the dimensions of the stored values, the stored length is dims[axis]
+    const VectorDims& getDims() const {
+        return dims;
+    }
+
+    void setDims(const VectorDims& newDims) {
+        dims = newDims;
+    }
+
+    size_t getCapacity() const {
+        return capacity;
+    }
+
+    // the strides of the stored values, the stride of the dimension before the axis counts the headroom
+    VectorDims getStrides() const;
+
+    /**
+     * @brief Makes the storage fit the values of the dimensions, the stored values are kept if the other dimensions
+     * are the same. The storage is replaced if it grows, so the pointer of the storage must be read again.
+     */
+    void reserve(const VectorDims& newDims);
+
+private:
+    InferenceEngine::Precision precision;
+    VectorDims dims;
+    size_t axis;
+    size_t capacity = 0;  // the length of every slice of the storage along the axis
+    DnnlMemoryMngrPtr storage;
+};
+
 }   // namespace intel_cpu
 }   // namespace ov
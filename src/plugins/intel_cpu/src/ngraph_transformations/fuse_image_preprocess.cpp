@@ -0,0 +1,300 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fuse_image_preprocess.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset4.hpp>
+#include <ngraph/opsets/opset8.hpp>
+#include <ngraph/op/util/op_types.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/validation_util.hpp>
+#include <openvino/op/util/gather_base.hpp>
+#include <utils/general_utils.h>
+
+#include "op/image_preprocess.hpp"
+#include "itt.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+using ColorConversion = ImagePreprocessNode::ColorConversion;
+
+struct PreprocessChain {
+    ngraph::NodeVector nodes;
+    ngraph::element::Type type;
+    ColorConversion color = ColorConversion::NONE;
+    bool colorRounding = false;
+    bool colorAllowed = true;   // color conversion may be preceded only by Convert
+    bool layoutKnown = false;
+    bool planarInput = false;
+    bool planar = false;
+    std::vector<int64_t> outputSize;
+    std::vector<int64_t> channelMap;
+    std::vector<float> scale;
+    std::vector<float> shift;
+
+    void initChannels(size_t channels) {
+        layoutKnown = true;
+        channelMap.resize(channels);
+        std::iota(channelMap.begin(), channelMap.end(), 0);
+        scale.assign(channels, 1.f);
+        shift.assign(channels, 0.f);
+    }
+
+    size_t channelAxis() const {
+        return planar ? 1 : 3;
+    }
+};
+
+// the constant subgraphs (e.g. Range of the reversed channels) are not folded yet at this point
+std::shared_ptr<ngraph::opset1::Constant> getConstant(const ngraph::Output<ngraph::Node>& output) {
+    return ngraph::get_constant_from_source(output);
+}
+
+bool matchColorConversion(const std::shared_ptr<ngraph::Node>& node, PreprocessChain& chain) {
+    if (!chain.colorAllowed || node->get_input_size() != 1)
+        return false;
+    if (ngraph::is_type<ngraph::opset8::NV12toRGB>(node)) {
+        chain.color = ColorConversion::NV12_TO_RGB;
+    } else if (ngraph::is_type<ngraph::opset8::NV12toBGR>(node)) {
+        chain.color = ColorConversion::NV12_TO_BGR;
+    } else if (ngraph::is_type<ngraph::opset8::I420toRGB>(node)) {
+        chain.color = ColorConversion::I420_TO_RGB;
+    } else if (ngraph::is_type<ngraph::opset8::I420toBGR>(node)) {
+        chain.color = ColorConversion::I420_TO_BGR;
+    } else {
+        return false;
+    }
+    if (!one_of(chain.type, ngraph::element::u8, ngraph::element::f32) || (chain.layoutKnown && chain.planarInput))
+        return false;
+
+    chain.colorRounding = chain.type == ngraph::element::u8;
+    chain.colorAllowed = false;
+    chain.planarInput = chain.planar = false;
+    chain.initChannels(3);
+    return true;
+}
+
+bool matchConvert(const std::shared_ptr<ngraph::Node>& node, PreprocessChain& chain) {
+    if (!ngraph::is_type<ngraph::opset1::Convert>(node) || node->get_output_element_type(0) != ngraph::element::f32 ||
+        !one_of(chain.type, ngraph::element::u8, ngraph::element::f32))
+        return false;
+    chain.type = ngraph::element::f32;
+    return true;
+}
+
+bool matchResize(const std::shared_ptr<ngraph::Node>& node, PreprocessChain& chain) {
+    const auto interpolate = std::dynamic_pointer_cast<ngraph::opset4::Interpolate>(node);
+    if (!interpolate || !chain.layoutKnown || !chain.outputSize.empty() || chain.type != ngraph::element::f32 ||
+        interpolate->get_input_size() != 4)
+        return false;
+
+    using Interpolate = ngraph::opset4::Interpolate;
+    const auto& attrs = interpolate->get_attrs();
+    const auto isZero = [](size_t pad) { return pad == 0; };
+    // clamped bilinear interpolation is equal to both linear modes without antialiasing
+    if (!one_of(attrs.mode, Interpolate::InterpolateMode::LINEAR, Interpolate::InterpolateMode::LINEAR_ONNX) ||
+        attrs.shape_calculation_mode != Interpolate::ShapeCalcMode::SIZES ||
+        attrs.coordinate_transformation_mode != Interpolate::CoordinateTransformMode::HALF_PIXEL ||
+        attrs.antialias ||
+        !std::all_of(attrs.pads_begin.begin(), attrs.pads_begin.end(), isZero) ||
+        !std::all_of(attrs.pads_end.begin(), attrs.pads_end.end(), isZero))
+        return false;
+
+    const auto sizes = getConstant(interpolate->input_value(1));
+    const auto axes = getConstant(interpolate->input_value(3));
+    if (!sizes || !axes)
+        return false;
+    auto axesValues = axes->cast_vector<int64_t>();
+    for (auto& axis : axesValues)
+        axis = axis < 0 ? axis + 4 : axis;
+    const std::vector<int64_t> spatialAxes = chain.planar ? std::vector<int64_t>{2, 3} : std::vector<int64_t>{1, 2};
+    auto sizesValues = sizes->cast_vector<int64_t>();
+    if (axesValues.size() != 2 || sizesValues.size() != 2)
+        return false;
+    if (axesValues == std::vector<int64_t>{spatialAxes[1], spatialAxes[0]}) {
+        std::swap(axesValues[0], axesValues[1]);
+        std::swap(sizesValues[0], sizesValues[1]);
+    }
+    if (axesValues != spatialAxes || sizesValues[0] <= 0 || sizesValues[1] <= 0)
+        return false;
+
+    chain.outputSize = sizesValues;
+    chain.colorAllowed = false;
+    return true;
+}
+
+bool matchChannelMap(const std::shared_ptr<ngraph::Node>& node, PreprocessChain& chain) {
+    const auto gather = std::dynamic_pointer_cast<ov::op::util::GatherBase>(node);
+    if (!gather || !chain.layoutKnown || gather->get_batch_dims() != 0)
+        return false;
+    const auto indices = getConstant(gather->input_value(1));
+    const auto axis = getConstant(gather->input_value(2));
+    if (!indices || !axis || indices->get_shape().size() != 1 || ngraph::shape_size(axis->get_shape()) != 1)
+        return false;
+    auto axisValue = axis->cast_vector<int64_t>()[0];
+    axisValue = axisValue < 0 ? axisValue + 4 : axisValue;
+    if (axisValue != static_cast<int64_t>(chain.channelAxis()))
+        return false;
+
+    const auto channels = static_cast<int64_t>(chain.channelMap.size());
+    std::vector<int64_t> channelMap;
+    std::vector<float> scale, shift;
+    for (auto index : indices->cast_vector<int64_t>()) {
+        index = index < 0 ? index + channels : index;
+        if (index < 0 || index >= channels)
+            return false;
+        channelMap.push_back(chain.channelMap[index]);
+        scale.push_back(chain.scale[index]);
+        shift.push_back(chain.shift[index]);
+    }
+    chain.channelMap = channelMap;
+    chain.scale = scale;
+    chain.shift = shift;
+    chain.colorAllowed = false;
+    return true;
+}
+
+bool matchEltwise(const std::shared_ptr<ngraph::Node>& node, const ngraph::Output<ngraph::Node>& data, PreprocessChain& chain) {
+    const bool commutative = ngraph::is_type<ngraph::opset1::Add>(node) || ngraph::is_type<ngraph::opset1::Multiply>(node);
+    if (!commutative && !ngraph::is_type<ngraph::opset1::Subtract>(node) && !ngraph::is_type<ngraph::opset1::Divide>(node))
+        return false;
+    if (!chain.layoutKnown || chain.type != ngraph::element::f32 || node->get_output_element_type(0) != ngraph::element::f32 ||
+        node->get_autob().m_type != ngraph::op::AutoBroadcastType::NUMPY)
+        return false;
+
+    const size_t dataPort = node->input_value(0) == data ? 0 : 1;
+    if (dataPort == 1 && !commutative)
+        return false;
+    const auto constant = getConstant(node->input_value(1 - dataPort));
+    if (!constant)
+        return false;
+
+    // only the channel dimension of the broadcasted constant may differ from 1
+    const auto& constantShape = constant->get_shape();
+    const size_t channels = chain.channelMap.size();
+    if (constantShape.size() > 4)
+        return false;
+    for (size_t i = 0; i < constantShape.size(); i++) {
+        const auto axis = 4 - constantShape.size() + i;
+        if (constantShape[i] != 1 && (axis != chain.channelAxis() || constantShape[i] != channels))
+            return false;
+    }
+
+    const auto values = constant->cast_vector<float>();
+    for (size_t c = 0; c < channels; c++) {
+        const float value = values.size() == 1 ? values[0] : values[c];
+        if (ngraph::is_type<ngraph::opset1::Add>(node)) {
+            chain.shift[c] += value;
+        } else if (ngraph::is_type<ngraph::opset1::Subtract>(node)) {
+            chain.shift[c] -= value;
+        } else if (ngraph::is_type<ngraph::opset1::Multiply>(node)) {
+            chain.scale[c] *= value;
+            chain.shift[c] *= value;
+        } else {
+            if (value == 0.f)
+                return false;
+            chain.scale[c] /= value;
+            chain.shift[c] /= value;
+        }
+    }
+    chain.colorAllowed = false;
+    return true;
+}
+
+bool matchTranspose(const std::shared_ptr<ngraph::Node>& node, PreprocessChain& chain) {
+    if (!ngraph::is_type<ngraph::opset1::Transpose>(node) || !chain.layoutKnown)
+        return false;
+    const auto order = getConstant(node->input_value(1));
+    if (!order)
+        return false;
+    const auto orderValues = order->cast_vector<int64_t>();
+    if (orderValues != (chain.planar ? std::vector<int64_t>{0, 2, 3, 1} : std::vector<int64_t>{0, 3, 1, 2}))
+        return false;
+
+    chain.planar = !chain.planar;
+    chain.colorAllowed = false;
+    return true;
+}
+
+void initLayout(const std::shared_ptr<ngraph::opset1::Parameter>& param, PreprocessChain& chain) {
+    const auto& layout = param->get_layout();
+    const auto& shape = param->get_partial_shape();
+    if (layout == ov::Layout("NCHW") || layout == ov::Layout("NHWC")) {
+        chain.planarInput = chain.planar = layout == ov::Layout("NCHW");
+        if (shape[chain.channelAxis()].is_static())
+            chain.initChannels(shape[chain.channelAxis()].get_length());
+    }
+}
+
+bool fuseChain(const std::shared_ptr<ngraph::opset1::Parameter>& param) {
+    PreprocessChain chain;
+    chain.type = param->get_element_type();
+    initLayout(param, chain);
+
+    // the fused operation must produce f32, so the longest prefix which ends with f32 tensor is kept
+    PreprocessChain fused;
+    auto current = param->output(0);
+    while (true) {
+        const auto consumers = current.get_target_inputs();
+        if (consumers.size() != 1)
+            break;
+        const auto node = consumers.begin()->get_node()->shared_from_this();
+        if (node->get_output_size() != 1 || node->get_output_partial_shape(0).rank() != 4)
+            break;
+        if (consumers.begin()->get_index() != 0 && !ngraph::op::is_binary_elementwise_arithmetic(node))
+            break;
+        if (!matchColorConversion(node, chain) && !matchConvert(node, chain) && !matchResize(node, chain) &&
+            !matchChannelMap(node, chain) && !matchEltwise(node, current, chain) && !matchTranspose(node, chain))
+            break;
+
+        chain.nodes.push_back(node);
+        current = node->output(0);
+        if (chain.type == ngraph::element::f32 && chain.nodes.size() >= 2)
+            fused = chain;
+    }
+    if (fused.nodes.empty())
+        return false;
+
+    std::vector<int64_t> identity(fused.channelMap.size());
+    std::iota(identity.begin(), identity.end(), 0);
+    if (fused.channelMap == identity)
+        fused.channelMap.clear();
+    if (std::all_of(fused.scale.begin(), fused.scale.end(), [](float value) { return value == 1.f; }))
+        fused.scale.clear();
+    if (std::all_of(fused.shift.begin(), fused.shift.end(), [](float value) { return value == 0.f; }))
+        fused.shift.clear();
+
+    const auto& last = fused.nodes.back();
+    const auto preprocess = std::make_shared<ImagePreprocessNode>(param, fused.color, fused.colorRounding, fused.planarInput,
+                                                                  fused.planar, fused.outputSize, fused.channelMap,
+                                                                  fused.scale, fused.shift, ngraph::element::f32);
+    if (!preprocess->get_output_partial_shape(0).compatible(last->get_output_partial_shape(0)))
+        return false;
+
+    preprocess->set_friendly_name(last->get_friendly_name());
+    ngraph::copy_runtime_info(fused.nodes, preprocess);
+    ngraph::replace_node(last, preprocess);
+    return true;
+}
+}   // namespace
+
+bool FuseImagePreprocess::run_on_model(const std::shared_ptr<ov::Model>& model) {
+    RUN_ON_MODEL_SCOPE(FuseImagePreprocess);
+    bool rewritten = false;
+    for (const auto& param : model->get_parameters()) {
+        if (param->get_partial_shape().rank() != 4)
+            continue;
+        rewritten |= fuseChain(param);
+    }
+    return rewritten;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,28 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @interface FuseImagePreprocess
+ * @brief Fuses the chain of the preprocessing operations at the model input (the way PrePostProcessor lowers them) into
+ * a single ImagePreprocess operation. The chain starts at a 4D Parameter and may contain a single plane NV12/I420 color
+ * conversion, Convert to f32, bilinear resize of the spatial axes, channels reordering (Gather along the channel axis),
+ * per channel Add/Subtract/Multiply/Divide by constants and NHWC <-> NCHW Transpose. The chain is fused only if at least
+ * two operations are matched; the longest matched prefix is fused and the rest of the chain is left as is.
+ */
+class FuseImagePreprocess : public ov::pass::ModelPass {
+public:
+    OPENVINO_RTTI("FuseImagePreprocess", "0");
+    FuseImagePreprocess() : ModelPass() {}
+    bool run_on_model(const std::shared_ptr<ov::Model> &) override;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
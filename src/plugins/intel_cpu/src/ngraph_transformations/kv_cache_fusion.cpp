@@ -0,0 +1,69 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "kv_cache_fusion.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/op/assign.hpp>
+#include <ngraph/op/read_value.hpp>
+#include <ngraph/rt_info.hpp>
+#include "op/kv_cache.hpp"
+
+#include "itt.hpp"
+
+bool ov::intel_cpu::KVCacheFusion::run_on_model(const std::shared_ptr<ov::Model>& model) {
+    RUN_ON_MODEL_SCOPE(KVCacheFusion);
+    bool rewritten = false;
+    const auto sinks = model->get_sinks();
+    for (const auto& sink : sinks) {
+        const auto assign = std::dynamic_pointer_cast<ngraph::op::AssignBase>(sink);
+        if (!assign)
+            continue;
+        const auto concat = std::dynamic_pointer_cast<ngraph::opset1::Concat>(assign->get_input_node_shared_ptr(0));
+        if (!concat || concat->get_input_size() != 2 || concat->get_output_target_inputs(0).size() < 2)
+            continue;
+        const auto readValue = std::dynamic_pointer_cast<ngraph::op::ReadValueBase>(concat->get_input_node_shared_ptr(0));
+        if (!readValue || readValue->get_variable_id() != assign->get_variable_id() ||
+            readValue->get_output_target_inputs(0).size() != 1)
+            continue;
+
+        const auto& shape = concat->get_output_partial_shape(0);
+        if (shape.rank().is_dynamic())
+            continue;
+        const auto rank = shape.rank().get_length();
+        const auto axis = concat->get_concatenation_axis();
+        // the state of KVCache starts empty, so the variable must be initialized by an empty value
+        const auto& initShape = readValue->get_input_partial_shape(0);
+        if (axis < 0 || axis >= rank || initShape.rank() != shape.rank() || initShape[axis] != ngraph::Dimension(0))
+            continue;
+
+        bool outerUnit = true;
+        for (int64_t i = 0; i < axis; i++)
+            outerUnit = outerUnit && shape[i] == ngraph::Dimension(1);
+        // Every slice before the axis keeps a headroom, so the cache is not dense if they are not 1. The MatMul reads
+        // its inputs by strides, but not if it's converted to FullyConnected with the constant second input.
+        const auto readsByStrides = [](const ngraph::Input<ngraph::Node>& input) {
+            const auto matmul = dynamic_cast<ngraph::opset1::MatMul*>(input.get_node());
+            return matmul && !ngraph::is_type<ngraph::opset1::Constant>(matmul->get_input_node_shared_ptr(1));
+        };
+        bool stridedConsumers = true;
+        for (const auto& input : concat->output(0).get_target_inputs())
+            stridedConsumers = stridedConsumers && (input.get_node() == assign.get() || readsByStrides(input));
+        if (!outerUnit && !stridedConsumers)
+            continue;
+
+        const auto kvCache = std::make_shared<ov::intel_cpu::KVCacheNode>(concat->input_value(1), readValue->get_variable_id(), axis);
+        kvCache->set_friendly_name(concat->get_friendly_name());
+        ngraph::copy_runtime_info({readValue, concat, assign}, kvCache);
+
+        // the state is updated by KVCache, so the Assign is removed together with the Concat
+        for (auto& input : concat->output(0).get_target_inputs()) {
+            if (input.get_node() != assign.get())
+                input.replace_source_output(kvCache->output(0));
+        }
+        model->remove_sink(assign);
+        rewritten = true;
+    }
+    return rewritten;
+}
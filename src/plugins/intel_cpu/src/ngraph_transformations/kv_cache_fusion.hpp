@@ -0,0 +1,27 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @interface KVCacheFusion
+ * @brief Fuses ReadValue -> Concat -> Assign of the same variable into KVCache, so the new values are appended to the
+ * growable state instead of copying the whole state on every inference. If the dimensions before the concatenation axis
+ * are not 1, the cache is kept in the layout of the variable with a headroom in every slice, so it's fused only if all
+ * the consumers read it by strides.
+ */
+class KVCacheFusion : public ov::pass::ModelPass {
+public:
+    OPENVINO_RTTI("KVCacheFusion", "0");
+    KVCacheFusion() : ModelPass() {}
+    bool run_on_model(const std::shared_ptr<ov::Model> &) override;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
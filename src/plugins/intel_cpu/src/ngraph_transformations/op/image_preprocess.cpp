@@ -0,0 +1,112 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+
+#include "image_preprocess.hpp"
+#include "../itt.hpp"
+
+namespace {
+using ColorConversion = ov::intel_cpu::ImagePreprocessNode::ColorConversion;
+
+const std::vector<std::pair<ColorConversion, std::string>>& colorConversionNames() {
+    static const std::vector<std::pair<ColorConversion, std::string>> names = {
+        {ColorConversion::NONE, "NONE"},
+        {ColorConversion::NV12_TO_RGB, "NV12toRGB"},
+        {ColorConversion::NV12_TO_BGR, "NV12toBGR"},
+        {ColorConversion::I420_TO_RGB, "I420toRGB"},
+        {ColorConversion::I420_TO_BGR, "I420toBGR"},
+    };
+    return names;
+}
+}   // namespace
+
+ov::intel_cpu::ImagePreprocessNode::ImagePreprocessNode(const ngraph::Output<Node>& data,
+                                                       ColorConversion color,
+                                                       bool colorRounding,
+                                                       bool planarInput,
+                                                       bool planarOutput,
+                                                       const std::vector<int64_t>& outputSize,
+                                                       const std::vector<int64_t>& channelMap,
+                                                       const std::vector<float>& scale,
+                                                       const std::vector<float>& shift,
+                                                       const ngraph::element::Type& outputType)
+    : Op({data}), m_color(color), m_colorRounding(colorRounding), m_planarInput(planarInput), m_planarOutput(planarOutput),
+      m_outputSize(outputSize), m_channelMap(channelMap), m_scale(scale), m_shift(shift), m_outputType(outputType) {
+    validate_and_infer_types();
+}
+
+std::shared_ptr<ngraph::Node> ov::intel_cpu::ImagePreprocessNode::clone_with_new_inputs(const ngraph::OutputVector &new_args) const {
+    INTERNAL_OP_SCOPE(ImagePreprocessNode_clone_with_new_inputs);
+    check_new_args_count(this, new_args);
+    return std::make_shared<ov::intel_cpu::ImagePreprocessNode>(new_args.at(0), m_color, m_colorRounding, m_planarInput, m_planarOutput,
+                                                                m_outputSize, m_channelMap, m_scale, m_shift, m_outputType);
+}
+
+void ov::intel_cpu::ImagePreprocessNode::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(ImagePreprocessNode_validate_and_infer_types);
+    const auto& inputShape = get_input_partial_shape(0);
+    NODE_VALIDATION_CHECK(this, inputShape.rank().compatible(4), "Input rank must be 4");
+    NODE_VALIDATION_CHECK(this, m_outputSize.empty() || m_outputSize.size() == 2, "Output size must contain H and W");
+    NODE_VALIDATION_CHECK(this, m_color == ColorConversion::NONE || !m_planarInput, "Color conversion input must be NHWC");
+
+    ngraph::Dimension N = ngraph::Dimension::dynamic(), C = ngraph::Dimension::dynamic(),
+                      H = ngraph::Dimension::dynamic(), W = ngraph::Dimension::dynamic();
+    if (inputShape.rank().is_static()) {
+        N = inputShape[0];
+        if (m_color != ColorConversion::NONE) {
+            C = 3;
+            if (inputShape[1].is_static()) {
+                NODE_VALIDATION_CHECK(this, inputShape[1].get_length() % 3 == 0, "Color converted image height must be divisible by 3");
+                H = inputShape[1].get_length() * 2 / 3;
+            }
+            W = inputShape[2];
+        } else {
+            C = m_planarInput ? inputShape[1] : inputShape[3];
+            H = m_planarInput ? inputShape[2] : inputShape[1];
+            W = m_planarInput ? inputShape[3] : inputShape[2];
+        }
+    }
+
+    if (!m_outputSize.empty()) {
+        H = m_outputSize[0];
+        W = m_outputSize[1];
+    }
+    if (!m_channelMap.empty()) {
+        for (const auto channel : m_channelMap)
+            NODE_VALIDATION_CHECK(this, channel >= 0 && (C.is_dynamic() || channel < C.get_length()), "Channel map index is out of range");
+        C = static_cast<int64_t>(m_channelMap.size());
+    }
+    for (const auto& values : {m_scale, m_shift}) {
+        NODE_VALIDATION_CHECK(this, values.empty() || C.compatible(static_cast<int64_t>(values.size())),
+                              "Scale and shift must be set for every output channel");
+    }
+
+    const auto outputShape = m_planarOutput ? ngraph::PartialShape{N, C, H, W} : ngraph::PartialShape{N, H, W, C};
+    set_output_type(0, m_outputType, outputShape);
+}
+
+bool ov::intel_cpu::ImagePreprocessNode::visit_attributes(ngraph::AttributeVisitor &visitor) {
+    INTERNAL_OP_SCOPE(ImagePreprocessNode_visit_attributes);
+    const auto& names = colorConversionNames();
+    auto colorName = std::find_if(names.begin(), names.end(), [&](const std::pair<ColorConversion, std::string>& name) {
+        return name.first == m_color;
+    })->second;
+    visitor.on_attribute("color_conversion", colorName);
+    auto color = std::find_if(names.begin(), names.end(), [&](const std::pair<ColorConversion, std::string>& name) {
+        return name.second == colorName;
+    });
+    NODE_VALIDATION_CHECK(this, color != names.end(), "Unsupported color conversion: ", colorName);
+    m_color = color->first;
+
+    visitor.on_attribute("color_rounding", m_colorRounding);
+    visitor.on_attribute("planar_input", m_planarInput);
+    visitor.on_attribute("planar_output", m_planarOutput);
+    visitor.on_attribute("output_size", m_outputSize);
+    visitor.on_attribute("channel_map", m_channelMap);
+    visitor.on_attribute("scale", m_scale);
+    visitor.on_attribute("shift", m_shift);
+    visitor.on_attribute("out-type", m_outputType);
+    return true;
+}
@@ -0,0 +1,82 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/op/op.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Fused image preprocessing of a model input: optional single plane color conversion,
+ * bilinear resize, channels permutation, per channel scale and shift and the layout change in one pass.
+ * The output is computed as dst[c] = src[channel_map[c]] * scale[c] + shift[c].
+ */
+class ImagePreprocessNode : public ngraph::op::Op {
+public:
+    OPENVINO_OP("ImagePreprocess", "cpu_plugin_opset");
+
+    enum class ColorConversion {
+        NONE,
+        NV12_TO_RGB,
+        NV12_TO_BGR,
+        I420_TO_RGB,
+        I420_TO_BGR
+    };
+
+    ImagePreprocessNode() = default;
+
+    /**
+     * @param data - input image, NHWC or NCHW, single plane NV12/I420 image is NHWC with C = 1
+     * @param color - color conversion applied to the input
+     * @param colorRounding - the converted color values are rounded as for the integer color conversion output
+     * @param planarInput - the input (if color conversion is not applied) is NCHW
+     * @param planarOutput - the output is NCHW
+     * @param outputSize - {H, W} of the bilinearly resized image, empty if the resize is not applied
+     * @param channelMap - indices of the source channels for every output channel, empty for identity
+     * @param scale - per output channel scale, empty for identity
+     * @param shift - per output channel shift, empty for identity
+     * @param outputType - output element type
+     */
+    ImagePreprocessNode(const ngraph::Output<ngraph::Node>& data,
+                        ColorConversion color,
+                        bool colorRounding,
+                        bool planarInput,
+                        bool planarOutput,
+                        const std::vector<int64_t>& outputSize,
+                        const std::vector<int64_t>& channelMap,
+                        const std::vector<float>& scale,
+                        const std::vector<float>& shift,
+                        const ngraph::element::Type& outputType);
+
+    void validate_and_infer_types() override;
+
+    bool visit_attributes(ngraph::AttributeVisitor &visitor) override;
+
+    std::shared_ptr<ngraph::Node> clone_with_new_inputs(const ngraph::OutputVector &new_args) const override;
+
+    ColorConversion get_color_conversion() const { return m_color; }
+    bool get_color_rounding() const { return m_colorRounding; }
+    bool is_planar_input() const { return m_planarInput; }
+    bool is_planar_output() const { return m_planarOutput; }
+    const std::vector<int64_t>& get_output_size() const { return m_outputSize; }
+    const std::vector<int64_t>& get_channel_map() const { return m_channelMap; }
+    const std::vector<float>& get_scale() const { return m_scale; }
+    const std::vector<float>& get_shift() const { return m_shift; }
+
+private:
+    ColorConversion m_color = ColorConversion::NONE;
+    bool m_colorRounding = false;
+    bool m_planarInput = false;
+    bool m_planarOutput = false;
+    std::vector<int64_t> m_outputSize;
+    std::vector<int64_t> m_channelMap;
+    std::vector<float> m_scale;
+    std::vector<float> m_shift;
+    ngraph::element::Type m_outputType;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,39 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "kv_cache.hpp"
+#include "../itt.hpp"
+
+ov::intel_cpu::KVCacheNode::KVCacheNode(const ngraph::Output<ngraph::Node>& arg,
+                                        const std::string& variable_id,
+                                        int64_t axis)
+    : Op({arg}), m_variable_id(variable_id), m_axis(axis) {
+    validate_and_infer_types();
+}
+
+std::shared_ptr<ngraph::Node> ov::intel_cpu::KVCacheNode::clone_with_new_inputs(const ngraph::OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(KVCacheNode_clone_with_new_inputs);
+    check_new_args_count(this, new_args);
+    return std::make_shared<ov::intel_cpu::KVCacheNode>(new_args.at(0), m_variable_id, m_axis);
+}
+
+void ov::intel_cpu::KVCacheNode::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(KVCacheNode_validate_and_infer_types);
+    const auto& shape = get_input_partial_shape(0);
+    NODE_VALIDATION_CHECK(this, shape.rank().is_static(), "Input rank must be static");
+    const auto rank = shape.rank().get_length();
+    NODE_VALIDATION_CHECK(this, m_axis >= 0 && m_axis < rank, "Axis ", m_axis, " is out of the input rank ", rank);
+
+    // the stored length is defined at runtime
+    auto outputShape = shape;
+    outputShape[m_axis] = ngraph::Dimension::dynamic();
+    set_output_type(0, get_input_element_type(0), outputShape);
+}
+
+bool ov::intel_cpu::KVCacheNode::visit_attributes(ngraph::AttributeVisitor &visitor) {
+    INTERNAL_OP_SCOPE(KVCacheNode_visit_attributes);
+    visitor.on_attribute("variable_id", m_variable_id);
+    visitor.on_attribute("axis", m_axis);
+    return true;
+}
@@ -0,0 +1,42 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/op/op.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Appends the input to the variable state along the axis and returns the whole state, i.e. the fused
+ * ReadValue -> Concat -> Assign of the same variable. The state keeps a headroom along the axis, so the appended
+ * values are written after the stored ones without moving them. The state starts empty.
+ */
+class KVCacheNode : public ngraph::op::Op {
+public:
+    OPENVINO_OP("KVCache", "cpu_plugin_opset");
+
+    KVCacheNode() = default;
+
+    KVCacheNode(const ngraph::Output<ngraph::Node>& arg,
+                const std::string& variable_id,
+                int64_t axis);
+
+    void validate_and_infer_types() override;
+
+    bool visit_attributes(ngraph::AttributeVisitor &visitor) override;
+
+    std::shared_ptr<ngraph::Node> clone_with_new_inputs(const ngraph::OutputVector &new_args) const override;
+
+    const std::string& get_variable_id() const { return m_variable_id; }
+    int64_t get_axis() const { return m_axis; }
+
+private:
+    std::string m_variable_id;
+    int64_t m_axis = 0;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
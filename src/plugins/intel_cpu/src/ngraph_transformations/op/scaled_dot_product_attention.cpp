@@ -0,0 +1,82 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "scaled_dot_product_attention.hpp"
+#include "../itt.hpp"
+
+namespace {
+bool isPermutation(const std::vector<int64_t>& order) {
+    std::vector<bool> used(order.size(), false);
+    for (const auto axis : order) {
+        if (axis < 0 || axis >= static_cast<int64_t>(order.size()) || used[axis])
+            return false;
+        used[axis] = true;
+    }
+    return true;
+}
+}   // namespace
+
+ov::intel_cpu::ScaledDotProductAttentionNode::ScaledDotProductAttentionNode(const ngraph::OutputVector& args,
+                                                                           const std::vector<int64_t>& qOrder,
+                                                                           const std::vector<int64_t>& kOrder,
+                                                                           const std::vector<int64_t>& vOrder,
+                                                                           const std::vector<int64_t>& outOrder,
+                                                                           float scale,
+                                                                           const ngraph::element::Type output_type)
+    : Op(args), m_qOrder(qOrder), m_kOrder(kOrder), m_vOrder(vOrder), m_outOrder(outOrder), m_scale(scale),
+      m_output_type(output_type) {
+    validate_and_infer_types();
+}
+
+std::shared_ptr<ngraph::Node> ov::intel_cpu::ScaledDotProductAttentionNode::clone_with_new_inputs(const ngraph::OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(ScaledDotProductAttentionNode_clone_with_new_inputs);
+    check_new_args_count(this, new_args);
+    return std::make_shared<ov::intel_cpu::ScaledDotProductAttentionNode>(new_args, m_qOrder, m_kOrder, m_vOrder, m_outOrder,
+                                                                          m_scale, m_output_type);
+}
+
+void ov::intel_cpu::ScaledDotProductAttentionNode::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(ScaledDotProductAttentionNode_validate_and_infer_types);
+    const auto input_size = get_input_size();
+    NODE_VALIDATION_CHECK(this,
+        input_size == 3 || input_size == 4,
+        "Number of inputs is incorrect. Current value is: ",
+        input_size,
+        ", expected: 3 or 4.");
+    for (const auto& order : {m_qOrder, m_kOrder, m_vOrder, m_outOrder}) {
+        NODE_VALIDATION_CHECK(this, order.size() == 4 && isPermutation(order), "Orders must be permutations of 4 axes");
+    }
+
+    const auto logicalShape = [&](size_t port, const std::vector<int64_t>& order) {
+        const auto& shape = get_input_partial_shape(port);
+        NODE_VALIDATION_CHECK(this, shape.rank().compatible(4), "Q, K and V inputs must be 4D");
+        if (shape.rank().is_dynamic())
+            return ngraph::PartialShape::dynamic(4);
+        return ngraph::PartialShape{shape[order[0]], shape[order[1]], shape[order[2]], shape[order[3]]};
+    };
+    const auto q = logicalShape(0, m_qOrder);
+    const auto k = logicalShape(1, m_kOrder);
+    const auto v = logicalShape(2, m_vOrder);
+    NODE_VALIDATION_CHECK(this, q[3].compatible(k[3]), "Q and K must have the same head size");
+    NODE_VALIDATION_CHECK(this, k[2].compatible(v[2]), "K and V must have the same sequence length");
+    if (input_size == 4) {
+        const auto& mask = get_input_partial_shape(3);
+        NODE_VALIDATION_CHECK(this, mask.rank().is_dynamic() || mask.rank().get_length() <= 4, "Mask rank must not exceed 4");
+    }
+
+    const ngraph::PartialShape output{q[0], q[1], q[2], v[3]};
+    const auto outputShape = ngraph::PartialShape{output[m_outOrder[0]], output[m_outOrder[1]], output[m_outOrder[2]], output[m_outOrder[3]]};
+    set_output_type(0, m_output_type == ngraph::element::undefined ? get_input_element_type(0) : m_output_type, outputShape);
+}
+
+bool ov::intel_cpu::ScaledDotProductAttentionNode::visit_attributes(ngraph::AttributeVisitor &visitor) {
+    INTERNAL_OP_SCOPE(ScaledDotProductAttentionNode_visit_attributes);
+    visitor.on_attribute("q_order", m_qOrder);
+    visitor.on_attribute("k_order", m_kOrder);
+    visitor.on_attribute("v_order", m_vOrder);
+    visitor.on_attribute("out_order", m_outOrder);
+    visitor.on_attribute("scale", m_scale);
+    visitor.on_attribute("out-type", m_output_type);
+    return true;
+}
@@ -0,0 +1,55 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/op/op.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Scaled dot product attention: Softmax(Q * K^T * scale + mask) * V.
+ * Q, K and V are read in the logical [B, H, L, D] layout: the logical dimension i of the input is the dimension
+ * order[i] of the input tensor, so the transposes produced by the exporters are the part of the operation.
+ * The output tensor dimension j is the dimension out_order[j] of the logical [B, H, Lq, Dv] output.
+ * The optional mask is broadcasted to [B, H, Lq, Lk] by the numpy rules.
+ */
+class ScaledDotProductAttentionNode : public ngraph::op::Op {
+public:
+    OPENVINO_OP("ScaledDotProductAttention", "cpu_plugin_opset");
+
+    ScaledDotProductAttentionNode() = default;
+
+    ScaledDotProductAttentionNode(const ngraph::OutputVector& args,
+                                  const std::vector<int64_t>& qOrder,
+                                  const std::vector<int64_t>& kOrder,
+                                  const std::vector<int64_t>& vOrder,
+                                  const std::vector<int64_t>& outOrder,
+                                  float scale,
+                                  const ngraph::element::Type output_type = ngraph::element::undefined);
+
+    void validate_and_infer_types() override;
+
+    bool visit_attributes(ngraph::AttributeVisitor &visitor) override;
+
+    std::shared_ptr<ngraph::Node> clone_with_new_inputs(const ngraph::OutputVector &new_args) const override;
+
+    const std::vector<int64_t>& get_q_order() const { return m_qOrder; }
+    const std::vector<int64_t>& get_k_order() const { return m_kOrder; }
+    const std::vector<int64_t>& get_v_order() const { return m_vOrder; }
+    const std::vector<int64_t>& get_out_order() const { return m_outOrder; }
+    float get_scale() const { return m_scale; }
+
+private:
+    std::vector<int64_t> m_qOrder;
+    std::vector<int64_t> m_kOrder;
+    std::vector<int64_t> m_vOrder;
+    std::vector<int64_t> m_outOrder;
+    float m_scale = 1.f;
+    ngraph::element::Type m_output_type;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,194 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "scaled_dot_product_attention_fusion.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset8.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+#include <utils/general_utils.h>
+#include "op/scaled_dot_product_attention.hpp"
+
+#include "itt.hpp"
+
+namespace {
+const std::vector<int64_t> identityOrder{0, 1, 2, 3};
+const std::vector<int64_t> swappedOrder{0, 1, 3, 2};
+
+bool hasSingleConsumer(const ngraph::Output<ngraph::Node>& output) {
+    return output.get_target_inputs().size() == 1;
+}
+
+bool is4D(const ngraph::Output<ngraph::Node>& output) {
+    return output.get_partial_shape().rank().is_static() && output.get_partial_shape().rank().get_length() == 4;
+}
+
+bool getScalar(const ngraph::Output<ngraph::Node>& output, float& value) {
+    const auto constant = std::dynamic_pointer_cast<ngraph::opset1::Constant>(output.get_node_shared_ptr());
+    if (!constant || ngraph::shape_size(constant->get_shape()) != 1 || constant->get_shape().size() > 4)
+        return false;
+    value = constant->cast_vector<float>()[0];
+    return true;
+}
+
+// Multiply(data, scalar) -> data, value
+bool matchScalarMultiply(const std::shared_ptr<ngraph::Node>& node, ngraph::Output<ngraph::Node>& data, float& value) {
+    if (!ngraph::is_type<ngraph::opset1::Multiply>(node))
+        return false;
+    for (size_t port = 0; port < 2; port++) {
+        if (is4D(node->input_value(port)) && getScalar(node->input_value(1 - port), value)) {
+            data = node->input_value(port);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Peels the single consumer transposes and scalar multiplications off the attention input.
+// The logical order is updated so that the logical dimension i is the dimension order[i] of the returned output.
+ngraph::Output<ngraph::Node> peelInput(ngraph::Output<ngraph::Node> input, std::vector<int64_t>& order, float* scale,
+                                       ngraph::NodeVector& fused) {
+    while (hasSingleConsumer(input)) {
+        const auto node = input.get_node_shared_ptr();
+        if (ngraph::is_type<ngraph::opset1::Transpose>(node)) {
+            const auto permutation = std::dynamic_pointer_cast<ngraph::opset1::Constant>(node->get_input_node_shared_ptr(1));
+            if (!permutation || !is4D(node->input_value(0)))
+                break;
+            const auto permutationValues = permutation->cast_vector<int64_t>();
+            if (permutationValues.size() != 4)
+                break;
+            for (auto& axis : order)
+                axis = permutationValues[axis];
+            fused.push_back(node);
+            input = node->input_value(0);
+            continue;
+        }
+        float value;
+        ngraph::Output<ngraph::Node> data;
+        if (scale && matchScalarMultiply(node, data, value)) {
+            *scale *= value;
+            fused.push_back(node);
+            input = data;
+            continue;
+        }
+        break;
+    }
+    return input;
+}
+
+// [Multiply(scalar)] -> MatMul(Q, K)
+std::shared_ptr<ngraph::opset1::MatMul> matchScores(const ngraph::Output<ngraph::Node>& scores, float& scale, ngraph::NodeVector& fused) {
+    if (!hasSingleConsumer(scores))
+        return nullptr;
+    auto node = scores.get_node_shared_ptr();
+    ngraph::Output<ngraph::Node> data;
+    float value = 1.f;
+    if (matchScalarMultiply(node, data, value)) {
+        if (!hasSingleConsumer(data))
+            return nullptr;
+        fused.push_back(node);
+        node = data.get_node_shared_ptr();
+    }
+    const auto matmul = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(node);
+    if (!matmul || !is4D(matmul->input_value(0)) || !is4D(matmul->input_value(1)))
+        return nullptr;
+    scale *= value;
+    fused.push_back(matmul);
+    return matmul;
+}
+}   // namespace
+
+ov::intel_cpu::ScaledDotProductAttentionFusion::ScaledDotProductAttentionFusion() {
+    MATCHER_SCOPE(ScaledDotProductAttentionFusion);
+    auto softmax_m = ngraph::pattern::wrap_type<ngraph::opset1::Softmax, ngraph::opset8::Softmax>(ngraph::pattern::consumers_count(1));
+    auto matmul_m = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({softmax_m, ngraph::pattern::any_input()});
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+        const auto outputMatMul = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(pattern_map.at(matmul_m).get_node_shared_ptr());
+        const auto softmax = pattern_map.at(softmax_m).get_node_shared_ptr();
+        if (!outputMatMul || outputMatMul->get_transpose_a() || !is4D(softmax->output(0)) || !is4D(outputMatMul->input_value(1)))
+            return false;
+
+        int64_t axis = 0;
+        if (const auto softmax1 = std::dynamic_pointer_cast<ngraph::opset1::Softmax>(softmax)) {
+            axis = static_cast<int64_t>(softmax1->get_axis());
+        } else {
+            axis = std::dynamic_pointer_cast<ngraph::opset8::Softmax>(softmax)->get_axis();
+        }
+        if (axis != 3 && axis != -1)
+            return false;
+
+        ngraph::NodeVector fused{outputMatMul, softmax};
+        float scale = 1.f;
+        std::shared_ptr<ngraph::opset1::MatMul> scoresMatMul;
+        ngraph::OutputVector mask;
+        const auto scores = softmax->input_value(0);
+        if (ngraph::is_type<ngraph::opset1::Add>(scores.get_node_shared_ptr()) && hasSingleConsumer(scores)) {
+            const auto add = scores.get_node_shared_ptr();
+            for (size_t port = 0; port < 2 && !scoresMatMul; port++) {
+                ngraph::NodeVector scoresNodes;
+                float scoresScale = 1.f;
+                scoresMatMul = matchScores(add->input_value(port), scoresScale, scoresNodes);
+                if (scoresMatMul && !add->get_output_partial_shape(0).compatible(scoresMatMul->get_output_partial_shape(0)))
+                    return false;
+                if (scoresMatMul) {
+                    scale *= scoresScale;
+                    fused.push_back(add);
+                    fused.insert(fused.end(), scoresNodes.begin(), scoresNodes.end());
+                    mask.push_back(add->input_value(1 - port));
+                }
+            }
+        } else {
+            scoresMatMul = matchScores(scores, scale, fused);
+        }
+        if (!scoresMatMul || (!mask.empty() && mask[0].get_partial_shape().rank().is_dynamic()) ||
+            (!mask.empty() && mask[0].get_partial_shape().rank().get_length() > 4))
+            return false;
+
+        auto qOrder = scoresMatMul->get_transpose_a() ? swappedOrder : identityOrder;
+        auto kOrder = scoresMatMul->get_transpose_b() ? identityOrder : swappedOrder;
+        auto vOrder = outputMatMul->get_transpose_b() ? swappedOrder : identityOrder;
+        const auto q = peelInput(scoresMatMul->input_value(0), qOrder, &scale, fused);
+        const auto k = peelInput(scoresMatMul->input_value(1), kOrder, &scale, fused);
+        const auto v = peelInput(outputMatMul->input_value(1), vOrder, nullptr, fused);
+
+        const auto type = q.get_element_type();
+        if (!one_of(type, ngraph::element::f32, ngraph::element::bf16) ||
+            k.get_element_type() != type || v.get_element_type() != type ||
+            (!mask.empty() && !one_of(mask[0].get_element_type(), ngraph::element::f32, ngraph::element::bf16)))
+            return false;
+
+        std::shared_ptr<ngraph::Node> last = outputMatMul;
+        auto outOrder = identityOrder;
+        const auto& consumers = outputMatMul->get_output_target_inputs(0);
+        if (consumers.size() == 1) {
+            const auto transpose = consumers.begin()->get_node()->shared_from_this();
+            if (ngraph::is_type<ngraph::opset1::Transpose>(transpose)) {
+                const auto permutation = std::dynamic_pointer_cast<ngraph::opset1::Constant>(transpose->get_input_node_shared_ptr(1));
+                if (permutation && permutation->cast_vector<int64_t>().size() == 4) {
+                    outOrder = permutation->cast_vector<int64_t>();
+                    fused.push_back(transpose);
+                    last = transpose;
+                }
+            }
+        }
+
+        ngraph::OutputVector args{q, k, v};
+        args.insert(args.end(), mask.begin(), mask.end());
+        const auto attention = std::make_shared<ov::intel_cpu::ScaledDotProductAttentionNode>(args, qOrder, kOrder, vOrder, outOrder,
+                                                                                               scale, last->get_output_element_type(0));
+        if (!attention->get_output_partial_shape(0).compatible(last->get_output_partial_shape(0)))
+            return false;
+
+        attention->set_friendly_name(last->get_friendly_name());
+        ngraph::copy_runtime_info(fused, attention);
+        ngraph::replace_node(last, attention);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(matmul_m, matcher_name);
+    this->register_matcher(m, callback);
+}
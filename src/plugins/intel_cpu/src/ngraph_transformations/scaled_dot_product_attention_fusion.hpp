@@ -0,0 +1,25 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @interface ScaledDotProductAttentionFusion
+ * @brief Fuses MatMul(Q, K^T) -> [Multiply(scale)] -> [Add(mask)] -> Softmax -> MatMul(V) into ScaledDotProductAttention,
+ * so the [B, H, Lq, Lk] attention scores are never materialized. The transposes of Q, K, V and of the output as well as
+ * the scalar scales of Q and K are fused into the operation.
+ */
+class ScaledDotProductAttentionFusion: public ngraph::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("ScaledDotProductAttentionFusion", "0");
+    ScaledDotProductAttentionFusion();
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -746,7 +746,7 @@ void Node::prepareMemory(dnnl::primitive_desc_iterator& itpd) {
             Memory memory{ engine };
             memory.Create(newDesc, internalBlob->buffer());
 
-            MemoryPtr _ptr = MemoryPtr(new Memory(engine));
+            MemoryPtr _ptr = MemoryPtr(new Memory(engine, weightCache ? weightCache->getMemoryAllocator() : nullptr));
             _ptr->Create(*intDescs[i]);
             _ptr->SetData(memory);
 
@@ -1449,7 +1449,19 @@ bool Node::inputShapesModified() const {
         if (lastInputDims[i] != getParentEdgesAtPort(i)[0]->getMemory().getStaticDims())
             return true;
     }
-    return false;
+    return relocatableMemory && lastMemoryPtrs != getMemoryPtrs();
+}
+
+std::vector<void*> Node::getMemoryPtrs() const {
+    std::vector<void*> ptrs;
+    ptrs.reserve(getParentEdges().size() + outputShapes.size());
+    for (size_t i = 0; i < getParentEdges().size(); i++)
+        ptrs.push_back(getParentEdgesAtPort(i)[0]->getMemory().getDnnlMemoryMngr()->getRawPtr());
+    for (size_t i = 0; i < outputShapes.size(); i++) {
+        const auto edges = getChildEdgesAtPort(i);
+        ptrs.push_back(edges.empty() ? nullptr : edges[0]->getMemory().getDnnlMemoryMngr()->getRawPtr());
+    }
+    return ptrs;
 }
 
 bool Node::needShapeInfer() const {
@@ -1533,6 +1545,9 @@ void Node::updateLastInputDims() {
 
     for (size_t i = 0; i < lastInputDims.size(); i++)
         lastInputDims[i] = getParentEdgesAtPort(i)[0]->getMemory().getStaticDims();
+
+    if (relocatableMemory)
+        lastMemoryPtrs = getMemoryPtrs();
 }
 
 bool Node::canFuseSimpleOperation(const NodePtr& node) const {
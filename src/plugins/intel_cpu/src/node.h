@@ -327,7 +327,7 @@ public:
 
     virtual void setDynamicBatchLim(int lim);
 
-    void resolveInPlaceEdges();
+    virtual void resolveInPlaceEdges();
 
     virtual void execute(dnnl::stream strm);
     void executeDynamic(dnnl::stream strm);
@@ -529,6 +529,14 @@ public:
         return isDynamic;
     }
 
+    /**
+     * @brief Marks the node whose input or output memory may be moved by the dynamic in-place Concat or Split while the node
+     * shapes stay the same, so the node parameters are prepared again once the data pointers have changed.
+     */
+    void setRelocatableMemory() {
+        relocatableMemory = true;
+    }
+
     const Shape& getInputShapeAtPort(size_t port) const {
         if (inputShapes.size() <= port) {
             IE_THROW() << "Incorrect input port number for node " << getName();
@@ -720,6 +728,7 @@ protected:
     void updateLastInputDims();
 
     bool inputShapesModified() const;
+    std::vector<void*> getMemoryPtrs() const;
     virtual bool needShapeInfer() const;
     std::vector<VectorDims> shapeInferGeneric(const std::vector<Shape>& inputDims, uint32_t value_port_mask = 0) const;
     std::vector<VectorDims> shapeInferGeneric(uint32_t value_port_mask = 0) const;
@@ -741,6 +750,9 @@ protected:
     }
 
     std::vector<VectorDims> lastInputDims = {};
+    // data pointers of the inputs and outputs for the last input dims, tracked for the relocatable memory only
+    std::vector<void*> lastMemoryPtrs = {};
+    bool relocatableMemory = false;
 
     std::shared_ptr<IShapeInfer> shapeInference;
 
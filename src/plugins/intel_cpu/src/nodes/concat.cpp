@@ -87,13 +87,11 @@ void Concat::getSupportedDescriptors() {
         }
     }
 
-    // we need the first dims before axis to be 1 to avoid the reorder in the edge between the first parent and this concat
-    // TODO [DS]: inplace
-    if (!isDynamicNode()) {
-        const auto& childDims = outputShapes[0].getStaticDims();
-        if (std::all_of(childDims.begin(), childDims.begin() + axis, [](size_t dim) { return  dim == 1; }))
-            canBeInPlace = true;
-    }
+    // we need the first dims before axis to be 1 to avoid the reorder in the edge between the first parent and this concat,
+    // the dynamic inputs are placed one after another in the output memory then
+    const auto& childDims = outputShapes[0].getDims();
+    if (std::all_of(childDims.begin(), childDims.begin() + axis, [](size_t dim) { return  dim == 1; }))
+        canBeInPlace = true;
 }
 
 void Concat::initSupportedPrimitiveDescriptors() {
@@ -181,7 +179,6 @@ void Concat::initSupportedPrimitiveDescriptors() {
         }
     }
 
-    // TODO [DS]: inplace
     if (!canBeInPlace || std::any_of(inputShapes.begin(), inputShapes.end(), [](const Shape& shape) { return shape.hasZeroDims(); }))
         return;
 
@@ -190,6 +187,14 @@ void Concat::initSupportedPrimitiveDescriptors() {
         const auto& refConfig = supportedPrimitiveDescriptors[refPdIndex].getConfig();
         auto config = refConfig;
 
+        // the offsets of the dynamic inputs are defined at runtime, see resolveInPlaceEdges
+        if (isDynamicNode()) {
+            for (auto& inConf : config.inConfs)
+                inConf.inPlace(0);
+            supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown);
+            continue;
+        }
+
         auto denseOutDesc = refConfig.outConfs[0].getMemDesc()->as<CpuBlockedMemoryDesc>();
         const auto &order = denseOutDesc->getOrder();
         const auto &blkDims = denseOutDesc->getBlockDims();
@@ -344,7 +349,7 @@ bool Concat::created() const {
 }
 
 bool Concat::isOptimized() const {
-    return getSelectedPrimitiveDescriptor() && getSelectedPrimitiveDescriptor()->getConfig().inConfs[0].inPlace() >= 0;
+    return !inPlaceFallback && getSelectedPrimitiveDescriptor() && getSelectedPrimitiveDescriptor()->getConfig().inConfs[0].inPlace() >= 0;
 }
 
 bool Concat::needPrepareParams() const {
@@ -488,6 +493,61 @@ void Concat::initOptimalPrimitiveDescriptor() {
     canOptimizeNspc = axis == channelAxis && getSelectedPrimitiveDescriptor()->getConfig().outConfs.front().getMemDesc()->hasLayoutType(LayoutType::nspc);
 }
 
+void Concat::resolveInPlaceEdges() {
+    if (!isDynamicNode() || !isOptimized()) {
+        Node::resolveInPlaceEdges();
+        return;
+    }
+
+    // The inputs are the consecutive partitions of the output memory, so the producers write them directly. A partition may be
+    // moved when the preceding ones are resized, so only the dynamic producers, which prepare the params again, are supported.
+    const auto baseEdge = getParentEdgeAt(0)->getSharedEdge(std::nothrow);
+    bool partitioned = baseEdge && baseEdge->getParent().get() == this;
+    for (size_t i = 0; i < getParentEdges().size() && partitioned; i++) {
+        const auto parentEdge = getParentEdgeAt(i);
+        const auto parent = parentEdge->getParent();
+        partitioned = parentEdge->getStatus() == Edge::Status::NotAllocated && parentEdge->getSharedEdge(std::nothrow) == baseEdge &&
+                      parent->getChildEdgesAtPort(parentEdge->getInputNum()).size() == 1 &&
+                      (parent->isDynamicNode() || parent->getType() == Type::Input);
+    }
+
+    std::vector<DnnlMemoryMngrPtr> partitions;
+    if (partitioned) {
+        partitions = MemoryPartitions::create(baseEdge->getMemory().getDnnlMemoryMngr(), getParentEdges().size(), true);
+    } else {
+        inPlaceFallback = true;
+    }
+
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        const auto parentEdge = getParentEdgeAt(i);
+        if (parentEdge->getStatus() != Edge::Status::NotAllocated)
+            continue;
+
+        const auto sharedEdge = parentEdge->getSharedEdge();
+        const auto parent = parentEdge->getParent();
+        const auto port = parentEdge->getInputNum();
+        const auto desc = parent->getBaseMemDescAtOutputPort(port);
+        DnnlMemoryMngrPtr memMngr = partitioned ? partitions[i] : nullptr;
+        if (partitioned)
+            parent->setRelocatableMemory();
+
+        // the other consumers of the producer output are the views of the same memory
+        for (auto& edge : parent->getChildEdgesAtPort(port)) {
+            if (edge->getStatus() != Edge::Status::NotAllocated || edge->getSharedEdge(std::nothrow) != sharedEdge)
+                continue;
+
+            edge->getMemoryPtr().reset(new Memory(getEngine()));
+            if (memMngr) {
+                edge->getMemoryPtr()->Create(desc, memMngr);
+            } else {
+                edge->getMemoryPtr()->Create(desc);
+                memMngr = edge->getMemoryPtr()->getDnnlMemoryMngr();
+            }
+            edge->changeStatus(Edge::Status::Allocated);
+        }
+    }
+}
+
 void Concat::execute(dnnl::stream strm) {
     if (isOptimized()) {
         return;
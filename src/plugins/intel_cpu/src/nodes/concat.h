@@ -33,11 +33,14 @@ public:
     bool isExecutable() const override;
     bool needPrepareParams() const override;
     void prepareParams() override;
+    void resolveInPlaceEdges() override;
 
 private:
     size_t axis = 0;
     bool canBeInPlace = false;
     bool canOptimizeNspc = false;
+    // the dynamic in-place inputs can't be placed into the output memory, so they are copied
+    bool inPlaceFallback = false;
 
     size_t inverseOrder(const InferenceEngine::SizeVector& order, size_t axis);
     void execNspcSpecCase();
@@ -12,6 +12,8 @@
 #include <ie_ngraph_utils.hpp>
 #include "cum_sum.h"
 #include "utils/bfloat16.hpp"
+#include "common/defs.h"
+#include <utils/general_utils.h>
 
 using namespace InferenceEngine;
 
@@ -129,102 +131,120 @@ void CumSum::exec() {
     }
 }
 
+namespace {
+// Minimal number of elements along the axis per thread to use the two-pass blocked scan.
+constexpr size_t blockedScanMinWork = 4096lu;
+// Number of lanes processed together when the scan goes across the inner dimensions.
+constexpr size_t lanesBlockSize = 256lu;
+
+// Serial scan along a contiguous line. 'acc' is the carry accumulated before the line.
 template <bool reverse, bool exclusive, typename dataType>
-void CumSum::cumSum(const dataType *input, dataType *output, const VectorDims &strides) {
-    SizeVector iterationRange(numOfDims - 1);
-    size_t j = 0;
-    const auto &shape = getParentEdgesAtPort(CUM_SUM_DATA)[0]->getMemory().getStaticDims();
-    for (size_t i = 0; i < shape.size(); i++) {
-        if (i == axis)
-            continue;
-        iterationRange[j++] = shape[i];
-    }
-    size_t work_amount_dst = std::accumulate(iterationRange.begin(), iterationRange.end(), 1, std::multiplies<size_t>());
-    parallel_nt(0, [&](const int ithr, const int nthr) {
-        size_t start = 0, end = 0;
-        SizeVector counters(numOfDims - 1, 0);
-        splitter(work_amount_dst, nthr, ithr, start, end);
-
-        parallelItInit(start, counters, iterationRange);
-
-        for (size_t iwork = start; iwork < end; ++iwork) {
-            std::vector<size_t> forStartOffset(numOfDims);
-            forStartOffset[axis] = 0;
-            for (size_t offsetIdx = 0, countersIdx = 0; offsetIdx < numOfDims; ++offsetIdx) {
-                if (offsetIdx == axis) {
-                    continue;
-                }
-                forStartOffset[offsetIdx] = counters[countersIdx++];
-            }
-
-            size_t startOffset = getStartOffset(forStartOffset, strides);
-
-            const dataType *inputStart = input + startOffset;
-            dataType *outputStart = output + startOffset;
-
-            size_t offset = strides[axis];
-            if (reverse) {
-                if (exclusive) {
-                    outputStart[offset*(shape[axis] - 1)] = 0;
-                    for (int64_t i = shape[axis] - 2; i >= 0; i--) {
-                        outputStart[i*offset] = inputStart[(i+1)*offset] + outputStart[(i+1)*offset];
-                    }
-                } else {
-                    outputStart[offset*(shape[axis] - 1)] = inputStart[offset * (shape[axis] - 1)];
-                    for (int64_t i = shape[axis] - 2; i >= 0; i--) {
-                        outputStart[i*offset] = inputStart[i*offset] + outputStart[(i+1)*offset];
-                    }
-                }
-            } else {
-                if (exclusive) {
-                    outputStart[0] = 0;
-                    for (size_t i = 1; i < shape[axis]; i++) {
-                        outputStart[i*offset] = inputStart[(i-1)*offset] + outputStart[(i-1)*offset];
-                    }
-                } else {
-                    outputStart[0] = inputStart[0];
-                    for (size_t i = 1; i < shape[axis]; i++) {
-                        outputStart[i*offset] = inputStart[i*offset] + outputStart[(i-1)*offset];
-                    }
-                }
-            }
-
-            parallelItStep(counters, iterationRange);
+inline void scanLine(const dataType *input, dataType *output, size_t len, dataType acc) {
+    for (size_t j = 0; j < len; j++) {
+        const size_t i = reverse ? len - 1 - j : j;
+        const dataType value = input[i];
+        if (exclusive) {
+            output[i] = acc;
+            acc = acc + value;
+        } else {
+            acc = acc + value;
+            output[i] = acc;
         }
-    });
+    }
 }
 
-void CumSum::parallelItInit(size_t start, std::vector<size_t>& counters, const std::vector<size_t>& iterationRange) {
-    auto itCounter = counters.rbegin();
-    auto itWork = iterationRange.rbegin();
-    while (itCounter != counters.rend() && itWork != iterationRange.rend()) {
-        *itCounter = start % *itWork;
-        start /= *itWork;
-        ++itCounter;
-        ++itWork;
+// Scan of 'lanes' independent contiguous lanes, rows along the axis are 'stride' elements apart.
+// The inner loops are over contiguous memory, so the lanes are processed by SIMD.
+template <bool reverse, bool exclusive, typename dataType>
+inline void scanLanes(const dataType *input, dataType *output, size_t len, size_t stride, size_t lanes) {
+    const ptrdiff_t step = reverse ? -static_cast<ptrdiff_t>(stride) : static_cast<ptrdiff_t>(stride);
+    const dataType *src = input + (reverse ? (len - 1) * stride : 0lu);
+    dataType *dst = output + (reverse ? (len - 1) * stride : 0lu);
+
+    if (exclusive) {
+        for (size_t l = 0; l < lanes; l++)
+            dst[l] = dataType(0);
+    } else {
+        for (size_t l = 0; l < lanes; l++)
+            dst[l] = src[l];
+    }
+    for (size_t i = 1; i < len; i++) {
+        const dataType *prevDst = dst;
+        const dataType *prevSrc = src;
+        src += step;
+        dst += step;
+        const dataType *addend = exclusive ? prevSrc : src;
+        DLSDK_EXT_IVDEP()
+        for (size_t l = 0; l < lanes; l++)
+            dst[l] = addend[l] + prevDst[l];
     }
 }
 
-inline void CumSum::parallelItStep(std::vector<size_t>& counters, const std::vector<size_t>& iterationRange) {
-    auto itCounter = counters.rbegin();
-    auto itWork = iterationRange.rbegin();
+// Two-pass parallel scan of a single long line: the first pass computes per block sums,
+// the second one scans every block starting from the carry of the preceding blocks.
+template <bool reverse, bool exclusive, typename dataType>
+void blockedScan(const dataType *input, dataType *output, size_t len, size_t blocksNum) {
+    std::vector<dataType> carries(blocksNum, dataType(0));
+    auto blockRange = [&](size_t block, size_t& begin, size_t& end) {
+        splitter(len, blocksNum, block, begin, end);
+    };
+
+    parallel_for(blocksNum, [&](size_t block) {
+        size_t begin = 0, end = 0;
+        blockRange(block, begin, end);
+        dataType sum(0);
+        for (size_t i = begin; i < end; i++)
+            sum = sum + input[i];
+        carries[block] = sum;
+    });
 
-    while (itCounter != counters.rend() && itWork != iterationRange.rend()) {
-        *itCounter = (*itCounter + 1) % *itWork;
-        if (*itCounter != 0) {
-            break;
-        }
-        ++itCounter;
-        ++itWork;
+    dataType carry(0);
+    for (size_t b = 0; b < blocksNum; b++) {
+        const size_t block = reverse ? blocksNum - 1 - b : b;
+        const dataType blockSum = carries[block];
+        carries[block] = carry;
+        carry = carry + blockSum;
     }
+
+    parallel_for(blocksNum, [&](size_t block) {
+        size_t begin = 0, end = 0;
+        blockRange(block, begin, end);
+        scanLine<reverse, exclusive>(input + begin, output + begin, end - begin, carries[block]);
+    });
 }
+}   // namespace
 
-inline size_t CumSum::getStartOffset(const std::vector<size_t> &forStartOffset, const std::vector<size_t>& strides) const {
-    size_t startOffset = 0;
-    for (size_t idx = 0; idx < forStartOffset.size(); ++idx) {
-        startOffset += forStartOffset[idx] * strides[idx];
+template <bool reverse, bool exclusive, typename dataType>
+void CumSum::cumSum(const dataType *input, dataType *output, const VectorDims &strides) {
+    const auto &shape = getParentEdgesAtPort(CUM_SUM_DATA)[0]->getMemory().getStaticDims();
+    const size_t axisDim = shape[axis];
+    const size_t innerSize = strides[axis];
+    const size_t outerSize = std::accumulate(shape.begin(), shape.begin() + axis, size_t{1}, std::multiplies<size_t>());
+    if (axisDim == 0lu || innerSize == 0lu || outerSize == 0lu)
+        return;
+    const size_t outerStride = axisDim * innerSize;
+
+    if (innerSize == 1lu) {
+        const size_t nthr = parallel_get_max_threads();
+        if (outerSize < nthr && axisDim >= 2 * blockedScanMinWork) {
+            // There are not enough lines to load all threads, so each line is split between threads.
+            const size_t blocksNum = std::min(nthr, axisDim / blockedScanMinWork);
+            for (size_t o = 0; o < outerSize; o++)
+                blockedScan<reverse, exclusive>(input + o * outerStride, output + o * outerStride, axisDim, blocksNum);
+        } else {
+            parallel_for(outerSize, [&](size_t o) {
+                scanLine<reverse, exclusive>(input + o * outerStride, output + o * outerStride, axisDim, dataType(0));
+            });
+        }
+    } else {
+        const size_t lanesBlocksNum = div_up(innerSize, lanesBlockSize);
+        parallel_for2d(outerSize, lanesBlocksNum, [&](size_t o, size_t lb) {
+            const size_t lanesStart = lb * lanesBlockSize;
+            const size_t lanes = std::min(lanesBlockSize, innerSize - lanesStart);
+            const size_t offset = o * outerStride + lanesStart;
+            scanLanes<reverse, exclusive>(input + offset, output + offset, axisDim, innerSize, lanes);
+        });
     }
-    return startOffset;
 }
 
 size_t CumSum::getAxis(const Memory& _axis, const Memory& _data) const {
@@ -32,12 +32,6 @@ private:
     template <bool reverse, bool exclusive, typename dataType>
     void cumSum(const dataType *input, dataType *output, const std::vector<size_t> &strides);
 
-    void parallelItInit(size_t start, std::vector<size_t>& counters, const std::vector<size_t>& iterationRange);
-
-    inline void parallelItStep(std::vector<size_t>& counters, const std::vector<size_t>& iterationRange);
-
-    inline size_t getStartOffset(const std::vector<size_t> &forStartOffset, const std::vector<size_t>& strides) const;
-
     size_t getAxis(const Memory& _axis, const Memory& _data) const;
 
     enum { CUM_SUM_DATA, AXIS, numOfInputs };
@@ -3,6 +3,7 @@
 //
 
 #include <cmath>
+#include <limits>
 #include <vector>
 #include <string>
 #include "ie_parallel.hpp"
@@ -13,6 +14,7 @@
 #include "common/cpu_memcpy.h"
 
 using namespace InferenceEngine;
+using namespace dnnl::impl::cpu;
 
 namespace ov {
 namespace intel_cpu {
@@ -70,6 +72,26 @@ void GatherElements::prepareParams() {
             strideAx1Diff_ *= dataDims[i];
         strideAx1Diff_ -= strideAxDst_ * dstDims[axis_];
     }
+    srcAxDim_ = dataDims[axis_];
+
+    // The kernel gathers along the innermost axis only and processes the output row by row,
+    // so it pays off when the row is not shorter than a vector.
+    const auto dataSizeB = std::accumulate(dataDims.begin(), dataDims.end(), static_cast<size_t>(1),
+                                           std::multiplies<size_t>()) * dataTypeSize_;
+    useJitKernel_ = jitKernel_ && static_cast<size_t>(axis_) == dataDims.size() - 1 &&
+                    static_cast<uint64_t>(dstAxDim_) >= jitKernel_->getIdxElPerVec() &&
+                    dataSizeB >= sizeof(uint32_t) && dataSizeB <= static_cast<size_t>(std::numeric_limits<int32_t>::max());
+
+    const auto& selectedPD = getSelectedPrimitiveDescriptor();
+    if (useJitKernel_) {
+        if (x64::mayiuse(x64::avx512_common)) {
+            selectedPD->setImplementationType(jit_avx512);
+        } else if (x64::mayiuse(x64::avx2)) {
+            selectedPD->setImplementationType(jit_avx2);
+        }
+    } else {
+        selectedPD->setImplementationType(ref_any);
+    }
 }
 
 void GatherElements::initSupportedPrimitiveDescriptors() {
@@ -97,6 +119,25 @@ void GatherElements::initSupportedPrimitiveDescriptors() {
                          impl_desc_type::ref_any);
 }
 
+void GatherElements::createPrimitive() {
+    // Gather instruction is not supported by SSE.
+    if (x64::mayiuse(x64::avx512_common) || x64::mayiuse(x64::avx2)) {
+        jGatherElwiseConfParams jcp;
+        jcp.dataTypeSize = dataTypeSize_;
+        jcp.sliceRank = 1lu;
+
+        if (x64::mayiuse(x64::avx512_common)) {
+            jitKernel_.reset(new jitUniGatherElwiseKernel<x64::avx512_common>(jcp));
+        } else if (x64::mayiuse(x64::avx2)) {
+            jitKernel_.reset(new jitUniGatherElwiseKernel<x64::avx2>(jcp));
+        }
+        if (jitKernel_)
+            jitKernel_->create_ker();
+    }
+
+    Node::createPrimitive();
+}
+
 void GatherElements::executeDynamicImpl(dnnl::stream strm) {
     execute(strm);
 }
@@ -134,7 +175,46 @@ void GatherElements::directExecution() {
     parallel_nt(0, threadBody);
 }
 
+void GatherElements::jitExecution() {
+    const auto *srcData = reinterpret_cast<const uint8_t *>(getParentEdgeAt(dataIndex_)->getMemoryPtr()->GetPtr());
+    const auto *indices = reinterpret_cast<const int *>(getParentEdgeAt(indicesIndex_)->getMemoryPtr()->GetPtr());
+    auto *dstData = reinterpret_cast<uint8_t *>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+
+    const size_t outSize = getChildEdgesAtPort(0)[0]->getMemory().GetShape().getElementsCount();
+    const size_t dstRowLen = dstAxDim_;
+    const size_t srcRowSizeB = srcAxDim_ * dataTypeSize_;
+    const size_t srcSizeB = getParentEdgeAt(dataIndex_)->getMemory().GetShape().getElementsCount() * dataTypeSize_;
+    const int srcShift = 1;
+
+    auto threadBody = [&](const int ithr, const int nthr) {
+        size_t start(0lu), end(0lu);
+        splitter(outSize, nthr, ithr, start, end);
+
+        auto arg = gatherElwiseJitExecArgs();
+        arg.srcShifts = &srcShift;
+        arg.sliceRank = 1lu;
+        while (start < end) {
+            const size_t row = start / dstRowLen;
+            const size_t rowWork = std::min(dstRowLen - start % dstRowLen, end - start);
+
+            arg.src = srcData + row * srcRowSizeB;
+            arg.srcSizeB = srcSizeB - row * srcRowSizeB;
+            arg.indices = indices + start;
+            arg.dst = dstData + start * dataTypeSize_;
+            arg.workAmount = rowWork;
+            (*jitKernel_)(&arg);
+
+            start += rowWork;
+        }
+    };
+
+    parallel_nt(0, threadBody);
+}
+
 void GatherElements::execute(dnnl::stream strm) {
+    if (useJitKernel_)
+        return jitExecution();
+
     switch (dataTypeSize_) {
         case sizeof(PrecisionTrait<Precision::I32>::value_type):
             return directExecution<PrecisionTrait<Precision::I32>::value_type>();
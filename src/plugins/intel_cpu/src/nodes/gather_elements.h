@@ -6,6 +6,7 @@
 
 #include <ie_common.h>
 #include <node.h>
+#include "kernels/gather_elwise_kernel.hpp"
 #include <string>
 #include <memory>
 #include <vector>
@@ -20,6 +21,7 @@ public:
 
     void getSupportedDescriptors() override {};
     void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
     void execute(dnnl::stream strm) override;
     bool created() const override;
 
@@ -38,10 +40,15 @@ private:
     int strideAxDst_ = 0;
     int dstAxDim_ = 0;
     int strideAx1Diff_ = 0;
+    int srcAxDim_ = 0;
+    bool useJitKernel_ = false;
     std::string errorPrefix_;
 
+    std::shared_ptr<jitGatherElwiseKernelBase> jitKernel_;
+
     template <typename dataType>
     void directExecution();
+    void jitExecution();
 };
 
 }   // namespace node
@@ -3,6 +3,7 @@
 //
 
 #include <cmath>
+#include <limits>
 #include <vector>
 #include <string>
 #include <dnnl_types.h>
@@ -14,6 +15,7 @@
 #include "common/cpu_memcpy.h"
 
 using namespace InferenceEngine;
+using namespace dnnl::impl::cpu;
 
 #define THROW_ERROR IE_THROW() << "GatherND layer with name '" << getName() << "' "
 
@@ -100,10 +102,40 @@ void GatherND::prepareParams() {
     attrs.srcStrides = srcMemPtr->GetDescWithType<BlockedMemoryDesc>()->getStrides();
     attrs.dstElementCount = dstMemPtr->GetShape().getElementsCount();
     attrs.sliceRank =  idxMemPtr->getStaticDims().back();
-    execPtr = std::make_shared<GatherNDExecutor>(attrs);
+    execPtr = std::make_shared<GatherNDExecutor>(attrs, jitKernel);
+
+    const auto& selectedPD = getSelectedPrimitiveDescriptor();
+    if (execPtr->isJitExecution()) {
+        if (x64::mayiuse(x64::avx512_common)) {
+            selectedPD->setImplementationType(jit_avx512);
+        } else if (x64::mayiuse(x64::avx2)) {
+            selectedPD->setImplementationType(jit_avx2);
+        }
+    } else {
+        selectedPD->setImplementationType(ref_any);
+    }
 }
 
-GatherND::GatherNDExecutor::GatherNDExecutor(const GatherNDAttributes& attrs) : dataSize(attrs.dataSize), sliceRank(attrs.sliceRank) {
+void GatherND::createPrimitive() {
+    // Gather instruction is not supported by SSE.
+    if (x64::mayiuse(x64::avx512_common) || x64::mayiuse(x64::avx2)) {
+        jGatherElwiseConfParams jcp;
+        jcp.dataTypeSize = attrs.dataSize;
+
+        if (x64::mayiuse(x64::avx512_common)) {
+            jitKernel.reset(new jitUniGatherElwiseKernel<x64::avx512_common>(jcp));
+        } else if (x64::mayiuse(x64::avx2)) {
+            jitKernel.reset(new jitUniGatherElwiseKernel<x64::avx2>(jcp));
+        }
+        if (jitKernel)
+            jitKernel->create_ker();
+    }
+
+    Node::createPrimitive();
+}
+
+GatherND::GatherNDExecutor::GatherNDExecutor(const GatherNDAttributes& attrs, const std::shared_ptr<jitGatherElwiseKernelBase>& kernel)
+        : dataSize(attrs.dataSize), sliceRank(attrs.sliceRank) {
     batchSize = std::accumulate(attrs.srcDims.begin(), attrs.srcDims.begin() + attrs.batchDims, 1lu, std::multiplies<size_t>());
     dataLength = std::accumulate(attrs.srcDims.begin() + sliceRank + attrs.batchDims, attrs.srcDims.end(), 1lu,
                                  std::multiplies<size_t>());
@@ -124,6 +156,12 @@ GatherND::GatherNDExecutor::GatherNDExecutor(const GatherNDAttributes& attrs) :
         dataLength *= dataSize;
         srcBatchStride *= dataSize;
         dstBatchStride *= dataSize;
+    } else if (kernel && sliceRank > 0lu && cycles >= kernel->getIdxElPerVec() &&
+               batchSize * srcBatchStride * dataSize >= sizeof(uint32_t) &&
+               srcBatchStride * dataSize <= static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+        // The kernel is called per batch, so it is used only if there are enough elements to fill a vector.
+        jitKernel = kernel;
+        jitSrcShifts.assign(srcShifts.begin(), srcShifts.end());
     }
 }
 
@@ -142,6 +180,11 @@ void GatherND::GatherNDExecutor::exec(const MemoryPtr& srcMemPtr, const MemoryPt
         return;
     }
 
+    if (jitKernel) {
+        gatherElementwiseJit(srcMemPtr, idxMemPtr, dstMemPtr);
+        return;
+    }
+
     GatherNDContext ctx { this, srcMemPtr, idxMemPtr, dstMemPtr };
     OV_SWITCH(intel_cpu, GatherNDEmitter, ctx, dataSize,
               OV_CASE(sizeof(PrecisionTrait<Precision::I32>::value_type), PrecisionTrait<Precision::I32>::value_type),
@@ -167,21 +210,66 @@ void GatherND::GatherNDExecutor::gatherBlocks(const MemoryPtr& srcMemPtr, const
         const int32_t* shiftedIndices = indices + bStart * idxBatchStride + cStart * sliceRank;
         uint8_t* shiftedDstData = dstData + bStart * dstBatchStride + cStart * dataLength;
 
+        // Slices which are adjacent in both source and destination are copied by a single memcpy.
+        const uint8_t* runSrc = nullptr;
+        uint8_t* runDst = shiftedDstData;
+        size_t runLength = 0lu;
+
         for (size_t b = bStart; b < batchSize; b++) {
             for (size_t j = cStart; j < cycles; j++) {
                 size_t dataIdx = 0lu;
                 for (size_t i = 0; i < sliceRank; i++)
                     dataIdx += srcShifts[i] * shiftedIndices[i];
-                cpu_memcpy(shiftedDstData, &(shiftedSrcData[dataIdx]), dataLength);
+                const uint8_t* sliceSrc = &(shiftedSrcData[dataIdx]);
+                if (sliceSrc != runSrc + runLength) {
+                    if (runLength > 0lu)
+                        cpu_memcpy(runDst, runSrc, runLength);
+                    runSrc = sliceSrc;
+                    runDst = shiftedDstData;
+                    runLength = 0lu;
+                }
+                runLength += dataLength;
                 shiftedDstData += dataLength;
                 shiftedIndices += sliceRank;
                 if (++workCounter == end) {
+                    cpu_memcpy(runDst, runSrc, runLength);
                     return;
                 }
             }
             cStart = 0;
             shiftedSrcData += srcBatchStride;
         }
+        if (runLength > 0lu)
+            cpu_memcpy(runDst, runSrc, runLength);
+    });
+}
+
+void GatherND::GatherNDExecutor::gatherElementwiseJit(const MemoryPtr& srcMemPtr, const MemoryPtr& idxMemPtr, MemoryPtr& dstMemPtr) {
+    const uint8_t* srcData = reinterpret_cast<const uint8_t*>(srcMemPtr->GetPtr());
+    const int32_t* indices = reinterpret_cast<const int32_t*>(idxMemPtr->GetPtr());
+    uint8_t* dstData = reinterpret_cast<uint8_t*>(dstMemPtr->GetPtr());
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start(0lu), end(0lu);
+        splitter(workAmount, nthr, ithr, start, end);
+
+        auto arg = gatherElwiseJitExecArgs();
+        arg.srcShifts = jitSrcShifts.data();
+        arg.sliceRank = sliceRank;
+        while (start < end) {
+            const size_t b = start / cycles;
+            const size_t c = start % cycles;
+            const size_t batchWork = std::min(cycles - c, end - start);
+
+            arg.src = srcData + b * srcBatchStride * dataSize;
+            arg.srcSizeB = (batchSize - b) * srcBatchStride * dataSize;
+            arg.indices = indices + b * idxBatchStride + c * sliceRank;
+            arg.dst = dstData + (b * dstBatchStride + c) * dataSize;
+            arg.workAmount = batchWork;
+            (*jitKernel)(&arg);
+
+            start += batchWork;
+        }
     });
 }
 
@@ -6,6 +6,7 @@
 
 #include <ie_common.h>
 #include <node.h>
+#include "kernels/gather_elwise_kernel.hpp"
 #include <string>
 #include <memory>
 #include <vector>
@@ -20,6 +21,7 @@ public:
 
     void getSupportedDescriptors() override {};
     void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
     void execute(dnnl::stream strm) override;
     bool created() const override;
 
@@ -41,13 +43,17 @@ private:
     } attrs;
 
     struct GatherNDExecutor {
-        GatherNDExecutor(const GatherNDAttributes& attrs);
+        GatherNDExecutor(const GatherNDAttributes& attrs, const std::shared_ptr<jitGatherElwiseKernelBase>& jitKernel);
         ~GatherNDExecutor() = default;
         void exec(const MemoryPtr& srcMemPtr, const MemoryPtr& idxMemPtr, MemoryPtr& dstMemPtr);
+        bool isJitExecution() const {
+            return jitKernel != nullptr;
+        }
 
     private:
         template <typename dataType>
         void gatherElementwise(const MemoryPtr& srcMemPtr, const MemoryPtr& idxMemPtr, MemoryPtr& dstMemPtr);
+        void gatherElementwiseJit(const MemoryPtr& srcMemPtr, const MemoryPtr& idxMemPtr, MemoryPtr& dstMemPtr);
         void gatherBlocks(const MemoryPtr& srcMemPtr, const MemoryPtr& idxMemPtr, MemoryPtr& dstMemPtr);
 
         size_t batchSize = 1lu;
@@ -62,6 +68,10 @@ private:
         size_t dstBatchStride = 1lu;
         VectorDims srcShifts;
 
+        // Set only if the elementwise case is supported by the kernel.
+        std::shared_ptr<jitGatherElwiseKernelBase> jitKernel;
+        std::vector<int> jitSrcShifts;
+
         struct GatherNDContext {
             GatherNDExecutor* executor;
             const MemoryPtr srcMemPtr;
@@ -82,6 +92,7 @@ private:
 
     using executorPtr = std::shared_ptr<GatherNDExecutor>;
     executorPtr execPtr = nullptr;
+    std::shared_ptr<jitGatherElwiseKernelBase> jitKernel;
 };
 
 }   // namespace node
@@ -0,0 +1,294 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <string>
+
+#include "ie_parallel.hpp"
+#include "image_preprocess.h"
+#include "utils/bfloat16.hpp"
+
+using namespace InferenceEngine;
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+bool ImagePreprocess::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        if (!std::dynamic_pointer_cast<const ImagePreprocessNode>(op)) {
+            errorMessage = "Only ImagePreprocess operation from cpu_plugin_opset is supported";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+ImagePreprocess::ImagePreprocess(const std::shared_ptr<ngraph::Node>& op, const dnnl::engine& eng,
+        WeightsSharing::Ptr &cache) : Node(op, eng, cache) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    errorPrefix = "ImagePreprocess node with name '" + op->get_friendly_name() + "'";
+    if (getOriginalInputsNumber() != 1 || getOriginalOutputsNumber() != 1)
+        IE_THROW() << errorPrefix << " has incorrect number of input/output edges!";
+
+    const auto preprocess = std::dynamic_pointer_cast<const ImagePreprocessNode>(op);
+    color = preprocess->get_color_conversion();
+    rgbOrder = color == ColorConversion::NV12_TO_RGB || color == ColorConversion::I420_TO_RGB;
+    colorRounding = preprocess->get_color_rounding();
+    planarInput = preprocess->is_planar_input();
+    planarOutput = preprocess->is_planar_output();
+    resize = !preprocess->get_output_size().empty();
+    originalChannelMap = preprocess->get_channel_map();
+    originalScale = preprocess->get_scale();
+    originalShift = preprocess->get_shift();
+}
+
+void ImagePreprocess::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    auto inputPrecision = getOriginalInputPrecisionAtPort(0);
+    if (inputPrecision != Precision::U8)
+        inputPrecision = Precision::FP32;
+    auto outputPrecision = getOriginalOutputPrecisionAtPort(0);
+    if (outputPrecision != Precision::BF16)
+        outputPrecision = Precision::FP32;
+
+    addSupportedPrimDesc({{LayoutType::ncsp, inputPrecision}},
+                         {{LayoutType::ncsp, outputPrecision}},
+                         impl_desc_type::ref_any);
+}
+
+ImagePreprocess::Taps ImagePreprocess::calculateTaps(size_t srcSize, size_t dstSize, bool resize) {
+    Taps taps;
+    taps.first.resize(dstSize);
+    taps.second.resize(dstSize);
+    taps.weight.resize(dstSize, 0.f);
+    if (!resize) {
+        for (size_t i = 0; i < dstSize; i++)
+            taps.first[i] = taps.second[i] = i;
+        return taps;
+    }
+
+    // half pixel coordinates transformation, the border taps are clamped
+    const float scale = static_cast<float>(dstSize) / static_cast<float>(srcSize);
+    for (size_t i = 0; i < dstSize; i++) {
+        const float coordinate = std::min(std::max((static_cast<float>(i) + 0.5f) / scale - 0.5f, 0.f),
+                                          static_cast<float>(srcSize - 1));
+        taps.first[i] = static_cast<size_t>(coordinate);
+        taps.second[i] = std::min(taps.first[i] + 1, srcSize - 1);
+        taps.weight[i] = coordinate - static_cast<float>(taps.first[i]);
+    }
+    return taps;
+}
+
+void ImagePreprocess::prepareParams() {
+    const auto& srcDims = getParentEdgeAt(0)->getMemory().getStaticDims();
+    const auto& dstDims = getChildEdgeAt(0)->getMemory().getStaticDims();
+    if (srcDims.size() != 4 || dstDims.size() != 4)
+        IE_THROW() << errorPrefix << " supports only 4D input and output";
+
+    N = srcDims[0];
+    if (color != ColorConversion::NONE) {
+        srcC = 3;
+        srcH = srcDims[1] * 2 / 3;
+        srcW = srcDims[2];
+    } else {
+        srcC = planarInput ? srcDims[1] : srcDims[3];
+        srcH = planarInput ? srcDims[2] : srcDims[1];
+        srcW = planarInput ? srcDims[3] : srcDims[2];
+    }
+    dstC = planarOutput ? dstDims[1] : dstDims[3];
+    dstH = planarOutput ? dstDims[2] : dstDims[1];
+    dstW = planarOutput ? dstDims[3] : dstDims[2];
+
+    channelMap.resize(dstC);
+    for (size_t c = 0; c < dstC; c++)
+        channelMap[c] = originalChannelMap.empty() ? c : static_cast<size_t>(originalChannelMap[c]);
+    scale = originalScale.empty() ? std::vector<float>(dstC, 1.f) : originalScale;
+    shift = originalShift.empty() ? std::vector<float>(dstC, 0.f) : originalShift;
+
+    yTaps = calculateTaps(srcH, dstH, resize);
+    xTaps = calculateTaps(srcW, dstW, resize);
+}
+
+void ImagePreprocess::yuvToRgb(float y, float u, float v, float* pixel) const {
+    const float c = y - 16.f;
+    const float d = u - 128.f;
+    const float e = v - 128.f;
+    auto clip = [&](float value) {
+        value = std::min(std::max(value, 0.f), 255.f);
+        return colorRounding ? std::round(value) : value;
+    };
+    const float r = clip(1.164f * c + 1.596f * e);
+    const float g = clip(1.164f * c - 0.391f * d - 0.813f * e);
+    const float b = clip(1.164f * c + 2.018f * d);
+    pixel[0] = rgbOrder ? r : b;
+    pixel[1] = g;
+    pixel[2] = rgbOrder ? b : r;
+}
+
+template <typename src_t>
+void ImagePreprocess::convertRow(const src_t* src, size_t n, size_t y, float* row) const {
+    // the color conversion is dispatched once per row, so the loops over the pixels have no branches
+    switch (color) {
+        case ColorConversion::NONE: {
+            if (planarInput) {
+                const src_t* data = src + n * srcC * srcH * srcW + y * srcW;
+                for (size_t c = 0; c < srcC; c++) {
+                    const src_t* plane = data + c * srcH * srcW;
+                    for (size_t x = 0; x < srcW; x++)
+                        row[x * srcC + c] = static_cast<float>(plane[x]);
+                }
+            } else {
+                const src_t* data = src + (n * srcH + y) * srcW * srcC;
+                for (size_t i = 0; i < srcW * srcC; i++)
+                    row[i] = static_cast<float>(data[i]);
+            }
+            break;
+        }
+        case ColorConversion::NV12_TO_RGB:
+        case ColorConversion::NV12_TO_BGR: {
+            const src_t* image = src + n * srcH * srcW * 3 / 2;
+            const src_t* luma = image + y * srcW;
+            const src_t* uv = image + srcH * srcW + (y / 2) * srcW;
+            for (size_t x = 0; x < srcW; x++)
+                yuvToRgb(static_cast<float>(luma[x]), static_cast<float>(uv[(x / 2) * 2]),
+                         static_cast<float>(uv[(x / 2) * 2 + 1]), row + x * 3);
+            break;
+        }
+        case ColorConversion::I420_TO_RGB:
+        case ColorConversion::I420_TO_BGR: {
+            const src_t* image = src + n * srcH * srcW * 3 / 2;
+            const src_t* luma = image + y * srcW;
+            const src_t* u = image + srcH * srcW + (y / 2) * (srcW / 2);
+            const src_t* v = image + 5 * srcH * srcW / 4 + (y / 2) * (srcW / 2);
+            for (size_t x = 0; x < srcW; x++)
+                yuvToRgb(static_cast<float>(luma[x]), static_cast<float>(u[x / 2]), static_cast<float>(v[x / 2]),
+                         row + x * 3);
+            break;
+        }
+    }
+}
+
+template <typename src_t, typename dst_t>
+void ImagePreprocess::executeImpl() {
+    const auto* src = reinterpret_cast<const src_t*>(getParentEdgeAt(0)->getMemoryPtr()->GetPtr());
+    auto* dst = reinterpret_cast<dst_t*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+
+    const size_t srcRowSize = srcW * srcC;
+    const size_t rowSize = dstW * srcC;
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        // the buffers are allocated once per thread: the converted source row (if resized), two rows resized
+        // along x (the top and the bottom taps) and their blend
+        const size_t convertedSize = resize ? srcRowSize : 0;
+        std::vector<float> buffer(convertedSize + 3 * rowSize);
+        float* converted = buffer.data();
+        float* rows[2] = {buffer.data() + convertedSize, buffer.data() + convertedSize + rowSize};
+        float* blended = buffer.data() + convertedSize + 2 * rowSize;
+        // the thread processes consecutive output rows, so a source row is converted once for all of them
+        size_t rowKeys[2] = {SIZE_MAX, SIZE_MAX};
+
+        auto loadRow = [&](size_t key, int slot) {
+            rowKeys[slot] = key;
+            if (!resize) {
+                convertRow(src, key / srcH, key % srcH, rows[slot]);
+                return;
+            }
+            convertRow(src, key / srcH, key % srcH, converted);
+            float* row = rows[slot];
+            for (size_t ox = 0; ox < dstW; ox++) {
+                const float* left = converted + xTaps.first[ox] * srcC;
+                const float* right = converted + xTaps.second[ox] * srcC;
+                const float wx = xTaps.weight[ox];
+                for (size_t c = 0; c < srcC; c++)
+                    row[ox * srcC + c] = left[c] + wx * (right[c] - left[c]);
+            }
+        };
+        auto findRow = [&](size_t key) {
+            return rowKeys[0] == key ? 0 : rowKeys[1] == key ? 1 : -1;
+        };
+
+        for_2d(ithr, nthr, N, dstH, [&](size_t n, size_t oy) {
+            const size_t topKey = n * srcH + yTaps.first[oy];
+            const size_t bottomKey = n * srcH + yTaps.second[oy];
+            int top = findRow(topKey);
+            int bottom = findRow(bottomKey);
+            if (top < 0) {
+                top = bottom == 0 ? 1 : 0;
+                loadRow(topKey, top);
+            }
+            if (bottomKey == topKey) {
+                bottom = top;
+            } else if (bottom < 0) {
+                bottom = top == 0 ? 1 : 0;
+                loadRow(bottomKey, bottom);
+            }
+
+            const float* row = rows[top];
+            if (bottom != top) {
+                const float* upper = rows[top];
+                const float* lower = rows[bottom];
+                const float wy = yTaps.weight[oy];
+                for (size_t i = 0; i < rowSize; i++)
+                    blended[i] = upper[i] + wy * (lower[i] - upper[i]);
+                row = blended;
+            }
+
+            if (planarOutput) {
+                for (size_t c = 0; c < dstC; c++) {
+                    const float* channel = row + channelMap[c];
+                    const float channelScale = scale[c];
+                    const float channelShift = shift[c];
+                    dst_t* out = dst + ((n * dstC + c) * dstH + oy) * dstW;
+                    for (size_t ox = 0; ox < dstW; ox++)
+                        out[ox] = static_cast<dst_t>(channel[ox * srcC] * channelScale + channelShift);
+                }
+            } else {
+                dst_t* out = dst + (n * dstH + oy) * dstW * dstC;
+                for (size_t ox = 0; ox < dstW; ox++) {
+                    const float* pixel = row + ox * srcC;
+                    for (size_t c = 0; c < dstC; c++)
+                        out[ox * dstC + c] = static_cast<dst_t>(pixel[channelMap[c]] * scale[c] + shift[c]);
+                }
+            }
+        });
+    });
+}
+
+void ImagePreprocess::execute(dnnl::stream strm) {
+    const auto inputPrecision = getParentEdgeAt(0)->getMemory().getDesc().getPrecision();
+    const auto outputPrecision = getChildEdgeAt(0)->getMemory().getDesc().getPrecision();
+    if (inputPrecision == Precision::U8 && outputPrecision == Precision::FP32) {
+        executeImpl<uint8_t, float>();
+    } else if (inputPrecision == Precision::U8 && outputPrecision == Precision::BF16) {
+        executeImpl<uint8_t, bfloat16_t>();
+    } else if (inputPrecision == Precision::FP32 && outputPrecision == Precision::FP32) {
+        executeImpl<float, float>();
+    } else if (inputPrecision == Precision::FP32 && outputPrecision == Precision::BF16) {
+        executeImpl<float, bfloat16_t>();
+    } else {
+        IE_THROW() << errorPrefix << " has unsupported precisions: " << inputPrecision.name() << " -> " << outputPrecision.name();
+    }
+}
+
+void ImagePreprocess::executeDynamicImpl(dnnl::stream strm) {
+    execute(strm);
+}
+
+bool ImagePreprocess::created() const {
+    return getType() == Type::ImagePreprocess;
+}
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,74 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <node.h>
+
+#include "ngraph_transformations/op/image_preprocess.hpp"
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+/**
+ * @brief Executes the preprocessing chain fused by FuseImagePreprocess in a single pass over the input image,
+ * so the color converted, resized and normalized intermediate tensors are never stored.
+ */
+class ImagePreprocess : public Node {
+public:
+    ImagePreprocess(const std::shared_ptr<ngraph::Node>& op, const dnnl::engine& eng, WeightsSharing::Ptr &cache);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void execute(dnnl::stream strm) override;
+    void executeDynamicImpl(dnnl::stream strm) override;
+    void prepareParams() override;
+    bool created() const override;
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    using ColorConversion = ImagePreprocessNode::ColorConversion;
+
+    // bilinear taps of every output coordinate along one spatial axis
+    struct Taps {
+        std::vector<size_t> first;
+        std::vector<size_t> second;
+        std::vector<float> weight;   // weight of the second tap
+    };
+
+    static Taps calculateTaps(size_t srcSize, size_t dstSize, bool resize);
+
+    template <typename src_t, typename dst_t>
+    void executeImpl();
+    // converts the source row to f32 pixels of srcC interleaved channels
+    template <typename src_t>
+    void convertRow(const src_t* src, size_t n, size_t y, float* row) const;
+    void yuvToRgb(float y, float u, float v, float* pixel) const;
+
+    ColorConversion color = ColorConversion::NONE;
+    bool rgbOrder = false;
+    bool colorRounding = false;
+    bool planarInput = false;
+    bool planarOutput = false;
+    bool resize = false;
+    std::vector<int64_t> originalChannelMap;
+    std::vector<float> originalScale;
+    std::vector<float> originalShift;
+
+    size_t N = 0, srcC = 0, srcH = 0, srcW = 0, dstC = 0, dstH = 0, dstW = 0;
+    std::vector<size_t> channelMap;
+    std::vector<float> scale;
+    std::vector<float> shift;
+    Taps yTaps;
+    Taps xTaps;
+
+    std::string errorPrefix;
+};
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
@@ -268,7 +268,7 @@ void Input::cloneBlobIfRequired() {
             memcpy(memory.GetPtr(), constOp->get_data_ptr(), constOp->get_byte_size());
         }
 
-        MemoryPtr ptr = MemoryPtr(new Memory(getEngine()));
+        MemoryPtr ptr = MemoryPtr(new Memory(getEngine(), weightCache ? weightCache->getMemoryAllocator() : nullptr));
         ptr->Create(memDesc);
         ptr->SetData(memory);
 
@@ -0,0 +1,264 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "gather_elwise_kernel.hpp"
+#include <ie_common.h>
+
+using namespace dnnl::impl::cpu;
+
+namespace ov {
+namespace intel_cpu {
+
+const unsigned jitGatherElwiseKernelBase::shufMask8bitUni[16]  = {0x0C080400, 0x80808080, 0x80808080, 0x80808080, 0x0C080400, 0x80808080, 0x80808080, 0x80808080,
+                                                                  0x0C080400, 0x80808080, 0x80808080, 0x80808080, 0x0C080400, 0x80808080, 0x80808080, 0x80808080};
+const unsigned jitGatherElwiseKernelBase::permMask8bitA2[8]    = {0, 4, 1, 5, 2, 6, 3, 7};
+
+const unsigned jitGatherElwiseKernelBase::shufMask16bitUni[16] = {0x05040100, 0x0D0C0908, 0x80808080, 0x80808080, 0x05040100, 0x0D0C0908, 0x80808080, 0x80808080,
+                                                                  0x05040100, 0x0D0C0908, 0x80808080, 0x80808080, 0x05040100, 0x0D0C0908, 0x80808080, 0x80808080};
+const unsigned jitGatherElwiseKernelBase::permMask16bitA2[8]   = {0, 1, 4, 5, 2, 3, 6, 7};
+
+const unsigned jitGatherElwiseKernelBase::incVec[16] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+
+#define GET_OFF(field) offsetof(gatherElwiseJitExecArgs, field)
+
+template <x64::cpu_isa_t isa>
+jitUniGatherElwiseKernel<isa>::jitUniGatherElwiseKernel(const jGatherElwiseConfParams& jcp) :
+        jitGatherElwiseKernelBase(jcp), x64::jit_generator() {
+    vlen = x64::cpu_isa_traits<isa>::vlen;
+    idxElPerVec = vlen / indicesTypeSize;
+    if (jcp.dataTypeSize == 2)
+        dataTypeShift = 1;
+    else if (jcp.dataTypeSize == 4)
+        dataTypeShift = 2;
+}
+
+template <x64::cpu_isa_t isa>
+void jitUniGatherElwiseKernel<isa>::create_ker() {
+    auto code = x64::jit_generator::create_kernel();
+    if (code != dnnl::impl::status::success)
+        IE_THROW() << "Could not create elementwise Gather kernel. Error code: " << std::to_string(code);
+    ker_ = (decltype(ker_))jit_ker();
+}
+
+template <x64::cpu_isa_t isa>
+void jitUniGatherElwiseKernel<isa>::generate() {
+    this->preamble();
+
+    mov(regSrc, ptr[regParams + GET_OFF(src)]);
+    mov(regDst, ptr[regParams + GET_OFF(dst)]);
+    mov(regIndices, ptr[regParams + GET_OFF(indices)]);
+    mov(regSrcShifts, ptr[regParams + GET_OFF(srcShifts)]);
+    mov(regWorkAmount, ptr[regParams + GET_OFF(workAmount)]);
+
+    Xbyak::Xmm xmmAux = Xbyak::Xmm(vmmAux.getIdx());
+
+    uni_vpxor(vmmZeros, vmmZeros, vmmZeros);
+    mov(regAux1, reinterpret_cast<uintptr_t>(incVec));
+    uni_vmovups(vmmIncVec, ptr[regAux1]);
+
+    // Offsets of the lanes index tuples: laneIdx * sliceRank * idxTypeSize.
+    if (jcp.sliceRank == 0lu) {
+        mov(regSliceRank, ptr[regParams + GET_OFF(sliceRank)]);
+        mov(regIdxStepB, regSliceRank);
+        shl(regIdxStepB, idxTypeShift);
+    } else {
+        mov(regIdxStepB, jcp.sliceRank * indicesTypeSize);
+    }
+    uni_vmovd(xmmAux, Xbyak::Reg32(regIdxStepB.getIdx()));
+    uni_vpbroadcastd(vmmIdxLaneOffsetsB, xmmAux);
+    uni_vpmulld(vmmIdxLaneOffsetsB, vmmIdxLaneOffsetsB, vmmIncVec);
+    imul(regIdxStepB, regIdxStepB, idxElPerVec);
+
+    if (jcp.dataTypeSize != 4) {
+        // Offset of the last dword of the source.
+        mov(regAux1, ptr[regParams + GET_OFF(srcSizeB)]);
+        sub(regAux1, 4);
+        uni_vmovd(xmmAux, reg32Aux1);
+        uni_vpbroadcastd(vmmSrcLastB, xmmAux);
+    }
+
+    if (isa == x64::avx2 && jcp.dataTypeSize != 4) {
+        mov(regAux1, reinterpret_cast<uintptr_t>(jcp.dataTypeSize == 2 ? shufMask16bitUni : shufMask8bitUni));
+        uni_vmovups(vmmShufMask, ptr[regAux1]);
+        mov(regAux1, reinterpret_cast<uintptr_t>(jcp.dataTypeSize == 2 ? permMask16bitA2 : permMask8bitA2));
+        uni_vmovups(vmmPermMask, ptr[regAux1]);
+    }
+
+    Xbyak::Label lDstIdxLoop, lTail, lEnd;
+    L(lDstIdxLoop);
+    {
+        cmp(regWorkAmount, idxElPerVec);
+        jl(lTail, T_NEAR);
+
+        calcSrcShifts(false);
+        gatherData(false);
+        storePacked();
+
+        add(regIndices, regIdxStepB);
+        add(regDst, idxElPerVec * jcp.dataTypeSize);
+        sub(regWorkAmount, idxElPerVec);
+        jmp(lDstIdxLoop, T_NEAR);
+    }
+
+    L(lTail);
+    {
+        cmp(regWorkAmount, 0);
+        jle(lEnd, T_NEAR);
+
+        uni_vmovd(xmmAux, Xbyak::Reg32(regWorkAmount.getIdx()));
+        uni_vpbroadcastd(vmmWorkRest, xmmAux);
+
+        calcSrcShifts(true);
+        gatherData(true);
+        storeVectorPart(regDst, regWorkAmount, vmmData, vmmAux);
+    }
+    L(lEnd);
+
+    this->postamble();
+}
+
+template <>
+void jitUniGatherElwiseKernel<x64::avx2>::uniVpGatherDd(Vmm& vDst, const Xbyak::Address& srcAddr, Vmask& kMask) {
+    vpgatherdd(vDst, srcAddr, kMask);
+}
+template <>
+void jitUniGatherElwiseKernel<x64::avx512_common>::uniVpGatherDd(Vmm& vDst, const Xbyak::Address& srcAddr, Vmask& kMask) {
+    vpgatherdd(vDst | kMask, srcAddr);
+}
+
+// The gather instruction zeroes its mask, so the mask has to be filled before each gather.
+template <>
+void jitUniGatherElwiseKernel<x64::avx2>::fillGatherMask(bool isTail) {
+    if (isTail)
+        vpcmpgtd(kGatherMask, vmmWorkRest, vmmIncVec);
+    else
+        vpcmpeqd(kGatherMask, kGatherMask, kGatherMask);
+}
+template <>
+void jitUniGatherElwiseKernel<x64::avx512_common>::fillGatherMask(bool isTail) {
+    if (isTail)
+        vpcmpgtd(kGatherMask, vmmWorkRest, vmmIncVec);
+    else
+        kxnorw(kGatherMask, kGatherMask, kGatherMask);
+}
+
+// Returns source shifts in bytes in vmmSrcShiftsB.
+template <x64::cpu_isa_t isa>
+void jitUniGatherElwiseKernel<isa>::calcSrcShifts(bool isTail) {
+    if (jcp.sliceRank == 1lu) {
+        // Indices are contiguous, so there is no need to gather them.
+        if (isTail) {
+            fillGatherMask(true);
+            uni_vmovups(vmmIdx, vmmZeros);
+            uniVpGatherDd(vmmIdx, ptr[regIndices + vmmIdxLaneOffsetsB], kGatherMask);
+        } else {
+            uni_vmovups(vmmIdx, ptr[regIndices]);
+        }
+        uni_vpbroadcastd(vmmShift, ptr[regSrcShifts]);
+        uni_vpmulld(vmmSrcShiftsB, vmmIdx, vmmShift);
+    } else {
+        uni_vpxor(vmmSrcShiftsB, vmmSrcShiftsB, vmmSrcShiftsB);
+        mov(regIdxIter, regIndices);
+        mov(regShiftIter, regSrcShifts);
+        if (jcp.sliceRank == 0lu)
+            mov(regRankCounter, regSliceRank);
+        else
+            mov(regRankCounter, jcp.sliceRank);
+
+        Xbyak::Label lRankLoop;
+        L(lRankLoop);
+        {
+            fillGatherMask(isTail);
+            uni_vmovups(vmmIdx, vmmZeros);
+            uniVpGatherDd(vmmIdx, ptr[regIdxIter + vmmIdxLaneOffsetsB], kGatherMask);
+            uni_vpbroadcastd(vmmShift, ptr[regShiftIter]);
+            uni_vpmulld(vmmIdx, vmmIdx, vmmShift);
+            uni_vpaddd(vmmSrcShiftsB, vmmSrcShiftsB, vmmIdx);
+
+            add(regIdxIter, indicesTypeSize);
+            add(regShiftIter, sizeof(int));
+            dec(regRankCounter);
+            jnz(lRankLoop, T_NEAR);
+        }
+    }
+    // Multiply by data type size.
+    if (jcp.dataTypeSize > 1)
+        uni_vpslld(vmmSrcShiftsB, vmmSrcShiftsB, dataTypeShift);
+}
+
+// Returns gathered data in vmmData. For 8 and 16 bit data types every dword contains the element in the lower bytes.
+template <x64::cpu_isa_t isa>
+void jitUniGatherElwiseKernel<isa>::gatherData(bool isTail) {
+    fillGatherMask(isTail);
+    uni_vmovups(vmmData, vmmZeros);
+    if (jcp.dataTypeSize == 4) {
+        uniVpGatherDd(vmmData, ptr[regSrc + vmmSrcShiftsB], kGatherMask);
+        return;
+    }
+
+    // The dword of an element in the last 3 bytes of the source would be read past its end, so such elements
+    // are read by the last dword of the source and shifted to the lower bytes.
+    vpminsd(vmmSrcClampedB, vmmSrcShiftsB, vmmSrcLastB);
+    vpsubd(vmmSrcShiftsB, vmmSrcShiftsB, vmmSrcClampedB);
+    vpslld(vmmSrcShiftsB, vmmSrcShiftsB, 3);
+    uniVpGatherDd(vmmData, ptr[regSrc + vmmSrcClampedB], kGatherMask);
+    vpsrlvd(vmmData, vmmData, vmmSrcShiftsB);
+}
+
+template <x64::cpu_isa_t isa>
+void jitUniGatherElwiseKernel<isa>::storePacked() {
+    if (jcp.dataTypeSize == 4) {
+        uni_vmovups(ptr[regDst], vmmData);
+        return;
+    }
+
+    if (isa == x64::avx512_common) {
+        if (jcp.dataTypeSize == 2)
+            vpmovdw(ptr[regDst], vmmData);
+        else
+            vpmovdb(ptr[regDst], vmmData);
+    } else {
+        Xbyak::Xmm xmmData = Xbyak::Xmm(vmmData.getIdx());
+        vpshufb(vmmData, vmmData, vmmShufMask);
+        vpermd(vmmData, vmmPermMask, vmmData);
+        if (jcp.dataTypeSize == 2)
+            uni_vmovups(ptr[regDst], xmmData);
+        else
+            vmovq(ptr[regDst], xmmData);
+    }
+}
+
+template <x64::cpu_isa_t isa>
+void jitUniGatherElwiseKernel<isa>::storeVectorPart(const Xbyak::Reg64& rDst, const Xbyak::Reg64& rToStoreCounter, Vmm& vmmSrc, Vmm& vAux) {
+    Xbyak::Label lEnd;
+    Xbyak::Xmm xAux(vAux.getIdx());
+    for (int j = 0; j < vlen / vlenXmm; j++) {
+        if (isa == x64::avx2)
+            vextracti128(xAux, vmmSrc, j);
+        else if (isa == x64::avx512_common)
+            vextracti32x4(xAux, vmmSrc, j);
+
+        for (int k = 0; k < 4; k++) {
+            cmp(rToStoreCounter, 0);
+            jle(lEnd, T_NEAR);
+
+            if (jcp.dataTypeSize == 4)
+                uni_vpextrd(ptr[rDst], xAux, k);
+            else if (jcp.dataTypeSize == 2)
+                uni_vpextrw(ptr[rDst], xAux, k * 2);
+            else if (jcp.dataTypeSize == 1)
+                uni_vpextrb(ptr[rDst], xAux, k * 4);
+
+            add(rDst, jcp.dataTypeSize);
+            sub(rToStoreCounter, 1);
+        }
+    }
+    L(lEnd);
+}
+
+template struct jitUniGatherElwiseKernel<x64::avx2>;
+template struct jitUniGatherElwiseKernel<x64::avx512_common>;
+
+}   // namespace intel_cpu
+}   // namespace ov
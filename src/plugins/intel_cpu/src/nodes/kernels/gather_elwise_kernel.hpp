@@ -0,0 +1,135 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// Elementwise gather kernel is shared by GatherND and GatherElements nodes.
+// It processes a contiguous run of 'workAmount' output elements which are taken from the same source base pointer:
+//     dst[j] = src[sum_i(indices[j * sliceRank + i] * srcShifts[i])], i in [0, sliceRank)
+// 1. GatherElements along the innermost axis is the case sliceRank == 1, srcShifts = {1}, the source base is the row start.
+// 2. GatherND without a contiguous slice (elementwise case) uses sliceRank index tuples and the source strides as shifts,
+//    the source base is the batch start.
+// Source offsets are calculated in 32-bit integers, so the caller is responsible for the source size in bytes fitting int32.
+// 8 and 16 bit elements are gathered by dwords, the elements in the last 3 bytes of the source are read by the last dword
+// and shifted down, so 'srcSizeB' (bytes readable from the source base) must be at least 4.
+//
+//                    SUPPORTED CASES
+//--------------------------------------------------------------
+//             |         AVX512        |         AVX2          |
+//             | 32bit | 16bit |  8bit | 32bit | 16bit |  8bit |
+//  elementwise|   X   |   X   |   X   |   X   |   X   |   X   |
+//--------------------------------------------------------------
+
+
+#pragma once
+
+#include "cpu/x64/jit_generator.hpp"
+#include <dnnl_types.h>
+
+namespace ov {
+namespace intel_cpu {
+
+struct jGatherElwiseConfParams {
+    uint64_t dataTypeSize = 1lu;
+    // Compile time slice rank. Zero means the slice rank is taken from the arguments at runtime.
+    uint64_t sliceRank = 0lu;
+};
+
+struct gatherElwiseJitExecArgs {
+    const void* src;
+    const void* indices;
+    void* dst;
+    const int* srcShifts;
+    uint64_t sliceRank = 1lu;
+    uint64_t workAmount = 0lu;
+    uint64_t srcSizeB = 0lu;
+};
+
+struct jitGatherElwiseKernelBase {
+    void (*ker_)(const gatherElwiseJitExecArgs *);
+    void operator()(const gatherElwiseJitExecArgs *args) {
+        assert(ker_);
+        ker_(args);
+    }
+    explicit jitGatherElwiseKernelBase(const jGatherElwiseConfParams& jcp) : ker_(nullptr), jcp(jcp) {}
+    virtual ~jitGatherElwiseKernelBase() {}
+
+    virtual void create_ker() = 0;
+    uint64_t getIdxElPerVec() const {
+        return idxElPerVec;
+    }
+
+protected:
+    jGatherElwiseConfParams jcp;
+    uint64_t vlen = 0lu;
+    uint64_t idxElPerVec = 0lu;
+    static const unsigned shufMask8bitUni[16];
+    static const unsigned permMask8bitA2[8];
+    static const unsigned shufMask16bitUni[16];
+    static const unsigned permMask16bitA2[8];
+    static const unsigned incVec[16];
+};
+
+template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+struct jitUniGatherElwiseKernel : public jitGatherElwiseKernelBase, public dnnl::impl::cpu::x64::jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jitUniGatherElwiseKernel)
+
+    explicit jitUniGatherElwiseKernel(const jGatherElwiseConfParams& jcp);
+
+    void create_ker() override;
+    void generate() override;
+
+protected:
+    using Vmm = typename dnnl::impl::utils::conditional<isa == dnnl::impl::cpu::x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    using Vmask = typename dnnl::impl::utils::conditional<isa == dnnl::impl::cpu::x64::avx2, Xbyak::Ymm, Xbyak::Opmask>::type;
+    static const uint32_t vlenXmm = dnnl::impl::cpu::x64::cpu_isa_traits<dnnl::impl::cpu::x64::sse41>::vlen;
+    static const uint32_t indicesTypeSize = sizeof(uint32_t);
+    static const uint8_t idxTypeShift = 2;
+    uint8_t dataTypeShift = 0;
+
+    // Suffix B means "In Bytes".
+    // 64b registers.
+    const Xbyak::Reg64& regSrc = r8;
+    const Xbyak::Reg64& regDst = r9;
+    const Xbyak::Reg64& regIndices = r10;
+    const Xbyak::Reg64& regWorkAmount = r11;
+    const Xbyak::Reg64& regSrcShifts = r12;
+    const Xbyak::Reg64& regSliceRank = r13;
+    const Xbyak::Reg64& regIdxStepB = r14;
+    const Xbyak::Reg64& regAux1 = r15;
+    const Xbyak::Reg64& regIdxIter = rax;
+    const Xbyak::Reg64& regShiftIter = rdx;
+    const Xbyak::Reg64& regRankCounter = rbx;
+
+    const Xbyak::Reg64& regParams = dnnl::impl::cpu::x64::abi_param1;
+
+    // 32b registers.
+    Xbyak::Reg32 reg32Aux1 = Xbyak::Reg32(regAux1.getIdx());
+
+    // Masks. Do not use k0 with gather instruction!
+    Vmask kGatherMask = Vmask(isa == dnnl::impl::cpu::x64::avx2 ? 12 : 1);
+
+    Vmm vmmZeros = Vmm(0);
+    Vmm vmmIdxLaneOffsetsB = Vmm(1);
+    Vmm vmmSrcShiftsB = Vmm(2);
+    Vmm vmmIdx = Vmm(3);
+    Vmm vmmShift = Vmm(4);
+    Vmm vmmData = Vmm(5);
+    Vmm vmmIncVec = Vmm(6);
+    Vmm vmmWorkRest = Vmm(7);
+    Vmm vmmShufMask = Vmm(8);
+    Vmm vmmPermMask = Vmm(9);
+    Vmm vmmAux = Vmm(10);
+    Vmm vmmSrcLastB = Vmm(11);
+    Vmm vmmSrcClampedB = Vmm(13);
+
+    void calcSrcShifts(bool isTail);
+    void gatherData(bool isTail);
+    void storePacked();
+    void storeVectorPart(const Xbyak::Reg64& rDst, const Xbyak::Reg64& rToStoreCounter, Vmm& vmmSrc, Vmm& vAux);
+    // Aux functions.
+    void fillGatherMask(bool isTail);
+    void uniVpGatherDd(Vmm& vDst, const Xbyak::Address& srcAddr, Vmask& vMask);
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
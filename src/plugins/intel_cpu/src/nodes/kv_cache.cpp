@@ -0,0 +1,177 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <numeric>
+#include <string>
+
+#include "kv_cache.h"
+#include "common/cpu_memcpy.h"
+#include "ie_parallel.hpp"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "ngraph_transformations/op/kv_cache.hpp"
+
+using namespace InferenceEngine;
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+bool KVCache::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        if (!std::dynamic_pointer_cast<const KVCacheNode>(op)) {
+            errorMessage = "Only KVCache operation from cpu_plugin_opset is supported";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+KVCache::KVCache(const std::shared_ptr<ngraph::Node>& op, const dnnl::engine& eng, WeightsSharing::Ptr &cache)
+        : Node(op, eng, cache) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    errorPrefix = "KVCache node with name '" + op->get_friendly_name() + "'";
+    if (getOriginalInputsNumber() != 1 || getOriginalOutputsNumber() != 1)
+        IE_THROW() << errorPrefix << " has incorrect number of input/output edges!";
+
+    const auto kvCache = std::dynamic_pointer_cast<const KVCacheNode>(op);
+    variableId = kvCache->get_variable_id();
+    // Remove suffix with pair ID. Internal information.
+    const auto suffixIdx = variableId.find("/id=");
+    if (suffixIdx != std::string::npos)
+        variableId = variableId.substr(0, suffixIdx);
+    axis = static_cast<size_t>(kvCache->get_axis());
+
+    stateMngr = new StateMemoryMngr();
+    memMngr = std::make_shared<DnnlMemoryMngr>(std::unique_ptr<IMemoryMngr>(stateMngr));
+    // the own state is used until the state of an infer request is bound
+    stateMngr->state = makeState();
+}
+
+void KVCache::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    const auto precision = getOriginalOutputPrecisionAtPort(0);
+    addSupportedPrimDesc({{LayoutType::ncsp, precision}},
+                         {{LayoutType::ncsp, precision}},
+                         impl_desc_type::unknown);
+}
+
+void KVCache::resolveInPlaceEdges() {
+    // The output memory is the storage of the bound state, it's moved when the storage grows or another state is bound,
+    // so the consumers prepare the params again.
+    const auto& desc = getSelectedPrimitiveDescriptor()->getConfig().outConfs[0].getMemDesc();
+    for (auto& childEdge : getChildEdgesAtPort(0)) {
+        childEdge->getChild()->setRelocatableMemory();
+        childEdge->getMemoryPtr().reset(new Memory(getEngine()));
+        childEdge->getMemoryPtr()->Create(desc, memMngr);
+        childEdge->changeStatus(Edge::Status::Allocated);
+    }
+}
+
+std::shared_ptr<KVCacheState> KVCache::makeState() const {
+    auto dims = getOutputShapeAtPort(0).getDims();
+    for (auto& dim : dims) {
+        if (dim == Shape::UNDEFINED_DIM)
+            dim = 0;
+    }
+    dims[axis] = 0;
+    return std::make_shared<KVCacheState>(variableId, getOriginalOutputPrecisionAtPort(0), dims, axis);
+}
+
+void KVCache::bindState(const std::shared_ptr<KVCacheState>& state) {
+    if (stateMngr->state == state)
+        return;
+    stateMngr->state = state;
+    updateStatePtr();
+}
+
+void KVCache::updateStatePtr() {
+    void* ptr = stateMngr->getRawPtr();
+    if (ptr != stateMngr->lastPtr) {
+        stateMngr->lastPtr = ptr;
+        memMngr->notifyUpdate();
+    }
+}
+
+void KVCache::execute(dnnl::stream strm) {
+    const auto& srcMemory = getParentEdgeAt(0)->getMemory();
+    const auto& srcDims = srcMemory.getStaticDims();
+    const auto& state = stateMngr->state;
+    auto dims = state->getDims();
+    const size_t stored = dims[axis];
+    if (srcDims.size() != dims.size())
+        IE_THROW() << errorPrefix << " has the input rank different from the rank of the state";
+    for (size_t i = 0; i < dims.size(); i++) {
+        if (i != axis && stored > 0 && srcDims[i] != dims[i])
+            IE_THROW() << errorPrefix << " has the input shape incompatible with the stored values";
+    }
+    dims = srcDims;
+    dims[axis] = stored + srcDims[axis];
+
+    // the storage is moved by SetState or when the headroom is exhausted, the stored values are moved with it
+    state->reserve(dims);
+    state->setDims(dims);
+    updateStatePtr();
+
+    // the output is the storage in the layout of the variable, the slices before the axis are apart by the headroom
+    const auto precision = srcMemory.getDesc().getPrecision();
+    VectorDims order(dims.size());
+    std::iota(order.begin(), order.end(), 0);
+    const auto shape = Shape(dims);
+    const auto desc = std::make_shared<CpuBlockedMemoryDesc>(precision, shape, dims, order, 0, VectorDims{},
+                                                             shape.hasZeroDims() ? VectorDims{} : state->getStrides());
+    for (auto& childEdge : getChildEdgesAtPort(0))
+        childEdge->getMemoryPtr()->redefineDesc(desc);
+
+    const auto slices = std::accumulate(srcDims.begin(), srcDims.begin() + axis, size_t{1}, std::multiplies<size_t>());
+    const auto rowSize = std::accumulate(srcDims.begin() + axis + 1, srcDims.end(), precision.size(), std::multiplies<size_t>());
+    const auto sliceSize = srcDims[axis] * rowSize;
+    if (sliceSize > 0) {
+        const auto capacity = state->getCapacity();
+        const auto src = static_cast<const uint8_t*>(srcMemory.GetPtr());
+        auto dst = static_cast<uint8_t*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+        parallel_for(slices, [&](size_t i) {
+            cpu_memcpy(dst + (i * capacity + stored) * rowSize, src + i * sliceSize, sliceSize);
+        });
+    }
+}
+
+void KVCache::executeDynamicImpl(dnnl::stream strm) {
+    execute(strm);
+}
+
+bool KVCache::created() const {
+    return getType() == Type::KVCache;
+}
+
+void* KVCache::StateMemoryMngr::getRawPtr() const noexcept {
+    return state->getStorage()->getRawPtr();
+}
+
+void KVCache::StateMemoryMngr::setExtBuff(void* ptr, size_t size) {
+    IE_THROW() << "The memory of the KV cache state can't be bound to an external buffer";
+}
+
+bool KVCache::StateMemoryMngr::resize(size_t size) {
+    state->getStorage()->resize(size);
+    void* ptr = getRawPtr();
+    const bool moved = ptr != lastPtr;
+    lastPtr = ptr;
+    return moved;
+}
+
+bool KVCache::StateMemoryMngr::hasExtBuffer() const noexcept {
+    return false;
+}
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,78 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <node.h>
+#include "memory_state.h"
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+/**
+ * @brief Appends the input to the bound KV cache state and outputs the whole state. The output memory is the storage
+ * of the state, so neither the stored values nor the state itself are copied on inference. The output is not dense
+ * if the dimensions before the axis are not 1, since every slice keeps a headroom, so the consumers read it by strides.
+ */
+class KVCache : public Node {
+public:
+    KVCache(const std::shared_ptr<ngraph::Node>& op, const dnnl::engine& eng, WeightsSharing::Ptr &cache);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void resolveInPlaceEdges() override;
+    void execute(dnnl::stream strm) override;
+    void executeDynamicImpl(dnnl::stream strm) override;
+    bool created() const override;
+    // the stored values are output even if no values are appended
+    bool isExecutable() const override {
+        return true;
+    }
+    bool needShapeInfer() const override {
+        return false;
+    }
+    bool needPrepareParams() const override {
+        return false;
+    }
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+    const std::string& getVariableId() const {
+        return variableId;
+    }
+
+    std::shared_ptr<KVCacheState> makeState() const;
+    // binds the state of the infer request, the state is updated by the next inferences
+    void bindState(const std::shared_ptr<KVCacheState>& state);
+
+private:
+    // forwards to the storage of the bound state, the memory is notified when the storage is moved or replaced
+    class StateMemoryMngr : public IMemoryMngr {
+    public:
+        void* getRawPtr() const noexcept override;
+        void setExtBuff(void* ptr, size_t size) override;
+        bool resize(size_t size) override;
+        bool hasExtBuffer() const noexcept override;
+
+        std::shared_ptr<KVCacheState> state;
+        void* lastPtr = nullptr;
+    };
+
+    // notifies the output memory if the storage of the bound state is moved
+    void updateStatePtr();
+
+    std::string variableId;
+    size_t axis = 0;
+
+    StateMemoryMngr* stateMngr = nullptr;
+    DnnlMemoryMngrPtr memMngr;
+
+    std::string errorPrefix;
+};
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
@@ -210,14 +210,19 @@ Node::AttrPtr MatMul::initPrimitiveAttr() {
  * oneDNN requires memory::desc for this input to:
  * - change shapes configuration as if input already transposed (2x128x512) -> (2x512x128)
  * - provide transposed strides (66536, 128, 1) -> (66536, 1, 512)
+ * The strides of the input memory are used if it's not dense, e.g. the KV cache with a headroom along the sequence axis.
  */
-static VectorDims getStridesAndModifyShape(Shape& shape, const bool transpose) {
+static VectorDims getStridesAndModifyShape(Shape& shape, const bool transpose, const VectorDims& memoryStrides = {}) {
     const auto getRank = shape.getRank();
 
     VectorDims strides(getRank, 1);
     const auto& staticDims = shape.getStaticDims();
-    for (size_t i = 1; i < getRank; i++) {
-        strides[getRank - i - 1 ] = strides[getRank - i] * staticDims[getRank - i];
+    if (!memoryStrides.empty() && !shape.hasZeroDims()) {
+        strides = memoryStrides;
+    } else {
+        for (size_t i = 1; i < getRank; i++) {
+            strides[getRank - i - 1 ] = strides[getRank - i] * staticDims[getRank - i];
+        }
     }
 
     if (transpose && getRank > 1) {
@@ -226,8 +231,7 @@ static VectorDims getStridesAndModifyShape(Shape& shape, const bool transpose) {
         std::swap(dims[getRank - 2], dims[getRank - 1]);
         shape = Shape{dims};
         // update strides
-        strides[getRank - 1] = staticDims[getRank - 2];
-        strides[getRank - 2] = 1;
+        std::swap(strides[getRank - 2], strides[getRank - 1]);
     }
 
     return strides;
@@ -502,11 +506,13 @@ void MatMul::prepareParams() {
         const auto& src1Desc = src1MemPtr->getDesc();
 
         auto src0Shape = src0Desc.getShape();
-        auto src0Strides = getStridesAndModifyShape(src0Shape, transposeIn[0]);
+        auto src0Strides = getStridesAndModifyShape(src0Shape, transposeIn[0],
+                                                    src0MemPtr->GetDescWithType<BlockedMemoryDesc>()->getStrides());
         src0TransposedDesc = std::make_shared<DnnlBlockedMemoryDesc>(src0Desc.getPrecision(), src0Shape, src0Strides);
 
         auto src1Shape = src1Desc.getShape();
-        auto src1Strides = getStridesAndModifyShape(src1Shape, transposeIn[1]);
+        auto src1Strides = getStridesAndModifyShape(src1Shape, transposeIn[1],
+                                                    src1MemPtr->GetDescWithType<BlockedMemoryDesc>()->getStrides());
         src1TransposedDesc = std::make_shared<DnnlBlockedMemoryDesc>(src1Desc.getPrecision(), src1Shape, src1Strides);
     } else {
         attr = initPrimitiveAttr();
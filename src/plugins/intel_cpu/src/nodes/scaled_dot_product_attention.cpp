@@ -0,0 +1,323 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+
+#include "ie_parallel.hpp"
+#include "scaled_dot_product_attention.h"
+#include "memory_desc/dnnl_blocked_memory_desc.h"
+#include <common/primitive_hashing_utils.hpp>
+#include "ngraph_transformations/op/scaled_dot_product_attention.hpp"
+#include "utils/bfloat16.hpp"
+#include "utils/general_utils.h"
+
+using namespace InferenceEngine;
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+namespace {
+
+struct SDPAMatMulKey {
+    DnnlMemoryDescCPtr src;
+    DnnlMemoryDescCPtr weights;
+    DnnlMemoryDescCPtr dst;
+    dnnl::primitive_attr attr;
+
+    size_t hash() const;
+    bool operator==(const SDPAMatMulKey& rhs) const;
+};
+
+size_t SDPAMatMulKey::hash() const {
+    using namespace dnnl::impl;
+    using namespace dnnl::impl::primitive_hashing;
+
+    size_t seed = 0;
+    for (const auto& ptr : {src, weights, dst})
+        seed = hash_combine(seed, get_md_hash(ptr->getDnnlDesc().data));
+    seed = hash_combine(seed, get_attr_hash(*attr.get()));
+    return seed;
+}
+
+bool SDPAMatMulKey::operator==(const SDPAMatMulKey& rhs) const {
+    return src->getDnnlDesc() == rhs.src->getDnnlDesc() &&
+           weights->getDnnlDesc() == rhs.weights->getDnnlDesc() &&
+           dst->getDnnlDesc() == rhs.dst->getDnnlDesc() &&
+           *attr.get() == *rhs.attr.get();
+}
+
+} // namespace
+
+bool ScaledDotProductAttention::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        if (!std::dynamic_pointer_cast<const ScaledDotProductAttentionNode>(op)) {
+            errorMessage = "Only ScaledDotProductAttention operation from cpu_plugin_opset is supported";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+ScaledDotProductAttention::ScaledDotProductAttention(const std::shared_ptr<ngraph::Node>& op, const dnnl::engine& eng,
+        WeightsSharing::Ptr &cache) : Node(op, eng, cache) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    errorPrefix = "ScaledDotProductAttention node with name '" + op->get_friendly_name() + "'";
+    if ((getOriginalInputsNumber() != 3 && getOriginalInputsNumber() != 4) || getOriginalOutputsNumber() != 1)
+        IE_THROW() << errorPrefix << " has incorrect number of input/output edges!";
+
+    const auto attention = std::dynamic_pointer_cast<const ScaledDotProductAttentionNode>(op);
+    qOrder = attention->get_q_order();
+    kOrder = attention->get_k_order();
+    vOrder = attention->get_v_order();
+    outOrder = attention->get_out_order();
+    scale = attention->get_scale();
+    hasMask = getOriginalInputsNumber() == 4;
+}
+
+void ScaledDotProductAttention::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    const auto precision = getOriginalInputPrecisionAtPort(0) == Precision::BF16 ? Precision::BF16 : Precision::FP32;
+    std::vector<PortConfigurator> inPortConfigs(3, PortConfigurator{LayoutType::ncsp, precision});
+    if (hasMask)
+        inPortConfigs.push_back({LayoutType::ncsp, Precision::FP32});
+
+    addSupportedPrimDesc(inPortConfigs,
+                         {{LayoutType::ncsp, precision}},
+                         impl_desc_type::gemm_any);
+}
+
+ScaledDotProductAttention::LogicalTensor ScaledDotProductAttention::getLogicalTensor(size_t port, const std::vector<int64_t>& order) const {
+    const auto& memory = getParentEdgeAt(port)->getMemory();
+    const auto& dims = memory.getStaticDims();
+    if (dims.size() != 4)
+        IE_THROW() << errorPrefix << " supports only 4D Q, K and V inputs";
+
+    // the inputs are plain, but not dense if they are read from the KV cache with a headroom
+    const auto strides = memory.GetDescWithType<BlockedMemoryDesc>()->getStrides();
+
+    LogicalTensor tensor{VectorDims(4), VectorDims(4)};
+    for (size_t i = 0; i < 4; i++) {
+        tensor.dims[i] = dims[order[i]];
+        tensor.strides[i] = strides[order[i]];
+    }
+    return tensor;
+}
+
+dnnl::primitive ScaledDotProductAttention::createMatMul(const DnnlMemoryDescPtr& src, const DnnlMemoryDescPtr& weights,
+                                                        const DnnlMemoryDescPtr& dst, const dnnl::primitive_attr& attr) {
+    const auto engine = getEngine();
+    auto builder = [&engine](const SDPAMatMulKey& key) -> std::shared_ptr<dnnl::primitive> {
+        dnnl::matmul::desc desc(key.src->getDnnlDesc(), key.weights->getDnnlDesc(), key.dst->getDnnlDesc());
+        return std::make_shared<dnnl::matmul>(dnnl::matmul::primitive_desc(desc, key.attr, engine));
+    };
+
+    auto result = getRuntimeCache()->getOrCreate(SDPAMatMulKey{src, weights, dst, attr}, builder);
+    if (!result.first)
+        IE_THROW() << "Primitive descriptor was not found for node " << getName() << ".";
+    return *result.first;
+}
+
+void ScaledDotProductAttention::prepareKeyBlock(KeyBlock& block, size_t cols, Precision precision, const DnnlMemoryDescPtr& qDesc,
+                                                const DnnlMemoryDescPtr& accDesc) {
+    const size_t B = q.dims[0], H = q.dims[1], Lq = q.dims[2], D = q.dims[3];
+    const size_t Dv = v.dims[3];
+    const auto engine = getEngine();
+
+    // K is read in place as the transposed [D, cols] weights of Q·Kᵀ
+    const auto kDesc = std::make_shared<DnnlBlockedMemoryDesc>(precision, Shape(VectorDims{k.dims[0], k.dims[1], D, cols}),
+                                                               VectorDims{k.strides[0], k.strides[1], k.strides[3], k.strides[2]});
+    const auto vDesc = std::make_shared<DnnlBlockedMemoryDesc>(precision, Shape(VectorDims{v.dims[0], v.dims[1], cols, Dv}), v.strides);
+    // the tail block keeps the row stride of a full block, so all the blocks share the scores buffer
+    const VectorDims scoresDims{B, H, Lq, cols};
+    const VectorDims scoresStrides{H * Lq * keyBlock, Lq * keyBlock, keyBlock, 1};
+    const auto scoresDesc = std::make_shared<DnnlBlockedMemoryDesc>(Precision::FP32, Shape(scoresDims), scoresStrides);
+    const auto probsDesc = std::make_shared<DnnlBlockedMemoryDesc>(precision, Shape(scoresDims), scoresStrides);
+
+    dnnl::primitive_attr scoresAttr;
+    scoresAttr.set_output_scales(0, {scale});
+    // P·V of every block is accumulated into the already rescaled output of the previous blocks
+    dnnl::post_ops ops;
+    ops.append_sum(1.f);
+    dnnl::primitive_attr outputAttr;
+    outputAttr.set_post_ops(ops);
+
+    block.cols = cols;
+    block.scoresPrim = createMatMul(qDesc, kDesc, scoresDesc, scoresAttr);
+    block.outputPrim = createMatMul(probsDesc, vDesc, accDesc, outputAttr);
+    block.kMem = dnnl::memory(kDesc->getDnnlDesc(), engine, DNNL_MEMORY_NONE);
+    block.vMem = dnnl::memory(vDesc->getDnnlDesc(), engine, DNNL_MEMORY_NONE);
+    block.scoresMem = dnnl::memory(scoresDesc->getDnnlDesc(), engine, scores.data());
+    block.probsMem = dnnl::memory(probsDesc->getDnnlDesc(), engine,
+                                  probsBf16.empty() ? static_cast<void*>(scores.data()) : static_cast<void*>(probsBf16.data()));
+}
+
+void ScaledDotProductAttention::prepareParams() {
+    q = getLogicalTensor(0, qOrder);
+    k = getLogicalTensor(1, kOrder);
+    v = getLogicalTensor(2, vOrder);
+
+    const auto batchBroadcastable = [&](const LogicalTensor& tensor) {
+        return (tensor.dims[0] == 1 || tensor.dims[0] == q.dims[0]) && (tensor.dims[1] == 1 || tensor.dims[1] == q.dims[1]);
+    };
+    if (q.dims[3] != k.dims[3] || k.dims[2] != v.dims[2] || !batchBroadcastable(k) || !batchBroadcastable(v))
+        IE_THROW() << errorPrefix << " has inconsistent Q, K and V shapes";
+
+    const VectorDims scoresDims{q.dims[0], q.dims[1], q.dims[2], k.dims[2]};
+    if (hasMask) {
+        const auto& maskDims = getParentEdgeAt(3)->getMemory().getStaticDims();
+        if (maskDims.size() > 4)
+            IE_THROW() << errorPrefix << " supports mask of rank up to 4";
+        mask.dims.assign(4, 1);
+        std::copy(maskDims.begin(), maskDims.end(), mask.dims.begin() + 4 - maskDims.size());
+        mask.strides.assign(4, 0);
+        size_t stride = 1;
+        for (int i = 3; i >= 0; i--) {
+            if (mask.dims[i] != 1 && mask.dims[i] != scoresDims[i])
+                IE_THROW() << errorPrefix << " has mask which is not broadcastable to the attention scores";
+            // the broadcasted dimensions are read with zero stride
+            mask.strides[i] = mask.dims[i] == 1 ? 0 : stride;
+            stride *= mask.dims[i];
+        }
+    }
+
+    const auto& outDims = getChildEdgeAt(0)->getMemory().getStaticDims();
+    VectorDims outStrides(4, 1);
+    for (int i = 2; i >= 0; i--)
+        outStrides[i] = outStrides[i + 1] * outDims[i + 1];
+    out.dims.resize(4);
+    out.strides.resize(4);
+    for (size_t j = 0; j < 4; j++) {
+        out.dims[outOrder[j]] = outDims[j];
+        out.strides[outOrder[j]] = outStrides[j];
+    }
+
+    const auto precision = getParentEdgeAt(0)->getMemory().getDesc().getPrecision();
+    const size_t B = q.dims[0], H = q.dims[1], Lq = q.dims[2];
+    const size_t Lk = k.dims[2], Dv = v.dims[3];
+    const size_t rows = B * H * Lq;
+    scores.resize(rows * keyBlock);
+    probsBf16.resize(precision == Precision::BF16 ? rows * keyBlock : 0);
+    acc.resize(rows * Dv);
+    rowMax.resize(rows);
+    rowSum.resize(rows);
+
+    const auto engine = getEngine();
+    const auto qDesc = std::make_shared<DnnlBlockedMemoryDesc>(precision, Shape(q.dims), q.strides);
+    const auto accDesc = std::make_shared<DnnlBlockedMemoryDesc>(Precision::FP32, Shape(VectorDims{B, H, Lq, Dv}));
+    qMem = dnnl::memory(qDesc->getDnnlDesc(), engine, DNNL_MEMORY_NONE);
+    accMem = dnnl::memory(accDesc->getDnnlDesc(), engine, acc.data());
+
+    // all the key blocks but the last one have the same size, so at most two sets of primitives are needed
+    keyBlocks = {};
+    const size_t fullCols = std::min(keyBlock, Lk);
+    const size_t tailCols = Lk > keyBlock ? Lk % keyBlock : 0;
+    if (fullCols != 0)
+        prepareKeyBlock(keyBlocks[0], fullCols, precision, qDesc, accDesc);
+    if (tailCols != 0)
+        prepareKeyBlock(keyBlocks[1], tailCols, precision, qDesc, accDesc);
+}
+
+template <typename T>
+void ScaledDotProductAttention::executeImpl(dnnl::stream strm) {
+    auto* qData = reinterpret_cast<T*>(getParentEdgeAt(0)->getMemoryPtr()->GetPtr());
+    auto* kData = reinterpret_cast<T*>(getParentEdgeAt(1)->getMemoryPtr()->GetPtr());
+    auto* vData = reinterpret_cast<T*>(getParentEdgeAt(2)->getMemoryPtr()->GetPtr());
+    const auto* maskData = hasMask ? reinterpret_cast<const float*>(getParentEdgeAt(3)->getMemoryPtr()->GetPtr()) : nullptr;
+    auto* outData = reinterpret_cast<T*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+
+    const size_t B = q.dims[0], H = q.dims[1], Lq = q.dims[2];
+    const size_t Lk = k.dims[2], Dv = v.dims[3];
+
+    qMem.set_data_handle(qData);
+    std::fill(acc.begin(), acc.end(), 0.f);
+    std::fill(rowMax.begin(), rowMax.end(), -std::numeric_limits<float>::infinity());
+    std::fill(rowSum.begin(), rowSum.end(), 0.f);
+
+    for (size_t k0 = 0; k0 < Lk; k0 += keyBlock) {
+        const size_t cols = std::min(keyBlock, Lk - k0);
+        auto& block = keyBlocks[cols == keyBlocks[0].cols ? 0 : 1];
+        block.kMem.set_data_handle(kData + k0 * k.strides[2]);
+        block.vMem.set_data_handle(vData + k0 * v.strides[2]);
+        block.scoresPrim.execute(strm, {{DNNL_ARG_SRC, qMem}, {DNNL_ARG_WEIGHTS, block.kMem}, {DNNL_ARG_DST, block.scoresMem}});
+
+        // online softmax: the accumulated values are rescaled when the running maximum grows
+        auto* probs = reinterpret_cast<T*>(block.probsMem.get_data_handle());
+        parallel_for3d(B, H, Lq, [&](size_t b, size_t h, size_t l) {
+            const size_t row = (b * H + h) * Lq + l;
+            float* scoresRow = scores.data() + row * keyBlock;
+            T* probsRow = probs + row * keyBlock;
+            if (maskData) {
+                const float* maskRow = maskData + b * mask.strides[0] + h * mask.strides[1] + l * mask.strides[2] + k0 * mask.strides[3];
+                for (size_t c = 0; c < cols; c++)
+                    scoresRow[c] += maskRow[c * mask.strides[3]];
+            }
+
+            const float blockMax = *std::max_element(scoresRow, scoresRow + cols);
+            const float newMax = std::max(rowMax[row], blockMax);
+            if (newMax == -std::numeric_limits<float>::infinity()) {
+                std::fill(probsRow, probsRow + cols, static_cast<T>(0.f));
+                return;
+            }
+            const float correction = std::exp(rowMax[row] - newMax);
+            if (correction != 1.f) {
+                float* accRow = acc.data() + row * Dv;
+                for (size_t d = 0; d < Dv; d++)
+                    accRow[d] *= correction;
+            }
+            float sum = 0.f;
+            for (size_t c = 0; c < cols; c++) {
+                probsRow[c] = static_cast<T>(std::exp(scoresRow[c] - newMax));
+                // the sum is taken over the rounded probabilities the matmul reads
+                sum += static_cast<float>(probsRow[c]);
+            }
+            rowSum[row] = rowSum[row] * correction + sum;
+            rowMax[row] = newMax;
+        });
+
+        block.outputPrim.execute(strm, {{DNNL_ARG_SRC, block.probsMem}, {DNNL_ARG_WEIGHTS, block.vMem}, {DNNL_ARG_DST, accMem}});
+    }
+
+    parallel_for3d(B, H, Lq, [&](size_t b, size_t h, size_t l) {
+        const size_t row = (b * H + h) * Lq + l;
+        const float normalizer = 1.f / rowSum[row];
+        const float* accRow = acc.data() + row * Dv;
+        T* outPtr = outData + b * out.strides[0] + h * out.strides[1] + l * out.strides[2];
+        for (size_t d = 0; d < Dv; d++)
+            outPtr[d * out.strides[3]] = static_cast<T>(accRow[d] * normalizer);
+    });
+}
+
+void ScaledDotProductAttention::execute(dnnl::stream strm) {
+    const auto precision = getParentEdgeAt(0)->getMemory().getDesc().getPrecision();
+    if (precision == Precision::FP32) {
+        executeImpl<float>(strm);
+    } else if (precision == Precision::BF16) {
+        executeImpl<bfloat16_t>(strm);
+    } else {
+        IE_THROW() << errorPrefix << " has unsupported precision: " << precision.name();
+    }
+}
+
+void ScaledDotProductAttention::executeDynamicImpl(dnnl::stream strm) {
+    execute(strm);
+}
+
+bool ScaledDotProductAttention::created() const {
+    return getType() == Type::ScaledDotProductAttention;
+}
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
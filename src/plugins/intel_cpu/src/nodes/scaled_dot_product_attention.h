@@ -0,0 +1,88 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <node.h>
+#include <memory_desc/dnnl_memory_desc.h>
+#include "utils/bfloat16.hpp"
+#include <array>
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+/**
+ * @brief Computes the attention by the blocks of keys with the online softmax. Q·Kᵀ and P·V of a block run
+ * as oneDNN matmul primitives over all the batches and heads, so only [B, H, Lq, keyBlock] scores are kept
+ * instead of the full [B, H, Lq, Lk] scores tensor.
+ */
+class ScaledDotProductAttention : public Node {
+public:
+    ScaledDotProductAttention(const std::shared_ptr<ngraph::Node>& op, const dnnl::engine& eng, WeightsSharing::Ptr &cache);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void execute(dnnl::stream strm) override;
+    void executeDynamicImpl(dnnl::stream strm) override;
+    void prepareParams() override;
+    bool created() const override;
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    static constexpr size_t keyBlock = 64;
+
+    // dimensions and element strides of a tensor in the logical [B, H, L, D] order
+    struct LogicalTensor {
+        VectorDims dims;
+        VectorDims strides;
+    };
+
+    // primitives and memory objects of the key blocks of the same size
+    struct KeyBlock {
+        size_t cols = 0;
+        dnnl::primitive scoresPrim;
+        dnnl::primitive outputPrim;
+        dnnl::memory kMem;
+        dnnl::memory vMem;
+        dnnl::memory scoresMem;
+        dnnl::memory probsMem;
+    };
+
+    LogicalTensor getLogicalTensor(size_t port, const std::vector<int64_t>& order) const;
+    dnnl::primitive createMatMul(const DnnlMemoryDescPtr& src, const DnnlMemoryDescPtr& weights,
+                                 const DnnlMemoryDescPtr& dst, const dnnl::primitive_attr& attr);
+    void prepareKeyBlock(KeyBlock& block, size_t cols, InferenceEngine::Precision precision, const DnnlMemoryDescPtr& qDesc,
+                         const DnnlMemoryDescPtr& accDesc);
+
+    template <typename T>
+    void executeImpl(dnnl::stream strm);
+
+    std::vector<int64_t> qOrder;
+    std::vector<int64_t> kOrder;
+    std::vector<int64_t> vOrder;
+    std::vector<int64_t> outOrder;
+    float scale = 1.f;
+    bool hasMask = false;
+
+    LogicalTensor q, k, v, mask, out;
+    // scores and probabilities of the current key block, accumulated output, running max and sum per query
+    std::vector<float> scores;
+    std::vector<bfloat16_t> probsBf16;
+    std::vector<float> acc;
+    std::vector<float> rowMax;
+    std::vector<float> rowSum;
+    dnnl::memory qMem;
+    dnnl::memory accMem;
+    // the full key blocks and the tail block
+    std::array<KeyBlock, 2> keyBlocks;
+
+    std::string errorPrefix;
+};
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
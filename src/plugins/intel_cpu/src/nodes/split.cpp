@@ -169,11 +169,22 @@ void Split::initSupportedPrimitiveDescriptors() {
     }
 
     // Optimized inplace case
-    // TODO [DS]: inplace
-    if (!isDynamicNode()) {
+    // the dynamic outputs are placed one after another in the input memory only if the dims before axis are 1
+    const auto& srcDims = srcShape.getDims();
+    if (!isDynamicNode() || (std::all_of(srcDims.begin(), srcDims.begin() + axis, [](Dim dim) { return dim == 1; }) &&
+                             !getParentEdgeAt(0)->getParent()->isConstant())) {
         for (auto refPdIndex : pdIndexesToReuse) {
             const auto& refConfig = supportedPrimitiveDescriptors[refPdIndex].getConfig();
             auto config = refConfig;
+
+            // the offsets of the dynamic outputs are defined at runtime, see resolveInPlaceEdges
+            if (isDynamicNode()) {
+                for (auto& outConf : config.outConfs)
+                    outConf.inPlace(0);
+                supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown);
+                continue;
+            }
+
             const auto inBlockingDesc = refConfig.inConfs[0].getMemDesc()->as<CpuBlockedMemoryDesc>();
             const auto& order = inBlockingDesc->getOrder();
             const auto& blkDims = inBlockingDesc->getBlockDims();
@@ -314,7 +325,54 @@ bool Split::created() const {
 }
 
 bool Split::isOptimized() const {
-    return getSelectedPrimitiveDescriptor() && getSelectedPrimitiveDescriptor()->getConfig().outConfs[0].inPlace() >= 0;
+    return !inPlaceFallback && getSelectedPrimitiveDescriptor() && getSelectedPrimitiveDescriptor()->getConfig().outConfs[0].inPlace() >= 0;
+}
+
+void Split::resolveInPlaceEdges() {
+    if (!isDynamicNode() || !isOptimized()) {
+        Node::resolveInPlaceEdges();
+        return;
+    }
+
+    // The outputs are the consecutive partitions of the input memory, so the consumers read them directly. A partition may be
+    // moved when the preceding ones are resized, so only the dynamic consumers, which prepare the params again, are supported.
+    // The input memory is used only when it's resolved already, otherwise it may become a view of another memory later.
+    const auto parentEdge = getParentEdgeAt(0);
+    bool partitioned = parentEdge->getStatus() != Edge::Status::NotAllocated;
+    for (size_t i = 0; i < outputShapes.size() && partitioned; i++) {
+        for (auto& childEdge : getChildEdgesAtPort(i)) {
+            const auto child = childEdge->getChild();
+            partitioned = partitioned && childEdge->getStatus() == Edge::Status::NotAllocated &&
+                          (child->isDynamicNode() || child->getType() == Type::Output);
+        }
+    }
+
+    std::vector<DnnlMemoryMngrPtr> partitions;
+    if (partitioned) {
+        partitions = MemoryPartitions::create(parentEdge->getMemory().getDnnlMemoryMngr(), outputShapes.size(), false);
+    } else {
+        inPlaceFallback = true;
+    }
+
+    const auto& config = getSelectedPrimitiveDescriptor()->getConfig();
+    for (size_t i = 0; i < outputShapes.size(); i++) {
+        DnnlMemoryMngrPtr memMngr = partitioned ? partitions[i] : nullptr;
+        for (auto& childEdge : getChildEdgesAtPort(i)) {
+            if (childEdge->getStatus() != Edge::Status::NotAllocated)
+                continue;
+
+            if (partitioned)
+                childEdge->getChild()->setRelocatableMemory();
+            childEdge->getMemoryPtr().reset(new Memory(getEngine()));
+            if (memMngr) {
+                childEdge->getMemoryPtr()->Create(config.outConfs[i].getMemDesc(), memMngr);
+            } else {
+                childEdge->getMemoryPtr()->Create(config.outConfs[i].getMemDesc());
+                memMngr = childEdge->getMemoryPtr()->getDnnlMemoryMngr();
+            }
+            childEdge->changeStatus(Edge::Status::Allocated);
+        }
+    }
 }
 
 void Split::initOptimalPrimitiveDescriptor() {
@@ -33,6 +33,7 @@ public:
     void prepareParams() override;
     std::vector<VectorDims> shapeInfer() const override;
     void executeDynamicImpl(dnnl::stream strm) override { execute(strm); }
+    void resolveInPlaceEdges() override;
 
 private:
     struct SplitExecutor {
@@ -58,6 +59,8 @@ private:
     void optimizedNspc2Ncsp(size_t MB);
 
     bool canUseOptimizedNspc2Ncsp = false;
+    // the dynamic in-place outputs can't be placed into the input memory, so they are copied
+    bool inPlaceFallback = false;
 
     size_t axis = 1;
     std::vector<std::pair<size_t, uint8_t*>> dstMemPtrs;
@@ -85,6 +85,9 @@
 #include "nodes/subgraph.h"
 #include "nodes/priorbox.h"
 #include "nodes/priorbox_clustered.h"
+#include "nodes/image_preprocess.h"
+#include "nodes/scaled_dot_product_attention.h"
+#include "nodes/kv_cache.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -182,6 +185,9 @@ Node::NodesFactory::NodesFactory()
     INTEL_CPU_NODE(ColorConvert, Type::ColorConvert);
     INTEL_CPU_NODE(PriorBox, Type::PriorBox);
     INTEL_CPU_NODE(PriorBoxClustered, Type::PriorBoxClustered);
+    INTEL_CPU_NODE(ImagePreprocess, Type::ImagePreprocess);
+    INTEL_CPU_NODE(ScaledDotProductAttention, Type::ScaledDotProductAttention);
+    INTEL_CPU_NODE(KVCache, Type::KVCache);
 }
 
 #undef INTEL_CPU_NODE
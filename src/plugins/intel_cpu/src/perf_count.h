@@ -7,6 +7,8 @@
 #include <chrono>
 #include <ratio>
 
+#include "utils/hw_perf_counters.h"
+
 namespace ov {
 namespace intel_cpu {
 
@@ -17,6 +19,9 @@ class PerfCount {
     std::chrono::high_resolution_clock::time_point __start = {};
     std::chrono::high_resolution_clock::time_point __finish = {};
 
+    HwPerfCounters::Values hw_total;
+    uint32_t hw_num = 0;
+
 public:
     PerfCount(): total_duration(0), num(0) {}
 
@@ -26,6 +31,18 @@ public:
 
     uint64_t avg() const { return (num == 0) ? 0 : total_duration / num; }
 
+    bool hasHwValues() const { return hw_num != 0; }
+
+    HwPerfCounters::Values hwAvg() const {
+        HwPerfCounters::Values result;
+        if (hw_num == 0)
+            return result;
+        result.cycles = hw_total.cycles / hw_num;
+        result.instructions = hw_total.instructions / hw_num;
+        result.llcMisses = hw_total.llcMisses / hw_num;
+        return result;
+    }
+
 private:
     void start_itr() {
         __start = std::chrono::high_resolution_clock::now();
@@ -37,20 +54,36 @@ private:
         num++;
     }
 
+    void add_hw(const HwPerfCounters::Values& values) {
+        hw_total += values;
+        hw_num++;
+    }
+
     friend class PerfHelper;
 };
 
 class PerfHelper {
     PerfCount &counter;
+    const HwPerfCounters* hw;
+    HwPerfCounters::Values hw_start;
 
 public:
-    explicit PerfHelper(PerfCount &count): counter(count) { counter.start_itr(); }
+    explicit PerfHelper(PerfCount &count, const HwPerfCounters* hwCounters = nullptr)
+        : counter(count), hw(hwCounters && hwCounters->available() ? hwCounters : nullptr) {
+        if (hw)
+            hw_start = hw->read();
+        counter.start_itr();
+    }
 
-    ~PerfHelper() { counter.finish_itr(); }
+    ~PerfHelper() {
+        counter.finish_itr();
+        if (hw)
+            counter.add_hw(hw->read() - hw_start);
+    }
 };
 
 }   // namespace intel_cpu
 }   // namespace ov
 
-#define GET_PERF(_node) std::unique_ptr<PerfHelper>(new PerfHelper(_node->PerfCounter()))
-#define PERF(_node, _need) auto pc = _need ? GET_PERF(_node) : nullptr;
+#define GET_PERF(_node, _hw) std::unique_ptr<PerfHelper>(new PerfHelper(_node->PerfCounter(), _hw))
+#define PERF(_node, _need, _hw) auto pc = _need ? GET_PERF(_node, _hw) : nullptr;
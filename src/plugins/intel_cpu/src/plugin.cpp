@@ -108,16 +108,21 @@
 #include <low_precision/multiply_to_group_convolution.hpp>
 #include <low_precision/network_helper.hpp>
 #include "openvino/runtime/core.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
 #include "openvino/util/common_util.hpp"
 
 #include <ie_algorithm.hpp>
 #include "performance_heuristics.hpp"
+#include "utils/timeline.h"
 
 #include "nodes/mvn.h"
 #include "nodes/fake_quantize.h"
 #include "nodes/normalize.h"
 #include "ngraph_transformations/convert_to_cpu_specific_opset.hpp"
+#include "ngraph_transformations/fuse_image_preprocess.hpp"
+#include "ngraph_transformations/kv_cache_fusion.hpp"
 #include "ngraph_transformations/move_eltwise_up_data_movement.hpp"
+#include "ngraph_transformations/scaled_dot_product_attention_fusion.hpp"
 #include "transformations/smart_reshape/smart_reshape.hpp"
 #include "ngraph_transformations/swap_convert_transpose.hpp"
 
@@ -178,10 +183,15 @@ Engine::~Engine() {
 }
 
 static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function> nGraphFunc, const bool _enableLPT,
-                                               const bool _enableSnippets, const bool isLegacyApi) {
+                                               const bool _enableSnippets, const bool isLegacyApi,
+                                               const bool _enableAttentionFusion, const bool _enableImagePreprocessFusion,
+                                               const Timeline::Ptr& timeline = nullptr) {
     ngraph::pass::Manager manager;
     manager.set_per_pass_validation(false);
     manager.register_pass<ngraph::pass::InitNodeInfo>();
+    // must be done before CommonOptimizations decompose and reorder the preprocessing operations
+    if (_enableImagePreprocessFusion)
+        manager.register_pass<FuseImagePreprocess>();
 
     const bool useLpt =
             _enableLPT &&
@@ -437,12 +447,16 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
         });
     }
 
-    manager.run_passes(nGraphFunc);
+    {
+        Timeline::Scope scope(timeline, "Transformations", "CommonTransformations");
+        manager.run_passes(nGraphFunc);
+    }
 
     using namespace ngraph::pass::low_precision;
     if (useLpt) {
         CPU_LPT_SCOPE(LowPrecisionTransformations_Part4);
         OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "LowPrecisionTransformations");
+        Timeline::Scope scope(timeline, "Transformations", "LowPrecisionTransformations");
 
         auto supportedPrecisions = std::vector<PrecisionsRestriction>({
             PrecisionsRestriction::create<ngraph::opset1::Convolution>({
@@ -505,6 +519,10 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
     postLPTPassManager.register_pass<ngraph::pass::FakeQuantizeDecomposition>();
     postLPTPassManager.register_pass<ngraph::pass::UnrollTensorIterator>();
     postLPTPassManager.register_pass<ReshapePRelu>();
+    postLPTPassManager.register_pass<KVCacheFusion>();
+    // the fused node saves the memory of the scores, but it's slower than the oneDNN MatMul and Softmax
+    if (_enableAttentionFusion)
+        postLPTPassManager.register_pass<ScaledDotProductAttentionFusion>();
 
     postLPTPassManager.get_pass_config()->set_callback<ngraph::pass::FakeQuantizeDecomposition>([](const_node_ptr &node) -> bool {
         std::string errMsg;
@@ -525,9 +543,13 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
     });
 
     postLPTPassManager.register_pass<ngraph::pass::ConstantFolding>();
-    postLPTPassManager.run_passes(nGraphFunc);
+    {
+        Timeline::Scope scope(timeline, "Transformations", "PostLPTTransformations");
+        postLPTPassManager.run_passes(nGraphFunc);
+    }
 
     if (!useLpt && _enableSnippets && dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx2)) {
+        Timeline::Scope scope(timeline, "Transformations", "SnippetsTokenization");
         ngraph::pass::Manager tokenization_manager;
         tokenization_manager.register_pass<SnippetsMarkSkipped>();
         tokenization_manager.register_pass<ngraph::snippets::pass::EnumerateNodes>();
@@ -556,9 +578,11 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
     }
 }
 
-static void Transformation(CNNNetwork& clonedNetwork, const bool _enableLPT, const bool _enableSnippets, const bool isLegacyApi) {
+static void Transformation(CNNNetwork& clonedNetwork, const bool _enableLPT, const bool _enableSnippets, const bool isLegacyApi,
+                           const bool _enableAttentionFusion, const bool _enableImagePreprocessFusion) {
     auto nGraphFunc = clonedNetwork.getFunction();
-    TransformationUpToCPUSpecificOpSet(nGraphFunc, _enableLPT, _enableSnippets, isLegacyApi);
+    TransformationUpToCPUSpecificOpSet(nGraphFunc, _enableLPT, _enableSnippets, isLegacyApi, _enableAttentionFusion,
+                                       _enableImagePreprocessFusion);
     ConvertToCPUSpecificOpset(nGraphFunc);
 }
 
@@ -676,7 +700,12 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
 
     auto config = orig_config;
 
-    CNNNetwork clonedNetwork = InferenceEngine::details::cloneNetwork(network);
+    auto timeline = std::make_shared<Timeline>();
+    CNNNetwork clonedNetwork;
+    {
+        Timeline::Scope scope(timeline, "Transformations", "CloneNetwork");
+        clonedNetwork = InferenceEngine::details::cloneNetwork(network);
+    }
     const auto& lptProp = config.find(InferenceEngine::PluginConfigInternalParams::KEY_LP_TRANSFORMS_MODE);
     const bool enableLPT = (lptProp != config.end() && lptProp->second == PluginConfigParams::YES) /* enabled in the orig_config*/
             || Config::LPTransformsMode::On == engConfig.lpTransformsMode /* or already enabled for the plugin */;
@@ -690,8 +719,16 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
     const bool enableDynamicBatch = (dynamicBatchProp != config.end() && dynamicBatchProp->second == PluginConfigParams::YES)
             || engConfig.enableDynamicBatch;
     const bool enableSnippets = !(enableModelCache || enableDynamicBatch || enableBF16);
+    const auto& attentionFusionProp = config.find(ov::intel_cpu::attention_fusion.name());
+    const bool enableAttentionFusion = attentionFusionProp != config.end() ? attentionFusionProp->second == PluginConfigParams::YES
+                                                                           : engConfig.attentionFusion;
+    const auto& imagePreprocessFusionProp = config.find(ov::intel_cpu::image_preprocess_fusion.name());
+    const bool enableImagePreprocessFusion = imagePreprocessFusionProp != config.end()
+                                                 ? imagePreprocessFusionProp->second == PluginConfigParams::YES
+                                                 : engConfig.imagePreprocessFusion;
     auto nGraphFunc = clonedNetwork.getFunction();
-    TransformationUpToCPUSpecificOpSet(nGraphFunc, enableLPT, enableSnippets, isLegacyAPI());
+    TransformationUpToCPUSpecificOpSet(nGraphFunc, enableLPT, enableSnippets, isLegacyAPI(), enableAttentionFusion,
+                                       enableImagePreprocessFusion, timeline);
 
     // need to check that all outputs have static shapes
     // checking that all inputs have static shapes is performed in the common part
@@ -705,7 +742,10 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
 
     ApplyPerformanceHints(config, nGraphFunc);
 
-    ConvertToCPUSpecificOpset(nGraphFunc);
+    {
+        Timeline::Scope scope(timeline, "Transformations", "ConvertToCPUSpecificOpset");
+        ConvertToCPUSpecificOpset(nGraphFunc);
+    }
 
     // update the props after the perf mode translated to configs
     // TODO: Clarify the behavior of SetConfig method. Skip eng_config or not?
@@ -716,7 +756,56 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
         conf.batchLimit = static_cast<int>(network.getBatchSize());
     }
 
-    return std::make_shared<ExecNetwork>(clonedNetwork, conf, extensionManager, shared_from_this());
+    if (streamsAutoTuningApplicable(orig_config, conf) && !nGraphFunc->is_dynamic()) {
+        Timeline::Scope scope(timeline, "Calibration", "StreamsAutoTuning");
+        const auto tuned = TuneStreams(network, clonedNetwork, config, conf);
+        conf.readProperties({{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(tuned.streams)}});
+        conf.tunedStreams = tuned.streams;
+        conf.tunedStreamsHost = tuned.host;
+    }
+
+    return std::make_shared<ExecNetwork>(clonedNetwork, conf, extensionManager, shared_from_this(), timeline);
+}
+
+bool Engine::streamsAutoTuningApplicable(const std::map<std::string, std::string> &config, const Config& conf) const {
+    // the explicitly configured streams and the latency hint are not overridden
+    return conf.streamsAutoTuning && !streamsSet(config) && !streamsExplicitlySetForEngine &&
+           conf.perfHintsConfig.ovPerfHint == CONFIG_VALUE(THROUGHPUT) &&
+           !conf.enableDynamicBatch && !conf.exclusiveAsyncRequests;
+}
+
+StreamsTuner::Result Engine::TuneStreams(const CNNNetwork& network, const CNNNetwork& clonedNetwork,
+                                         const std::map<std::string, std::string> &config, const Config& conf) {
+    ConstInputsDataMap inputs;
+    for (const auto& input : network.getInputsInfo())
+        inputs[input.first] = input.second;
+    ConstOutputsDataMap outputs;
+    for (const auto& output : network.getOutputsInfo())
+        outputs[output.first] = output.second;
+    std::vector<std::string> inputNames;
+    for (const auto& input : inputs)
+        inputNames.push_back(input.first);
+
+    auto factory = [&](int streams) -> IExecutableNetworkInternal::Ptr {
+        auto candidateConfig = config;
+        candidateConfig[PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS] = std::to_string(streams);
+        candidateConfig[ov::num_streams.name()] = ov::util::to_string(streams);
+        Config candidate = engConfig;
+        candidate.readProperties(candidateConfig);
+        // the calibration runs must not be reported
+        candidate.collectPerfCounters = false;
+        candidate.collectHwPerfCounters = false;
+        candidate.warmUpShapeSets.clear();
+
+        auto execNetwork = std::make_shared<ExecNetwork>(clonedNetwork, candidate, extensionManager, shared_from_this());
+        SetExeNetworkInfo(execNetwork, inputs, outputs);
+        if (network.getFunction())
+            SetExeNetworkInfo(execNetwork, network.getFunction());
+        return execNetwork;
+    };
+
+    const int maxStreams = conf.perfHintsConfig.ovPerfHintNumRequests;
+    return StreamsTuner(factory, inputNames).tune(conf.streamExecutorConfig._streams, maxStreams);
 }
 
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
@@ -783,6 +872,24 @@ Parameter Engine::GetConfig(const std::string& name, const std::map<std::string,
     } else if (name == ov::hint::num_requests) {
         const auto perfHintNumRequests = engConfig.perfHintsConfig.ovPerfHintNumRequests;
         return decltype(ov::hint::num_requests)::value_type(perfHintNumRequests);
+    } else if (name == ov::intel_cpu::warm_up_shapes) {
+        return decltype(ov::intel_cpu::warm_up_shapes)::value_type(engConfig.warmUpShapes);
+    } else if (name == ov::intel_cpu::huge_pages) {
+        return decltype(ov::intel_cpu::huge_pages)::value_type(Config::toString(engConfig.hugePages));
+    } else if (name == ov::intel_cpu::async_preprocessing) {
+        return decltype(ov::intel_cpu::async_preprocessing)::value_type(engConfig.asyncPreprocessing);
+    } else if (name == ov::intel_cpu::attention_fusion) {
+        return decltype(ov::intel_cpu::attention_fusion)::value_type(engConfig.attentionFusion);
+    } else if (name == ov::intel_cpu::image_preprocess_fusion) {
+        return decltype(ov::intel_cpu::image_preprocess_fusion)::value_type(engConfig.imagePreprocessFusion);
+    } else if (name == ov::intel_cpu::hw_perf_counters) {
+        return decltype(ov::intel_cpu::hw_perf_counters)::value_type(engConfig.collectHwPerfCounters);
+    } else if (name == ov::intel_cpu::streams_auto_tuning) {
+        return decltype(ov::intel_cpu::streams_auto_tuning)::value_type(engConfig.streamsAutoTuning);
+    } else if (name == ov::intel_cpu::static_shape_variants) {
+        return decltype(ov::intel_cpu::static_shape_variants)::value_type(engConfig.staticShapeVariants);
+    } else if (name == ov::intel_cpu::static_shape_variants_threshold) {
+        return decltype(ov::intel_cpu::static_shape_variants_threshold)::value_type(engConfig.staticShapeVariantsThreshold);
     }
     /* Internally legacy parameters are used with new API as part of migration procedure.
      * This fallback can be removed as soon as migration completed */
@@ -864,6 +971,15 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
                                                     RW_property(ov::hint::inference_precision.name()),
                                                     RW_property(ov::hint::performance_mode.name()),
                                                     RW_property(ov::hint::num_requests.name()),
+                                                    RW_property(ov::intel_cpu::warm_up_shapes.name()),
+                                                    RW_property(ov::intel_cpu::huge_pages.name()),
+                                                    RW_property(ov::intel_cpu::async_preprocessing.name()),
+                                                    RW_property(ov::intel_cpu::attention_fusion.name()),
+                                                    RW_property(ov::intel_cpu::image_preprocess_fusion.name()),
+                                                    RW_property(ov::intel_cpu::hw_perf_counters.name()),
+                                                    RW_property(ov::intel_cpu::streams_auto_tuning.name()),
+                                                    RW_property(ov::intel_cpu::static_shape_variants.name()),
+                                                    RW_property(ov::intel_cpu::static_shape_variants_threshold.name()),
         };
 
         std::vector<ov::PropertyName> supportedProperties;
@@ -931,7 +1047,7 @@ QueryNetworkResult Engine::QueryNetwork(const CNNNetwork& network, const std::ma
                                || Config::LPTransformsMode::On == engConfig.lpTransformsMode /* or already enabled */;
         const bool enableSnippets = !(conf.cache_dir.empty() || conf.enableDynamicBatch || (conf.enforceBF16
                 && dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core)));
-        Transformation(clonedNetwork, enableLPT, enableSnippets, isLegacyAPI());
+        Transformation(clonedNetwork, enableLPT, enableSnippets, isLegacyAPI(), conf.attentionFusion, conf.imagePreprocessFusion);
         auto ops = clonnedFunction->get_ordered_ops();
 
         //Mark removed nodes as supported
@@ -1019,22 +1135,38 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istr
                                             const std::map<std::string, std::string>& config) {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "ImportNetwork");
 
+    auto timeline = std::make_shared<Timeline>();
     CNNNetworkDeserializer deserializer(networkModel,
         [this](const std::string& model, const Blob::CPtr& weights) {
             return GetCore()->ReadNetwork(model, weights, true);
         });
 
     CNNNetwork cnnnetwork;
-    deserializer >> cnnnetwork;
+    {
+        Timeline::Scope scope(timeline, "ReadModel", "ImportNetwork");
+        deserializer >> cnnnetwork;
+    }
 
     Config conf = engConfig;
+    // The warm-up shapes stored with the model are applied unless they are overridden by the import config.
+    if (!deserializer.getWarmUpShapes().empty())
+        conf.readProperties({{ov::intel_cpu::warm_up_shapes.name(), deserializer.getWarmUpShapes()}});
     conf.readProperties(config);
 
     if (conf.enableDynamicBatch) {
         conf.batchLimit = static_cast<int>(cnnnetwork.getBatchSize());
     }
 
-    auto execNetwork = std::make_shared<ExecNetwork>(cnnnetwork, conf, extensionManager, shared_from_this());
+    // The streams calibrated when the model was compiled are reused on the same host
+    const auto& tunedStreams = deserializer.getTunedStreams();
+    if (streamsAutoTuningApplicable(config, conf) && tunedStreams.streams > 0 &&
+        tunedStreams.host == StreamsTuner::getHostSignature()) {
+        conf.readProperties({{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(tunedStreams.streams)}});
+        conf.tunedStreams = tunedStreams.streams;
+        conf.tunedStreamsHost = tunedStreams.host;
+    }
+
+    auto execNetwork = std::make_shared<ExecNetwork>(cnnnetwork, conf, extensionManager, shared_from_this(), timeline);
 
     execNetwork->setNetworkInputs(cnnnetwork.getInputsInfo());
     execNetwork->setNetworkOutputs(cnnnetwork.getOutputsInfo());
@@ -6,6 +6,7 @@
 
 #include <cpp_interfaces/interface/ie_iplugin_internal.hpp>
 #include "exec_network.h"
+#include "streams_tuner.h"
 
 #include <string>
 #include <map>
@@ -50,6 +51,13 @@ private:
 
     void ApplyPerformanceHints(std::map<std::string, std::string> &config, const std::shared_ptr<ngraph::Function>& ngraphFunc) const;
 
+    bool streamsAutoTuningApplicable(const std::map<std::string, std::string> &config, const Config& conf) const;
+
+    /* Measures the throughput of the transformed network with several numbers of streams.
+       The original network provides the inputs and outputs info of the calibration requests. */
+    StreamsTuner::Result TuneStreams(const InferenceEngine::CNNNetwork& network, const InferenceEngine::CNNNetwork& clonedNetwork,
+                                     const std::map<std::string, std::string> &config, const Config& conf);
+
     Config engConfig;
     ExtensionManager::Ptr extensionManager = std::make_shared<ExtensionManager>();
     /* Explicily configured streams have higher priority even than performance hints.
@@ -67,9 +67,12 @@ namespace {
     }
 };  // namespace
 
-CNNNetworkSerializer::CNNNetworkSerializer(std::ostream & ostream, ExtensionManager::Ptr extensionManager)
+CNNNetworkSerializer::CNNNetworkSerializer(std::ostream & ostream, ExtensionManager::Ptr extensionManager, std::string warmUpShapes,
+                                           StreamsTuner::Result tunedStreams)
     : _ostream(ostream)
-    , _extensionManager(extensionManager) {
+    , _extensionManager(extensionManager)
+    , _warmUpShapes(std::move(warmUpShapes))
+    , _tunedStreams(std::move(tunedStreams)) {
 }
 
 void CNNNetworkSerializer::operator << (const CNNNetwork & network) {
@@ -115,6 +118,17 @@ void CNNNetworkSerializer::operator << (const CNNNetwork & network) {
                     .set_value(to_string(out.second->getLayout()).c_str());
         }
 
+        if (!_warmUpShapes.empty()) {
+            root.append_child("warm_up").append_attribute("shapes")
+                    .set_value(_warmUpShapes.c_str());
+        }
+
+        if (_tunedStreams.streams > 0) {
+            auto streams = root.append_child("tuned_streams");
+            streams.append_attribute("value").set_value(_tunedStreams.streams);
+            streams.append_attribute("host").set_value(_tunedStreams.host.c_str());
+        }
+
         xml_doc.save(stream);
     };
 
@@ -172,6 +186,10 @@ void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network)
 
     setPrecisionsAndLayouts(inputs.children("in"), network.getInputsInfo());
     setPrecisionsAndLayouts(outputs.children("out"), network.getOutputsInfo());
+
+    _warmUpShapes = root.child("warm_up").attribute("shapes").value();
+    _tunedStreams.streams = root.child("tuned_streams").attribute("value").as_int();
+    _tunedStreams.host = root.child("tuned_streams").attribute("host").value();
 }
 
 }   // namespace intel_cpu
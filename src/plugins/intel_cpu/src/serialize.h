@@ -3,6 +3,7 @@
 //
 #pragma once
 #include "extension_mngr.h"
+#include "streams_tuner.h"
 
 #include <iostream>
 #include <functional>
@@ -13,12 +14,15 @@ namespace intel_cpu {
 
 class CNNNetworkSerializer {
 public:
-    CNNNetworkSerializer(std::ostream & ostream, ExtensionManager::Ptr extensionManager);
+    CNNNetworkSerializer(std::ostream & ostream, ExtensionManager::Ptr extensionManager, std::string warmUpShapes = {},
+                         StreamsTuner::Result tunedStreams = {});
     void operator << (const InferenceEngine::CNNNetwork & network);
 
 private:
     std::ostream & _ostream;
     ExtensionManager::Ptr _extensionManager;
+    std::string _warmUpShapes;
+    StreamsTuner::Result _tunedStreams{};
 };
 
 class CNNNetworkDeserializer {
@@ -29,10 +33,20 @@ public:
                         const InferenceEngine::Blob::CPtr&)> cnn_network_builder;
     CNNNetworkDeserializer(std::istream & istream, cnn_network_builder fn);
     void operator >> (InferenceEngine::CNNNetwork & network);
+    // Warm-up shapes the exported network was compiled with, empty for the blobs exported without them.
+    const std::string& getWarmUpShapes() const {
+        return _warmUpShapes;
+    }
+    // Streams picked by the auto-tuning of the exported network, zero streams for the blobs exported without them.
+    const StreamsTuner::Result& getTunedStreams() const {
+        return _tunedStreams;
+    }
 
 private:
     std::istream & _istream;
     cnn_network_builder _cnn_network_builder;
+    std::string _warmUpShapes;
+    StreamsTuner::Result _tunedStreams{};
 };
 
 // const std::string& model, const Blob::CPtr& weights
@@ -0,0 +1,113 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "streams_tuner.h"
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+
+#include <cpp/ie_infer_request.hpp>
+#include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
+#include <ie_system_conf.h>
+#include "onednn/dnnl.h"
+
+#include "itt.h"
+
+using namespace InferenceEngine;
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+// Constant values instead of random ones: no NaN or denormal inputs, which would distort the measurements
+void fillSynthetic(const Blob::Ptr& blob) {
+    auto memoryBlob = as<MemoryBlob>(blob);
+    if (!memoryBlob)
+        return;
+    auto lock = memoryBlob->wmap();
+    if (blob->getTensorDesc().getPrecision() == Precision::FP32) {
+        auto data = lock.as<float*>();
+        std::fill(data, data + blob->size(), 0.5f);
+    } else {
+        std::memset(lock.as<uint8_t*>(), 0, blob->byteSize());
+    }
+}
+}   // namespace
+
+constexpr std::chrono::milliseconds StreamsTuner::calibrationTime;
+
+StreamsTuner::StreamsTuner(NetworkFactory factory, std::vector<std::string> inputNames)
+    : factory(std::move(factory)), inputNames(std::move(inputNames)) {}
+
+std::vector<int> StreamsTuner::getCandidates(int heuristicStreams, int numCores, int maxStreams) {
+    std::vector<int> candidates{heuristicStreams};
+    for (int streams = numCores; streams >= 1; streams /= 2)
+        candidates.push_back(streams);
+    for (auto& streams : candidates)
+        streams = std::max(1, maxStreams > 0 ? std::min(streams, maxStreams) : streams);
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+    return candidates;
+}
+
+std::string StreamsTuner::getHostSignature() {
+    std::ostringstream signature;
+    signature << static_cast<int>(dnnl::get_effective_cpu_isa()) << "/" << getNumberOfCPUCores() << "/"
+              << getNumberOfLogicalCPUCores() << "/" << dnnl::utils::get_cache_size(2, true) << "/"
+              << dnnl::utils::get_cache_size(3, true);
+    return signature.str();
+}
+
+double StreamsTuner::measureThroughput(const IExecutableNetworkInternal::Ptr& network, int requests) const {
+    std::vector<IInferRequestInternal::Ptr> inferRequests;
+    for (int i = 0; i < requests; i++) {
+        inferRequests.push_back(network->CreateInferRequest());
+        for (const auto& name : inputNames)
+            fillSynthetic(inferRequests.back()->GetBlob(name));
+    }
+
+    // the first inference of every stream creates the primitives
+    for (const auto& request : inferRequests)
+        request->StartAsync();
+    for (const auto& request : inferRequests)
+        request->Wait(InferenceEngine::InferRequest::WaitMode::RESULT_READY);
+
+    using Clock = std::chrono::steady_clock;
+    const auto start = Clock::now();
+    size_t completed = 0;
+    for (const auto& request : inferRequests)
+        request->StartAsync();
+    while (Clock::now() - start < calibrationTime) {
+        for (const auto& request : inferRequests) {
+            request->Wait(InferenceEngine::InferRequest::WaitMode::RESULT_READY);
+            completed++;
+            request->StartAsync();
+        }
+    }
+    for (const auto& request : inferRequests) {
+        request->Wait(InferenceEngine::InferRequest::WaitMode::RESULT_READY);
+        completed++;
+    }
+    const std::chrono::duration<double> elapsed = Clock::now() - start;
+    return completed / elapsed.count();
+}
+
+StreamsTuner::Result StreamsTuner::tune(int heuristicStreams, int maxStreams) const {
+    OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, "StreamsTuner::tune");
+    Result result{heuristicStreams, getHostSignature()};
+    double bestThroughput = 0;
+    for (const auto streams : getCandidates(heuristicStreams, getNumberOfCPUCores(), maxStreams)) {
+        const double throughput = measureThroughput(factory(streams), streams);
+        // the candidates are sorted, more streams have to be noticeably faster to pay for their memory and latency
+        if (throughput > bestThroughput * 1.02) {
+            bestThroughput = throughput;
+            result.streams = streams;
+        }
+    }
+    return result;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,53 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpp_interfaces/interface/ie_iexecutable_network_internal.hpp>
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Picks the number of streams of the throughput hint by a short calibration on the current host.
+ * The model is compiled with every candidate number of streams and inferred with one request per stream on
+ * synthetic inputs, the candidate with the best throughput wins. The static heuristic value is one of the candidates.
+ */
+class StreamsTuner {
+public:
+    // Creates the executable network with the given number of streams
+    using NetworkFactory = std::function<InferenceEngine::IExecutableNetworkInternal::Ptr(int streams)>;
+
+    // The number of streams picked by the calibration and the host it is valid for
+    struct Result {
+        int streams;
+        std::string host;
+    };
+
+    StreamsTuner(NetworkFactory factory, std::vector<std::string> inputNames);
+
+    Result tune(int heuristicStreams, int maxStreams) const;
+
+    // The heuristic value, the number of cores and the number of cores divided by the powers of two
+    static std::vector<int> getCandidates(int heuristicStreams, int numCores, int maxStreams);
+
+    // The tuned streams are reused only on the hosts with the same ISA, number of cores and cache sizes
+    static std::string getHostSignature();
+
+private:
+    double measureThroughput(const InferenceEngine::IExecutableNetworkInternal::Ptr& network, int requests) const;
+
+    static constexpr std::chrono::milliseconds calibrationTime{250};
+
+    NetworkFactory factory;
+    std::vector<std::string> inputNames;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,201 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "hw_perf_counters.h"
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+#include "ie_parallel.hpp"
+
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+#    include <tbb/task_arena.h>
+#    include <tbb/task_scheduler_observer.h>
+#endif
+
+#if defined(__linux__)
+#    include <linux/perf_event.h>
+#    include <sys/ioctl.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#endif
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+#if defined(__linux__)
+// the group leader is the first one, the order matches the reading of PERF_FORMAT_GROUP values
+const uint64_t groupEvents[] = {PERF_COUNT_HW_CPU_CYCLES,
+                                PERF_COUNT_HW_INSTRUCTIONS,
+                                PERF_COUNT_HW_CACHE_MISSES};
+constexpr size_t groupSize = sizeof(groupEvents) / sizeof(groupEvents[0]);
+
+int openEvent(uint64_t config, int groupFd) {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.read_format = PERF_FORMAT_GROUP;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    // the counters of the calling thread on any CPU
+    return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, groupFd, 0));
+}
+
+int currentThreadId() {
+    static thread_local const int threadId = static_cast<int>(syscall(SYS_gettid));
+    return threadId;
+}
+#endif
+}   // namespace
+
+HwPerfCounters::Values& HwPerfCounters::Values::operator+=(const Values& other) {
+    cycles += other.cycles;
+    instructions += other.instructions;
+    llcMisses += other.llcMisses;
+    return *this;
+}
+
+HwPerfCounters::Values HwPerfCounters::Values::operator-(const Values& other) const {
+    Values result;
+    result.cycles = cycles - other.cycles;
+    result.instructions = instructions - other.instructions;
+    result.llcMisses = llcMisses - other.llcMisses;
+    return result;
+}
+
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+// the workers join and leave the arena for every parallel region, and may work in other arenas in between
+struct HwPerfCounters::ArenaObserver : public tbb::task_scheduler_observer {
+    ArenaObserver(tbb::task_arena& arena, HwPerfCounters& counters)
+        : tbb::task_scheduler_observer(arena), counters(counters) {
+        observe(true);
+    }
+    ~ArenaObserver() override {
+        observe(false);
+    }
+    void on_scheduler_entry(bool) override {
+        counters.enterCurrentThread();
+    }
+    void on_scheduler_exit(bool) override {
+        counters.exitCurrentThread();
+    }
+
+    HwPerfCounters& counters;
+};
+#else
+struct HwPerfCounters::ArenaObserver {};
+#endif
+
+HwPerfCounters::HwPerfCounters() {
+#if defined(__linux__)
+    static_assert(groupSize == eventsPerGroup, "Every group must have all the events");
+    // the threads of the process may enter the arena, the groups of the threads beyond are not opened
+    const auto maxThreads = std::max(static_cast<size_t>(std::thread::hardware_concurrency()),
+                                     static_cast<size_t>(InferenceEngine::parallel_get_max_threads()));
+    groups.resize(2 * maxThreads + 1);
+    enterCurrentThread();
+    if (!available())
+        return;
+#    if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+    // the creating thread executes the graph in its arena, the workers are counted while they are in it
+    tbb::task_arena arena{tbb::task_arena::attach{}};
+    observer.reset(new ArenaObserver(arena, *this));
+#    else
+    // the threads of the other backends stay in the team, so their groups are opened once
+    InferenceEngine::parallel_nt(0, [this](const int, const int) {
+        enterCurrentThread();
+    });
+#    endif
+#endif
+}
+
+HwPerfCounters::~HwPerfCounters() {
+    // no notifications come after the observation is stopped
+    observer.reset();
+#if defined(__linux__)
+    const size_t count = groupsCount.load(std::memory_order_acquire);
+    for (size_t i = 0; i < count; i++) {
+        for (auto fd : groups[i].fds)
+            close(fd);
+    }
+#endif
+}
+
+int HwPerfCounters::findGroup(int threadId) const {
+    const size_t count = groupsCount.load(std::memory_order_acquire);
+    for (size_t i = 0; i < count; i++) {
+        if (groups[i].threadId == threadId)
+            return static_cast<int>(i);
+    }
+    return -1;
+}
+
+void HwPerfCounters::enterCurrentThread() {
+#if defined(__linux__)
+    const int threadId = currentThreadId();
+    int idx = findGroup(threadId);
+    if (idx < 0) {
+        std::lock_guard<std::mutex> lock(groupsMutex);
+        idx = findGroup(threadId);
+        const size_t count = groupsCount.load(std::memory_order_relaxed);
+        if (idx < 0 && count < groups.size()) {
+            Group group;
+            group.threadId = threadId;
+            for (size_t i = 0; i < groupSize; i++) {
+                group.fds[i] = openEvent(groupEvents[i], i == 0 ? -1 : group.fds[0]);
+                if (group.fds[i] < 0) {
+                    // the group is measured completely or not at all
+                    for (size_t j = 0; j < i; j++)
+                        close(group.fds[j]);
+                    return;
+                }
+            }
+            ioctl(group.fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            groups[count] = group;
+            groupsCount.store(count + 1, std::memory_order_release);
+            idx = static_cast<int>(count);
+        }
+    }
+    if (idx >= 0)
+        ioctl(groups[idx].fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+}
+
+void HwPerfCounters::exitCurrentThread() {
+#if defined(__linux__)
+    const int idx = findGroup(currentThreadId());
+    if (idx >= 0)
+        ioctl(groups[idx].fds[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+#endif
+}
+
+bool HwPerfCounters::available() const {
+    return groupsCount.load(std::memory_order_acquire) != 0;
+}
+
+HwPerfCounters::Values HwPerfCounters::read() const {
+    Values total;
+#if defined(__linux__)
+    const size_t count = groupsCount.load(std::memory_order_acquire);
+    for (size_t i = 0; i < count; i++) {
+        // PERF_FORMAT_GROUP layout: number of events followed by the values
+        uint64_t buffer[1 + groupSize] = {};
+        if (::read(groups[i].fds[0], buffer, sizeof(buffer)) != static_cast<ssize_t>(sizeof(buffer)) || buffer[0] != groupSize)
+            continue;
+        Values values;
+        values.cycles = buffer[1];
+        values.instructions = buffer[2];
+        values.llcMisses = buffer[3];
+        total += values;
+    }
+#endif
+    return total;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
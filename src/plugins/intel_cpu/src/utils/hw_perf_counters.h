@@ -0,0 +1,72 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Hardware performance counters of the threads executing a graph (Linux perf_event_open).
+ * A counter group is opened for the creating thread and lazily for every worker entering the parallel arena of the
+ * creating thread, the groups of the workers count only while they are in the arena. The values are summed over all
+ * the groups, so the difference of two reads covers the parallel work done in between. Without perf events support
+ * (other OS, perf_event_paranoid restrictions, virtual machines without PMU) the counters are not available and read()
+ * returns zeros.
+ */
+class HwPerfCounters {
+public:
+    using Ptr = std::shared_ptr<HwPerfCounters>;
+
+    struct Values {
+        uint64_t cycles = 0;
+        uint64_t instructions = 0;
+        uint64_t llcMisses = 0;
+
+        Values& operator+=(const Values& other);
+        Values operator-(const Values& other) const;
+    };
+
+    HwPerfCounters();
+    ~HwPerfCounters();
+
+    HwPerfCounters(const HwPerfCounters&) = delete;
+    HwPerfCounters& operator=(const HwPerfCounters&) = delete;
+
+    bool available() const;
+    // reads the groups without locking, so it's cheap enough to be called around every node
+    Values read() const;
+
+private:
+    struct ArenaObserver;
+
+    // enables the group of the current thread, the group is opened on the first call
+    void enterCurrentThread();
+    // disables the group of the current thread, so the work out of the arena is not counted
+    void exitCurrentThread();
+
+    static constexpr int eventsPerGroup = 3;
+
+    // leader (cycles) descriptor of every opened group followed by the other events descriptors
+    struct Group {
+        int threadId = -1;
+        int fds[eventsPerGroup] = {};
+    };
+
+    int findGroup(int threadId) const;
+
+    // the groups are appended under the mutex, but published by the count, so they are read without locking
+    std::mutex groupsMutex;
+    std::vector<Group> groups;
+    std::atomic<size_t> groupsCount{0};
+    std::unique_ptr<ArenaObserver> observer;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
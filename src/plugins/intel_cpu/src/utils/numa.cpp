@@ -0,0 +1,48 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "numa.h"
+
+#include <cstdint>
+#include <vector>
+
+#if defined(__linux__)
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#endif
+
+namespace ov {
+namespace intel_cpu {
+
+size_t bindToNumaNode(void* ptr, size_t size, int numaNodeId) {
+#if defined(__linux__) && defined(SYS_mbind)
+    if (ptr == nullptr || size == 0 || numaNodeId < 0)
+        return 0;
+
+    // values of <numaif.h>, libnuma is not required for a single system call
+    constexpr int mpolPreferred = 1;
+    constexpr unsigned mpolMfMove = 1 << 1;
+
+    // the first and the last pages may hold other objects, they must not be moved, so only whole pages are bound
+    const auto pageSize = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    const auto begin = (reinterpret_cast<uintptr_t>(ptr) + pageSize - 1) & ~(pageSize - 1);
+    const auto end = (reinterpret_cast<uintptr_t>(ptr) + size) & ~(pageSize - 1);
+    if (end <= begin)
+        return 0;
+
+    constexpr size_t maskBits = sizeof(unsigned long) * 8;
+    std::vector<unsigned long> nodeMask(numaNodeId / maskBits + 1, 0);
+    nodeMask[numaNodeId / maskBits] = 1ul << (numaNodeId % maskBits);
+
+    // the kernel reads maxnode - 1 bits of the mask
+    const auto result = syscall(SYS_mbind, begin, end - begin, mpolPreferred, nodeMask.data(),
+                                nodeMask.size() * maskBits + 1, mpolMfMove);
+    return result == 0 ? static_cast<size_t>(end - begin) : 0;
+#else
+    return 0;
+#endif
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
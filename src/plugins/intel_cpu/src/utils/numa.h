@@ -0,0 +1,21 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <cstddef>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Makes the NUMA node preferred for the memory pages of the buffer and moves the pages which are already
+ * allocated on other nodes. The pages which are not touched yet are allocated on the node on the first touch.
+ * Only the pages lying entirely inside the buffer are bound, the pages shared with other objects are left as is.
+ * @return bytes of the bound pages, 0 if the OS does not support the memory policies or the call failed,
+ * the memory stays usable anyway
+ */
+size_t bindToNumaNode(void* ptr, size_t size, int numaNodeId);
+
+}   // namespace intel_cpu
+}   // namespace ov
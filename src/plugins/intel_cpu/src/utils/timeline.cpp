@@ -0,0 +1,85 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "timeline.h"
+
+#include <functional>
+#include <sstream>
+#include <thread>
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+std::string escapeJson(const std::string& str) {
+    std::string result;
+    result.reserve(str.size());
+    for (const auto c : str) {
+        switch (c) {
+        case '"': result += "\\\""; break;
+        case '\\': result += "\\\\"; break;
+        case '\n': result += "\\n"; break;
+        case '\t': result += "\\t"; break;
+        default:
+            if (static_cast<unsigned char>(c) >= 0x20)
+                result += c;
+        }
+    }
+    return result;
+}
+}   // namespace
+
+Timeline::Scope::Scope(const Ptr& timeline, const char* category, const std::string& name) {
+    if (!timeline)
+        return;
+    this->timeline = timeline.get();
+    this->category = category;
+    this->name = name;
+    start = Clock::now();
+}
+
+Timeline::Scope::~Scope() {
+    if (timeline)
+        timeline->addEvent(category, std::move(name), start, Clock::now());
+}
+
+Timeline::Timeline() : origin(Clock::now()) {}
+
+void Timeline::addEvent(const char* category, std::string name, Clock::time_point start, Clock::time_point end) {
+    using std::chrono::duration_cast;
+    using std::chrono::microseconds;
+
+    Event event{category,
+                std::move(name),
+                static_cast<uint64_t>(duration_cast<microseconds>(start - origin).count()),
+                static_cast<uint64_t>(duration_cast<microseconds>(end - start).count()),
+                static_cast<uint64_t>(std::hash<std::thread::id>{}(std::this_thread::get_id()) & 0xFFFFFFFF)};
+
+    std::lock_guard<std::mutex> lock{eventsMutex};
+    events.emplace_back(std::move(event));
+}
+
+std::string Timeline::toChromeTrace() const {
+    std::lock_guard<std::mutex> lock{eventsMutex};
+
+    std::stringstream ss;
+    ss << "{\"traceEvents\":[";
+    for (size_t i = 0; i < events.size(); i++) {
+        const auto& event = events[i];
+        if (i)
+            ss << ",";
+        ss << "{\"name\":\"" << escapeJson(event.name) << "\","
+           << "\"cat\":\"" << event.category << "\","
+           << "\"ph\":\"X\","
+           << "\"ts\":" << event.startUs << ","
+           << "\"dur\":" << event.durationUs << ","
+           << "\"pid\":0,"
+           << "\"tid\":" << event.threadId << "}";
+    }
+    ss << "],\"displayTimeUnit\":\"ms\"}";
+    return ss.str();
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
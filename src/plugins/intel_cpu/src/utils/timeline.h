@@ -0,0 +1,65 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Collects the compilation and first inference events of a compiled model.
+ * The collector is always enabled: it records only the one-time work (transformations, graph initialization,
+ * primitive creation and the first inference of every stream graph), so the steady state inference is not affected.
+ * The events are reported as Chrome trace JSON (chrome://tracing, Perfetto).
+ */
+class Timeline {
+public:
+    using Ptr = std::shared_ptr<Timeline>;
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Records the event covering the scope lifetime. Does nothing for the null timeline.
+     */
+    class Scope {
+    public:
+        Scope(const Ptr& timeline, const char* category, const std::string& name);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        Timeline* timeline = nullptr;
+        const char* category = nullptr;
+        std::string name;
+        Clock::time_point start;
+    };
+
+    Timeline();
+
+    void addEvent(const char* category, std::string name, Clock::time_point start, Clock::time_point end);
+
+    std::string toChromeTrace() const;
+
+private:
+    struct Event {
+        const char* category;
+        std::string name;
+        uint64_t startUs;
+        uint64_t durationUs;
+        uint64_t threadId;
+    };
+
+    const Clock::time_point origin;
+    mutable std::mutex eventsMutex;
+    std::vector<Event> events;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
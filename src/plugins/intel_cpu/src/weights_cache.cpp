@@ -5,11 +5,29 @@
 #include "weights_cache.hpp"
 
 #include <ie_system_conf.h>
+#include <ie_parallel.hpp>
+#include <algorithm>
+#include <cstring>
 #include <memory>
+#include <vector>
+#include "utils/general_utils.h"
 
 namespace ov {
 namespace intel_cpu {
 
+namespace {
+WeightsSharing::Ptr getNumaNodeProcessWeights(int numa_id) {
+    static std::mutex guard;
+    static std::map<int, WeightsSharing::Ptr> processWeights;
+
+    std::lock_guard<std::mutex> lock(guard);
+    auto& weights = processWeights[numa_id];
+    if (!weights)
+        weights = std::make_shared<WeightsSharing>();
+    return weights;
+}
+}   // namespace
+
 const SimpleDataHash WeightsSharing::simpleCRC;
 
 WeightsSharing::SharedMemory::SharedMemory(
@@ -47,6 +65,13 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(
             || !((ptr = found->second) && (newPtr = ptr->sharedMemory.lock()))) {
             newPtr = create();
             ptr = std::make_shared<MemoryInfo>(newPtr, valid);
+            if (found == sharedWeights.end() && sharedWeights.size() >= 2 * pruneSize) {
+                // the process level store outlives the compiled models, so the released memory is forgotten here
+                for (auto it = sharedWeights.begin(); it != sharedWeights.end();) {
+                    it = it->second->sharedMemory.expired() ? sharedWeights.erase(it) : std::next(it);
+                }
+                pruneSize = std::max(pruneSize, sharedWeights.size());
+            }
             sharedWeights[key] = ptr;
         }
     }
@@ -71,9 +96,67 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) co
                                                 : std::unique_lock<std::mutex>(ptr->guard), ptr, newPtr);
 }
 
-NumaNodesWeights::NumaNodesWeights() {
+uint64_t WeightsSharing::getDataHash(const std::string& key, const void* data, size_t size) {
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        auto found = dataHashes.find(key);
+        if (found != dataHashes.end())
+            return found->second;
+    }
+
+    // the data is hashed by chunks in parallel, the chunk size is fixed, so the hash does not depend on threads number
+    constexpr size_t chunkSize = 1 << 20;
+    const auto bytes = static_cast<const unsigned char*>(data);
+    std::vector<uint64_t> chunkHashes(div_up(size, chunkSize));
+    InferenceEngine::parallel_for(chunkHashes.size(), [&](size_t i) {
+        chunkHashes[i] = simpleCRC.hash(bytes + i * chunkSize, std::min(chunkSize, size - i * chunkSize));
+    });
+    const auto hash = simpleCRC.hash(reinterpret_cast<const unsigned char*>(chunkHashes.data()),
+                                     chunkHashes.size() * sizeof(uint64_t));
+
+    std::lock_guard<std::mutex> lock(guard);
+    dataHashes[key] = hash;
+    return hash;
+}
+
+std::string WeightsSharing::getSourceKey(const std::string& key, const MemoryCPtr& source) {
+    MemoryCPtr registered;
+    size_t generation = 0;
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        auto found = sources.find(key);
+        if (found == sources.end() && sources.size() >= 2 * sourcesPruneSize) {
+            for (auto it = sources.begin(); it != sources.end();) {
+                it = it->second.memory.expired() ? sources.erase(it) : std::next(it);
+            }
+            sourcesPruneSize = std::max(sourcesPruneSize, sources.size());
+        }
+        auto& info = found != sources.end() ? found->second : sources[key];
+        registered = info.memory.lock();
+        if (!registered) {
+            // the data derived from a released source can not be verified anymore, so they are not matched again
+            info.memory = source;
+            info.generation = ++lastSourceGeneration;
+            return key + "#" + std::to_string(info.generation);
+        }
+        generation = info.generation;
+    }
+
+    if (registered != source) {
+        const auto size = source->GetSize();
+        if (registered->GetSize() != size)
+            return {};
+        const void* registeredData = registered->GetData();
+        const void* sourceData = source->GetData();
+        if (registeredData != sourceData && std::memcmp(registeredData, sourceData, size) != 0)
+            return {};
+    }
+    return key + "#" + std::to_string(generation);
+}
+
+NumaNodesWeights::NumaNodesWeights(const MemoryAllocatorPtr& memoryAllocator) {
     for (auto numa_id : InferenceEngine::getAvailableNUMANodes())
-        _cache_map[numa_id] = std::make_shared<WeightsSharing>();
+        _cache_map[numa_id] = std::make_shared<WeightsSharing>(getNumaNodeProcessWeights(numa_id), memoryAllocator);
 }
 
 WeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) {
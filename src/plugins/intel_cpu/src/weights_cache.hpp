@@ -70,6 +70,10 @@ class WeightsSharing {
 public:
     typedef std::shared_ptr<WeightsSharing> Ptr;
 
+    WeightsSharing() = default;
+    explicit WeightsSharing(Ptr processWeights, MemoryAllocatorPtr memoryAllocator = nullptr)
+        : processWeights(std::move(processWeights)), memoryAllocator(std::move(memoryAllocator)) {}
+
     class SharedMemory {
     public:
         typedef std::shared_ptr<SharedMemory> Ptr;
@@ -94,22 +98,59 @@ public:
 
     SharedMemory::Ptr get(const std::string& key) const;
 
+    /**
+     * Store shared by all the compiled models of the process on the same NUMA node (may be nullptr).
+     * Its keys must be defined by the stored data (e.g. source data hash and memory descriptor)
+     * and must not depend on the names of the model nodes.
+     */
+    const Ptr& getProcessWeights() const { return processWeights; }
+
+    /**
+     * Returns the hash of the data, it is calculated once for the key.
+     * The key must identify the data among all the users of this store.
+     */
+    uint64_t getDataHash(const std::string& key, const void* data, size_t size);
+
+    /**
+     * Returns the key of the source data in this store, the keys derived from it identify the data produced from the
+     * source. The data hash may collide, so the source is compared byte by byte with the data first registered for the
+     * key while that data is alive. Returns an empty string if the data differ, the source must not be shared then.
+     */
+    std::string getSourceKey(const std::string& key, const MemoryCPtr& source);
+
+    /**
+     * Allocator of the weights and activations memory of the graphs using this store (nullptr for the default one).
+     */
+    const MemoryAllocatorPtr& getMemoryAllocator() const { return memoryAllocator; }
+
     static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
 
 protected:
     mutable std::mutex guard;
     std::unordered_map<std::string, MemoryInfo::Ptr> sharedWeights;
+    std::unordered_map<std::string, uint64_t> dataHashes;
+    struct SourceInfo {
+        std::weak_ptr<const Memory> memory;
+        size_t generation = 0;
+    };
+    std::unordered_map<std::string, SourceInfo> sources;
+    size_t sourcesPruneSize = 1024;
+    size_t lastSourceGeneration = 0;
+    size_t pruneSize = 1024;
+    Ptr processWeights;
+    MemoryAllocatorPtr memoryAllocator;
     static const SimpleDataHash simpleCRC;
 };
 
 /**
  * Collection of memory caching store per NUMA node(former socket)
+ * Stores of the same NUMA node share the process level store (see WeightsSharing::getProcessWeights)
  *
  * Is a thread safe
  */
 class NumaNodesWeights {
 public:
-    NumaNodesWeights();
+    explicit NumaNodesWeights(const MemoryAllocatorPtr& memoryAllocator = nullptr);
 
     WeightsSharing::Ptr& operator[](int i);
     const WeightsSharing::Ptr& operator[](int i) const;
@@ -3,6 +3,8 @@
 //
 
 #include <future>
+#include <iostream>
+#include <set>
 
 #include <gtest/gtest.h>
 
@@ -187,6 +189,161 @@ TEST_P(ASyncTaskExecutorTests, runAndWaitDoesNotOwnTasks) {
     ASSERT_EQ(1, useCount);
 }
 
+class CPUStreamsExecutorStressTests : public ::testing::TestWithParam<int> {};
+
+// Many producers and short tasks, the tasks overflow the stream queues, so all the scheduling paths are covered
+TEST_P(CPUStreamsExecutorStressTests, allTasksAreExecutedFromMultipleProducers) {
+    const auto streams = GetParam();
+    CPUStreamsExecutor executor{IStreamsExecutor::Config{"TestCPUStreamsExecutor", streams, 1,
+                                                         IStreamsExecutor::ThreadBindingType::NONE}};
+    const int producersNumber = 8;
+    const int tasksPerProducer = 20000;
+    std::atomic_int executed = {0};
+    std::mutex doneMutex;
+    std::condition_variable doneCondVar;
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < producersNumber; p++) {
+        producers.emplace_back([&, p] {
+            for (int i = 0; i < tasksPerProducer; i++) {
+                auto task = [&] {
+                    if (++executed == producersNumber * tasksPerProducer) {
+                        std::lock_guard<std::mutex> lock{doneMutex};
+                        doneCondVar.notify_all();
+                    }
+                };
+                // a half of the producers binds the tasks to streams
+                if (p % 2)
+                    executor.run(std::move(task), static_cast<std::size_t>(p));
+                else
+                    executor.run(std::move(task));
+            }
+        });
+    }
+    for (auto&& producer : producers)
+        producer.join();
+    {
+        std::unique_lock<std::mutex> lock{doneMutex};
+        ASSERT_TRUE(doneCondVar.wait_for(lock, std::chrono::seconds(60), [&] {
+            return executed == producersNumber * tasksPerProducer;
+        }));
+    }
+}
+
+// Request-like pattern: every producer waits for its task before submitting the next one
+TEST_P(CPUStreamsExecutorStressTests, pingPongLatency) {
+    const auto streams = GetParam();
+    CPUStreamsExecutor executor{IStreamsExecutor::Config{"TestCPUStreamsExecutor", streams, 1,
+                                                         IStreamsExecutor::ThreadBindingType::NONE}};
+    const int producersNumber = std::max(1, streams / 2);
+    const int iterations = 2000;
+
+    std::vector<std::thread> producers;
+    std::atomic_int executed = {0};
+    for (int p = 0; p < producersNumber; p++) {
+        producers.emplace_back([&, p] {
+            for (int i = 0; i < iterations; i++) {
+                std::promise<void> promise;
+                auto future = promise.get_future();
+                executor.run([&] {
+                    ++executed;
+                    promise.set_value();
+                }, static_cast<std::size_t>(p));
+                future.wait();
+            }
+        });
+    }
+    for (auto&& producer : producers)
+        producer.join();
+    ASSERT_EQ(producersNumber * iterations, executed);
+}
+
+// A task bound to an idle stream can not be stolen, so every task is submitted when the previous one is released by
+// the stream thread, the stream is free then
+TEST_P(CPUStreamsExecutorStressTests, tasksWithSameAffinityKeyRunOnSameStreamWhenIdle) {
+    const auto streams = GetParam();
+    CPUStreamsExecutor executor{IStreamsExecutor::Config{"TestCPUStreamsExecutor", streams, 1,
+                                                         IStreamsExecutor::ThreadBindingType::NONE}};
+    struct ReleaseFlag {
+        explicit ReleaseFlag(std::atomic_bool& released) : released(released) {}
+        ~ReleaseFlag() {
+            released.store(true, std::memory_order_release);
+        }
+        std::atomic_bool& released;
+    };
+    const int iterations = 100;
+    for (std::size_t key = 0; key < static_cast<std::size_t>(streams); key++) {
+        std::set<std::thread::id> threads;
+        for (int i = 0; i < iterations; i++) {
+            std::atomic_bool released{false};
+            std::promise<std::thread::id> promise;
+            auto future = promise.get_future();
+            // the stream thread destroys the task after it is marked free
+            auto releaseFlag = std::make_shared<ReleaseFlag>(released);
+            executor.run([&promise, releaseFlag] {
+                promise.set_value(std::this_thread::get_id());
+            }, key);
+            releaseFlag.reset();
+            threads.insert(future.get());
+            while (!released.load(std::memory_order_acquire))
+                std::this_thread::yield();
+        }
+        ASSERT_EQ(1, threads.size()) << "affinity key " << key;
+    }
+}
+
+// Performance test, measures the scheduling overhead per task of the bound and unbound tasks from many producers and
+// the round trip of a task submitted by the request-like producers, run it explicitly to compare the executor changes
+TEST_P(CPUStreamsExecutorStressTests, DISABLED_schedulingOverheadPerTask) {
+    const auto streams = GetParam();
+    CPUStreamsExecutor executor{IStreamsExecutor::Config{"TestCPUStreamsExecutor", streams, 1,
+                                                         IStreamsExecutor::ThreadBindingType::NONE}};
+    const int producersNumber = 8;
+    const int tasksPerProducer = 100000;
+    const int totalTasks = producersNumber * tasksPerProducer;
+    std::atomic_int executed = {0};
+    std::promise<void> done;
+    auto doneFuture = done.get_future();
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> producers;
+    for (int p = 0; p < producersNumber; p++) {
+        producers.emplace_back([&, p] {
+            for (int i = 0; i < tasksPerProducer; i++) {
+                auto task = [&] {
+                    if (++executed == totalTasks)
+                        done.set_value();
+                };
+                if (p % 2)
+                    executor.run(std::move(task), static_cast<std::size_t>(p));
+                else
+                    executor.run(std::move(task));
+            }
+        });
+    }
+    for (auto&& producer : producers)
+        producer.join();
+    ASSERT_EQ(std::future_status::ready, doneFuture.wait_for(std::chrono::seconds(120)));
+    const auto overhead = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+    const int iterations = 10000;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        std::promise<void> promise;
+        auto future = promise.get_future();
+        executor.run([&] {
+            promise.set_value();
+        }, 0);
+        future.wait();
+    }
+    const auto roundTrip = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+    std::cout << "streams: " << streams << ", scheduling overhead per task: " << overhead.count() / totalTasks
+              << " ns, round trip per task: " << roundTrip.count() / iterations << " ns" << std::endl;
+}
+
+INSTANTIATE_TEST_SUITE_P(CPUStreamsExecutorStressTests, CPUStreamsExecutorStressTests, ::testing::Values(1, 4, 16, 64));
+
 class StreamsExecutorConfigTest : public ::testing::Test {};
 
 static auto Executors = ::testing::Values(
@@ -187,4 +187,22 @@ INSTANTIATE_TEST_SUITE_P(smoke_CompareWithRefsNumpy_axis_5, CumSumLayerCPUTest,
 INSTANTIATE_TEST_SUITE_P(smoke_CompareWithRefsNumpy_axis_6, CumSumLayerCPUTest, testCasesAxis_6, CumSumLayerCPUTest::getTestCaseName);
 INSTANTIATE_TEST_SUITE_P(smoke_CompareWithRefsNumpy_negative_axes, CumSumLayerCPUTest, testCasesAxis_negative, CumSumLayerCPUTest::getTestCaseName);
 
+const std::vector<InputShape> inShapesLongAxis = {
+    {{-1, -1},
+     {{2, 16384}, {1, 10000}, {3, 9000}}},
+
+    {{-1, -1, -1},
+     {{1, 8200, 3}, {2, 300, 600}, {1, 9000, 1}}},
+};
+
+const auto testCasesLongAxis = ::testing::Combine(
+    ::testing::ValuesIn(std::vector<ngraph::element::Type>{ngraph::element::i8, ngraph::element::i32}),
+    ::testing::ValuesIn(inShapesLongAxis),
+    ::testing::Values(axes[1]),
+    ::testing::ValuesIn(exclusive),
+    ::testing::ValuesIn(reverse)
+);
+
+INSTANTIATE_TEST_SUITE_P(smoke_CompareWithRefsNumpy_long_axis, CumSumLayerCPUTest, testCasesLongAxis, CumSumLayerCPUTest::getTestCaseName);
+
 } // namespace CPULayerTestsDefinitions
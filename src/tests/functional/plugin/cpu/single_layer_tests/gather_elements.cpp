@@ -136,5 +136,27 @@ INSTANTIATE_TEST_SUITE_P(smoke_set1, GatherElementsCPUTest,
                 ::testing::ValuesIn(filterCPUSpecificParams(cpuParams_4D))),
         GatherElementsCPUTest::getTestCaseName);
 
+const std::vector<std::vector<InputShape>> inDynamicShapeParamsInnermost = {
+    {{{-1, -1, -1}, {{2, 3, 17}, {3, 2, 40}, {1, 1, 15}}},
+     {{-1, -1, -1}, {{2, 3, 33}, {3, 2, 16}, {1, 1, 20}}}},
+    {{{{1, 10}, {1, 10}, {15, 64}}, {{1, 4, 64}, {2, 3, 15}}},
+     {{{1, 10}, {1, 10}, {15, 64}}, {{1, 4, 17}, {2, 3, 64}}}}
+};
+
+std::vector<CPUSpecificParams> cpuParams_3D = {
+        CPUSpecificParams({ncw}, {ncw}, {}, {})
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_innermost_axis, GatherElementsCPUTest,
+            ::testing::Combine(
+                ::testing::Combine(
+                    ::testing::ValuesIn(inDynamicShapeParamsInnermost),       // shape
+                    ::testing::ValuesIn(std::vector<int>({2, -1})),           // Axis
+                    ::testing::ValuesIn(std::vector<ElementType>({ElementType::bf16, ElementType::f32, ElementType::i8})),
+                    ::testing::Values(ElementType::i32),
+                    ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                ::testing::ValuesIn(filterCPUSpecificParams(cpuParams_3D))),
+        GatherElementsCPUTest::getTestCaseName);
+
 } // namespace
 } // namespace CPULayerTestsDefinitions
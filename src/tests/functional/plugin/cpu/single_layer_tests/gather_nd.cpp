@@ -188,6 +188,29 @@ const auto subset_BD2 = ::testing::Combine(
 INSTANTIATE_TEST_SUITE_P(smoke_GatherND5DynamicBD_2, GatherNDLayerCPUTest, subset_BD2, GatherNDLayerCPUTest::getTestCaseName);
 INSTANTIATE_TEST_SUITE_P(smoke_GatherND8DynamicBD_2, GatherND8LayerCPUTest, subset_BD2, GatherNDLayerCPUTest::getTestCaseName);
 
+// Elementwise case with enough index tuples to be processed by vectors.
+const std::vector<InputShape> inputShapesDynamicElementwise = {
+        {{-1, -1},                                // dynamic
+         {{8, 10}, {16, 16}, {8, 8}}},            // target
+
+        {{{8, 16}, {8, 16}},                      // dynamic
+         {{8, 8}, {12, 9}, {16, 8}}},             // target
+};
+
+const std::vector<std::pair<Shape, std::vector<int>>> indexesShapesElementwise = {
+        std::pair<Shape, std::vector<int>>{{20, 2}, {0, 1, 3, 6, 6, 3, 1, 0, 4, 5, 7, 2, 2, 7, 5, 4, 0, 1, 3, 6,
+                                                     6, 3, 1, 0, 4, 5, 7, 2, 2, 7, 5, 4, 0, 1, 3, 6, 6, 3, 1, 0}},
+};
+
+const auto subset_Elementwise = ::testing::Combine(
+        ::testing::ValuesIn(inputShapesDynamicElementwise),
+        ::testing::ValuesIn(indexesShapesElementwise),
+        ::testing::ValuesIn(inputPrecisions),
+        ::testing::ValuesIn(indexesPrecisions),
+        ::testing::Values(0));
+
+INSTANTIATE_TEST_SUITE_P(smoke_GatherND5DynamicElementwise, GatherNDLayerCPUTest, subset_Elementwise, GatherNDLayerCPUTest::getTestCaseName);
+INSTANTIATE_TEST_SUITE_P(smoke_GatherND8DynamicElementwise, GatherND8LayerCPUTest, subset_Elementwise, GatherNDLayerCPUTest::getTestCaseName);
 
 }  // namespace
 } // namespace CPULayerTestsDefinitions
\ No newline at end of file
@@ -0,0 +1,72 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+
+#include <cstring>
+
+using namespace ngraph;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+// The f64 input is converted to the f32 graph input by the infer request, so the conversion is done by the
+// asynchronous preprocessing stage. The model returns its input, so the output is the converted input.
+TEST(AsyncPreprocessing, ConvertedInputsMatchSyncInference) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    std::shared_ptr<ov::Core> ie = ov::test::utils::PluginCache::get().core();
+
+    const ov::Shape shape{1, 3, 64, 64};
+    auto param = std::make_shared<opset8::Parameter>(element::f64, shape);
+    param->get_output_tensor(0).set_names({"tensor_input_0"});
+    auto relu = std::make_shared<opset8::Relu>(param);
+    auto model = std::make_shared<ov::Model>(relu->outputs(), ParameterVector{param});
+
+    auto syncModel = ie->compile_model(model, "CPU", ov::num_streams(1));
+    auto asyncModel = ie->compile_model(model, "CPU", ov::num_streams(1), ov::enable_profiling(true),
+                                        ov::intel_cpu::async_preprocessing(true));
+    ASSERT_FALSE(syncModel.get_property(ov::intel_cpu::async_preprocessing));
+    ASSERT_TRUE(asyncModel.get_property(ov::intel_cpu::async_preprocessing));
+
+    std::vector<ov::Tensor> inputs;
+    std::vector<ov::InferRequest> asyncReqs;
+    for (size_t r = 0; r < 2; r++) {
+        ov::Tensor input(element::f64, shape);
+        auto inputData = input.data<double>();
+        for (size_t i = 0; i < input.get_size(); i++)
+            inputData[i] = static_cast<double>((i + r) % 17) + 0.25 * static_cast<double>(r + 1);
+        inputs.push_back(input);
+        asyncReqs.push_back(asyncModel.create_infer_request());
+        asyncReqs.back().set_tensor("tensor_input_0", input);
+        asyncReqs.back().start_async();
+    }
+
+    auto syncReq = syncModel.create_infer_request();
+    for (size_t r = 0; r < asyncReqs.size(); r++) {
+        asyncReqs[r].wait();
+        const auto actual = asyncReqs[r].get_output_tensor();
+        ASSERT_EQ(element::f32, actual.get_element_type());
+        ASSERT_EQ(shape, actual.get_shape());
+        const auto inputData = inputs[r].data<double>();
+        const auto outputData = actual.data<float>();
+        for (size_t i = 0; i < actual.get_size(); i++)
+            ASSERT_EQ(static_cast<float>(inputData[i]), outputData[i]) << "at " << i << " of request " << r;
+
+        syncReq.set_tensor("tensor_input_0", inputs[r]);
+        syncReq.infer();
+        const auto expected = syncReq.get_output_tensor();
+        ASSERT_EQ(0, std::memcmp(expected.data(), actual.data(), expected.get_byte_size()));
+
+        // the input was converted by the asynchronous stage, not by the graph stream
+        bool converted = false;
+        for (const auto& info : asyncReqs[r].get_profiling_info())
+            converted |= info.node_name == "InputPreprocessing" && info.status == ov::ProfilingInfo::Status::EXECUTED;
+        ASSERT_TRUE(converted);
+    }
+}
+
+} // namespace SubgraphTestsDefinitions
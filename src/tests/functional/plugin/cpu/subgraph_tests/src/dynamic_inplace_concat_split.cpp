@@ -0,0 +1,99 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+enum class InPlaceCase {
+    ConcatPastFirst,
+    ConcatPastLast,
+    Split
+};
+
+std::ostream& operator<<(std::ostream& os, InPlaceCase inPlaceCase) {
+    switch (inPlaceCase) {
+        case InPlaceCase::ConcatPastFirst: return os << "ConcatPastFirst";
+        case InPlaceCase::ConcatPastLast: return os << "ConcatPastLast";
+        case InPlaceCase::Split: return os << "Split";
+    }
+    return os;
+}
+
+/*
+    The dynamic Concat and Split with the dims before the axis equal to 1 are executed in place, the producers of the Concat
+    inputs write directly into the output memory and the consumers of the Split outputs read directly from the input memory:
+
+      past     cur                      data
+       |        |                        |
+       |      Relu                     Relu
+        \      /                         |
+     Concat (in place)            VariadicSplit (in place)
+           |                         /        \
+        Multiply               Multiply      Multiply
+*/
+class DynamicInPlaceConcatSplitTest : public testing::WithParamInterface<InPlaceCase>,
+                                      virtual public SubgraphBaseTest, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<InPlaceCase>& obj) {
+        std::ostringstream result;
+        result << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        selectedType = "unknown_FP32";
+
+        const auto precision = ov::element::f32;
+        const auto scale = ov::op::v0::Constant::create(precision, {1, 1, 1}, {0.5f});
+        ov::ParameterVector params;
+        ov::OutputVector outputs;
+        if (GetParam() == InPlaceCase::Split) {
+            init_input_shapes({{{1, -1, 8}, {{1, 5, 8}, {1, 3, 8}, {1, 12, 8}, {1, 12, 8}, {1, 2, 8}}}});
+            params = ngraph::builder::makeDynamicParams(precision, inputDynamicShapes);
+            auto relu = std::make_shared<ov::op::v0::Relu>(params[0]);
+            auto axis = ov::op::v0::Constant::create(ov::element::i64, {}, {1});
+            auto lengths = ov::op::v0::Constant::create(ov::element::i64, {2}, {2, -1});
+            auto split = std::make_shared<ov::op::v1::VariadicSplit>(relu, axis, lengths);
+            for (const auto& output : split->outputs())
+                outputs.push_back(std::make_shared<ov::op::v1::Multiply>(output, scale));
+        } else {
+            // the past grows by the current step like the key/value cache of the decoder
+            init_input_shapes({{{1, -1, 16}, {{1, 4, 16}, {1, 5, 16}, {1, 6, 16}, {1, 30, 16}, {1, 31, 16}, {1, 2, 16}}},
+                               {{1, -1, 16}, {{1, 1, 16}, {1, 1, 16}, {1, 1, 16}, {1, 1, 16}, {1, 7, 16}, {1, 1, 16}}}});
+            params = ngraph::builder::makeDynamicParams(precision, inputDynamicShapes);
+            auto cur = std::make_shared<ov::op::v0::Relu>(params[1]);
+            auto concat = GetParam() == InPlaceCase::ConcatPastFirst
+                              ? std::make_shared<ov::op::v0::Concat>(ov::OutputVector{params[0], cur}, 1)
+                              : std::make_shared<ov::op::v0::Concat>(ov::OutputVector{cur, params[0]}, 1);
+            outputs.push_back(std::make_shared<ov::op::v1::Multiply>(concat, scale));
+        }
+
+        ov::ResultVector results;
+        for (const auto& output : outputs)
+            results.push_back(std::make_shared<ov::op::v0::Result>(output));
+        function = std::make_shared<ov::Model>(results, params, "DynamicInPlaceConcatSplit");
+    }
+};
+
+TEST_P(DynamicInPlaceConcatSplitTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+    CheckPluginRelatedResults(compiledModel, GetParam() == InPlaceCase::Split ? "Split" : "Concatenation");
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_DynamicInPlaceConcatSplit, DynamicInPlaceConcatSplitTest,
+                         ::testing::Values(InPlaceCase::ConcatPastFirst,
+                                           InPlaceCase::ConcatPastLast,
+                                           InPlaceCase::Split),
+                         DynamicInPlaceConcatSplitTest::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
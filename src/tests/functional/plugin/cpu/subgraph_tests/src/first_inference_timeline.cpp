@@ -0,0 +1,86 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+
+using namespace ngraph;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+class FirstInferenceTimeline : public ::testing::TestWithParam<ov::PartialShape> {
+public:
+    static std::string getTestCaseName(::testing::TestParamInfo<ov::PartialShape> obj) {
+        std::ostringstream result;
+        result << "shape=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void Run() {
+        std::shared_ptr<ov::Core> ie = ov::test::utils::PluginCache::get().core();
+
+        auto param = std::make_shared<opset8::Parameter>(element::f32, GetParam());
+        param->get_output_tensor(0).set_names({"tensor_input_0"});
+        auto conv = builder::makeConvolution(param, element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                             op::PadType::EXPLICIT, 8);
+        conv->set_friendly_name("conv_0");
+        auto relu = std::make_shared<opset8::Relu>(conv);
+        auto model = std::make_shared<ov::Model>(relu->outputs(), ParameterVector{param});
+
+        auto compiled_model = ie->compile_model(model, "CPU", ov::num_streams(1));
+
+        auto timeline = compiled_model.get_property(ov::intel_cpu::first_inference_timeline);
+        ASSERT_EQ(0, timeline.find("{\"traceEvents\":["));
+        for (const auto& event : {"CommonTransformations", "ConvertToCPUSpecificOpset", "InitDescriptors", "CreatePrimitives"})
+            ASSERT_NE(std::string::npos, timeline.find(event)) << event;
+        ASSERT_EQ(std::string::npos, timeline.find("\"cat\":\"FirstInference\""));
+
+        auto req = compiled_model.create_infer_request();
+        req.set_tensor("tensor_input_0", ov::Tensor(element::f32, {1, 3, 8, 8}));
+        req.infer();
+
+        timeline = compiled_model.get_property(ov::intel_cpu::first_inference_timeline);
+        ASSERT_NE(std::string::npos, timeline.find("\"cat\":\"FirstInference\""));
+        ASSERT_NE(std::string::npos, timeline.find("conv_0"));
+
+        // Only the first inference is recorded.
+        req.infer();
+        ASSERT_EQ(timeline, compiled_model.get_property(ov::intel_cpu::first_inference_timeline));
+    }
+};
+
+TEST_P(FirstInferenceTimeline, CheckEvents) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    Run();
+}
+
+TEST(FirstInferenceTimeline, WarmUpIsNotRecorded) {
+    std::shared_ptr<ov::Core> ie = ov::test::utils::PluginCache::get().core();
+
+    auto param = std::make_shared<opset8::Parameter>(element::f32, ov::PartialShape{-1, 3, -1, -1});
+    auto conv = builder::makeConvolution(param, element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                         op::PadType::EXPLICIT, 8);
+    auto model = std::make_shared<ov::Model>(conv->outputs(), ParameterVector{param});
+
+    auto compiled_model = ie->compile_model(model, "CPU", ov::num_streams(1), ov::intel_cpu::warm_up_shapes("[1,3,8,8]"));
+    ASSERT_EQ(std::string::npos,
+              compiled_model.get_property(ov::intel_cpu::first_inference_timeline).find("\"cat\":\"FirstInference\""));
+
+    auto req = compiled_model.create_infer_request();
+    req.set_input_tensor(ov::Tensor(element::f32, {1, 3, 8, 8}));
+    req.infer();
+    ASSERT_NE(std::string::npos,
+              compiled_model.get_property(ov::intel_cpu::first_inference_timeline).find("\"cat\":\"FirstInference\""));
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_FirstInferenceTimeline,
+                         FirstInferenceTimeline,
+                         ::testing::Values(ov::PartialShape{1, 3, 8, 8}, ov::PartialShape{-1, 3, -1, -1}),
+                         FirstInferenceTimeline::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
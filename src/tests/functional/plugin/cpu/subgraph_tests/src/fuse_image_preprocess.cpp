@@ -0,0 +1,168 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "openvino/core/preprocess/pre_post_process.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+using namespace ov::preprocess;
+
+namespace SubgraphTestsDefinitions {
+
+enum class PreprocessCase {
+    MeanScaleLayout,
+    ReverseChannelsResize,
+    LayoutThenResize,
+    NV12Resize,
+    I420ToBGR
+};
+
+std::ostream& operator<<(std::ostream& os, PreprocessCase preprocessCase) {
+    switch (preprocessCase) {
+        case PreprocessCase::MeanScaleLayout: return os << "MeanScaleLayout";
+        case PreprocessCase::ReverseChannelsResize: return os << "ReverseChannelsResize";
+        case PreprocessCase::LayoutThenResize: return os << "LayoutThenResize";
+        case PreprocessCase::NV12Resize: return os << "NV12Resize";
+        case PreprocessCase::I420ToBGR: return os << "I420ToBGR";
+    }
+    return os;
+}
+
+/*
+    The chain of operations produced by PrePostProcessor at the model input is executed by a single ImagePreprocess node:
+
+        Parameter (u8, NHWC or NV12/I420)
+            |
+      [color conversion]
+            |
+         Convert
+            |
+        [resize]    ->   ImagePreprocess (f32, NCHW)
+            |
+    [reverse channels]
+            |
+      mean / scale
+            |
+        Transpose
+*/
+class FuseImagePreprocessTest : public testing::WithParamInterface<PreprocessCase>,
+                                virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<PreprocessCase>& obj) {
+        std::ostringstream result;
+        result << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert(ov::intel_cpu::image_preprocess_fusion(true));
+        // the color conversion of the u8 image is rounded, 1 LSB difference is allowed for the normalized values
+        abs_threshold = 1e-2;
+
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 3, 32, 32});
+        param->output(0).get_tensor().set_names({"input"});
+        auto result = std::make_shared<ov::op::v0::Result>(param);
+        function = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+
+        PrePostProcessor ppp(function);
+        auto& input = ppp.input();
+        input.model().set_layout("NCHW");
+        switch (GetParam()) {
+            case PreprocessCase::MeanScaleLayout:
+                input.tensor().set_element_type(ov::element::u8).set_layout("NHWC");
+                input.preprocess()
+                    .convert_element_type(ov::element::f32)
+                    .mean({123.675f, 116.28f, 103.53f})
+                    .scale({58.395f, 57.12f, 57.375f});
+                break;
+            case PreprocessCase::ReverseChannelsResize:
+                input.tensor().set_element_type(ov::element::u8).set_layout("NHWC").set_spatial_static_shape(48, 40);
+                input.preprocess()
+                    .convert_element_type(ov::element::f32)
+                    .reverse_channels()
+                    .resize(ResizeAlgorithm::RESIZE_LINEAR)
+                    .mean(127.5f)
+                    .scale(127.5f);
+                break;
+            case PreprocessCase::LayoutThenResize:
+                input.tensor().set_element_type(ov::element::u8).set_layout("NHWC").set_spatial_static_shape(20, 24);
+                input.preprocess()
+                    .convert_element_type(ov::element::f32)
+                    .convert_layout()
+                    .resize(ResizeAlgorithm::RESIZE_LINEAR)
+                    .scale(255.f);
+                break;
+            case PreprocessCase::NV12Resize:
+                input.tensor()
+                    .set_element_type(ov::element::u8)
+                    .set_color_format(ColorFormat::NV12_SINGLE_PLANE)
+                    .set_spatial_static_shape(48, 40);
+                input.preprocess()
+                    .convert_color(ColorFormat::RGB)
+                    .convert_element_type(ov::element::f32)
+                    .resize(ResizeAlgorithm::RESIZE_LINEAR)
+                    .scale(255.f);
+                break;
+            case PreprocessCase::I420ToBGR:
+                input.tensor()
+                    .set_element_type(ov::element::u8)
+                    .set_color_format(ColorFormat::I420_SINGLE_PLANE);
+                input.preprocess()
+                    .convert_element_type(ov::element::f32)
+                    .convert_color(ColorFormat::BGR)
+                    .mean(127.5f)
+                    .scale(127.5f);
+                break;
+        }
+        function = ppp.build();
+
+        std::vector<ov::Shape> inputShapes;
+        for (const auto& parameter : function->get_parameters())
+            inputShapes.push_back(parameter->get_shape());
+        targetStaticShapes.push_back(inputShapes);
+    }
+};
+
+TEST_P(FuseImagePreprocessTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "ImagePreprocess", 1);
+    CheckNumberOfNodesWithType(compiledModel, "Interpolate", 0);
+    CheckNumberOfNodesWithType(compiledModel, "ColorConvert", 0);
+}
+
+TEST(FuseImagePreprocess, DisabledByDefault) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    std::shared_ptr<ov::Core> ie = ov::test::utils::PluginCache::get().core();
+
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 3, 32, 32});
+    auto model = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(param)},
+                                             ov::ParameterVector{param});
+    PrePostProcessor ppp(model);
+    auto& input = ppp.input();
+    input.model().set_layout("NCHW");
+    input.tensor().set_element_type(ov::element::u8).set_layout("NHWC");
+    input.preprocess().convert_element_type(ov::element::f32).mean(127.5f).scale(127.5f);
+    model = ppp.build();
+
+    auto compiledModel = ie->compile_model(model, "CPU");
+    ASSERT_FALSE(compiledModel.get_property(ov::intel_cpu::image_preprocess_fusion));
+    CheckNumberOfNodesWithType(compiledModel, "ImagePreprocess", 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_FuseImagePreprocess, FuseImagePreprocessTest,
+                         ::testing::Values(PreprocessCase::MeanScaleLayout,
+                                           PreprocessCase::ReverseChannelsResize,
+                                           PreprocessCase::LayoutThenResize,
+                                           PreprocessCase::NV12Resize,
+                                           PreprocessCase::I420ToBGR),
+                         FuseImagePreprocessTest::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,79 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+
+using namespace ngraph;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+using HugePagesParams = std::tuple<ov::PartialShape,  // model input shape
+                                   int>;              // number of streams
+
+class HugePagesTest : public ::testing::TestWithParam<HugePagesParams> {
+public:
+    static std::string getTestCaseName(::testing::TestParamInfo<HugePagesParams> obj) {
+        ov::PartialShape inputShape;
+        int streams;
+        std::tie(inputShape, streams) = obj.param;
+        std::ostringstream result;
+        result << "IS=" << inputShape << "_streams=" << streams;
+        return result.str();
+    }
+
+protected:
+    static size_t allocatedBytes(const ov::CompiledModel& compiledModel) {
+        const auto statistics = compiledModel.get_property(ov::intel_cpu::huge_pages_statistics);
+        const std::string key = "\"allocated_bytes\":";
+        const auto pos = statistics.find(key);
+        if (pos == std::string::npos)
+            throw std::runtime_error("Unexpected huge pages statistics: " + statistics);
+        return std::stoull(statistics.substr(pos + key.size()));
+    }
+
+    void Run() {
+        ov::PartialShape inputShape;
+        int streams;
+        std::tie(inputShape, streams) = GetParam();
+
+        auto param = std::make_shared<opset8::Parameter>(element::f32, inputShape);
+        auto conv0 = builder::makeConvolution(param, element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                              op::PadType::EXPLICIT, 64);
+        auto conv1 = builder::makeConvolution(conv0, element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                              op::PadType::EXPLICIT, 8);
+        auto model = std::make_shared<ov::Model>(ResultVector{std::make_shared<opset8::Result>(conv1)},
+                                                 ParameterVector{param});
+
+        std::shared_ptr<ov::Core> core = ov::test::utils::PluginCache::get().core();
+        auto compiledModel = core->compile_model(model, "CPU", ov::intel_cpu::huge_pages("TRANSPARENT"),
+                                                 ov::num_streams(streams));
+        auto req = compiledModel.create_infer_request();
+        ov::Tensor input(element::f32, {1, 3, 128, 128});
+        std::fill_n(input.data<float>(), input.get_size(), 1.f);
+        req.set_input_tensor(input);
+        req.infer();
+
+        // the activations between the convolutions are allocated by the compiled model allocator
+        // whether the weights are cached or not and whether the shapes are static or not
+        const size_t activationsSize = 64 * 128 * 128 * sizeof(float);
+        ASSERT_GE(allocatedBytes(compiledModel), activationsSize);
+    }
+};
+
+TEST_P(HugePagesTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    Run();
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_HugePages, HugePagesTest,
+                         ::testing::Combine(::testing::Values(ov::PartialShape{1, 3, 128, 128},
+                                                              ov::PartialShape{1, 3, -1, -1}),
+                                            ::testing::Values(1, 2)),
+                         HugePagesTest::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
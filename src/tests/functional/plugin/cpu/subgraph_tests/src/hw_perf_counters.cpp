@@ -0,0 +1,93 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+
+#if defined(__linux__)
+#    include <cstring>
+#    include <linux/perf_event.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#endif
+
+using namespace ngraph;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+namespace {
+// the hardware counters are unavailable without PMU, with perf_event_paranoid restrictions or on other OS
+bool perfEventsAvailable() {
+#if defined(__linux__)
+    // the events counted by the plugin in a single group
+    std::vector<int> fds;
+    for (auto event : {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES}) {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = event;
+        attr.read_format = PERF_FORMAT_GROUP;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        const int fd = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, fds.empty() ? -1 : fds.front(), 0));
+        if (fd < 0)
+            break;
+        fds.push_back(fd);
+    }
+    for (auto fd : fds)
+        close(fd);
+    return fds.size() == 3;
+#else
+    return false;
+#endif
+}
+
+double metric(const std::string& execType, const std::string& name) {
+    const auto pos = execType.find(name + "=");
+    if (pos == std::string::npos)
+        throw std::runtime_error("No " + name + " in " + execType);
+    return std::stod(execType.substr(pos + name.size() + 1));
+}
+}  // namespace
+
+TEST(HwPerfCounters, ReportedByProfilingInfo) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    if (!perfEventsAvailable())
+        GTEST_SKIP() << "Hardware performance counters are not available";
+    std::shared_ptr<ov::Core> ie = ov::test::utils::PluginCache::get().core();
+
+    auto param = std::make_shared<opset8::Parameter>(element::f32, ov::Shape{1, 16, 32, 32});
+    auto weights = builder::makeConstant<float>(element::f32, {16, 16, 3, 3}, {}, true);
+    auto conv = std::make_shared<opset8::Convolution>(param, weights, Strides{1, 1}, CoordinateDiff{1, 1},
+                                                      CoordinateDiff{1, 1}, Strides{1, 1});
+    auto relu = std::make_shared<opset8::Relu>(conv);
+    auto model = std::make_shared<ov::Model>(relu->outputs(), ParameterVector{param});
+
+    auto compiledModel = ie->compile_model(model, "CPU", ov::intel_cpu::hw_perf_counters(true));
+    ASSERT_TRUE(compiledModel.get_property(ov::intel_cpu::hw_perf_counters));
+    // the hardware counters imply the profiling
+    ASSERT_TRUE(compiledModel.get_property(ov::enable_profiling));
+
+    auto req = compiledModel.create_infer_request();
+    for (int i = 0; i < 3; i++)
+        req.infer();
+
+    size_t executed = 0;
+    for (const auto& info : req.get_profiling_info()) {
+        if (info.status != ov::ProfilingInfo::Status::EXECUTED)
+            continue;
+        executed++;
+        ASSERT_NE(info.exec_type.find("[ipc="), std::string::npos) << info.node_name << ": " << info.exec_type;
+        ASSERT_NE(info.exec_type.find("dram_gbps="), std::string::npos) << info.exec_type;
+        // the node runs on the counted threads, so it executes some instructions in some cycles
+        ASSERT_GT(metric(info.exec_type, "ipc"), 0.0) << info.node_name << ": " << info.exec_type;
+    }
+    ASSERT_GT(executed, 0);
+}
+
+} // namespace SubgraphTestsDefinitions
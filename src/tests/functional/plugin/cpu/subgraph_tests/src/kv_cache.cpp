@@ -0,0 +1,126 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+
+using namespace ngraph;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+namespace {
+constexpr size_t heads = 2;
+constexpr size_t headSize = 8;
+
+/*
+    The key/value cache of the decoder is fused into a single KVCache node, the heads are read by MatMul without
+    a Transpose or a Reorder of the cache:
+
+      ReadValue(past)   cur
+               \       /
+           Concat(axis 2)  ->  Assign(past)
+                 |
+              MatMul(scale)
+*/
+std::shared_ptr<ov::Model> makeKVCacheModel() {
+    auto cur = std::make_shared<opset8::Parameter>(element::f32, ov::PartialShape{1, heads, -1, headSize});
+    auto init = opset8::Constant::create(element::f32, {1, heads, 0, headSize}, std::vector<float>{});
+    auto variable = std::make_shared<ov::op::util::Variable>(
+        ov::op::util::VariableInfo{ov::PartialShape{1, heads, -1, headSize}, element::f32, "past"});
+    auto past = std::make_shared<opset8::ReadValue>(init, variable);
+    auto concat = std::make_shared<opset8::Concat>(OutputVector{past, cur}, 2);
+    auto assign = std::make_shared<opset8::Assign>(concat, variable);
+    // the scale matrix is an input, so the MatMul is not converted to FullyConnected
+    auto scale = std::make_shared<opset8::Parameter>(element::f32, ov::Shape{1, 1, headSize, headSize});
+    auto matmul = std::make_shared<opset8::MatMul>(concat, scale);
+    return std::make_shared<ov::Model>(ResultVector{std::make_shared<opset8::Result>(matmul)}, SinkVector{assign},
+                                       ParameterVector{cur, scale});
+}
+
+ov::Tensor makeTokens(size_t length, float start) {
+    ov::Tensor tokens(ov::element::f32, {1, heads, length, headSize});
+    auto data = tokens.data<float>();
+    for (size_t i = 0; i < tokens.get_size(); i++)
+        data[i] = start + static_cast<float>(i) / 64.f;
+    return tokens;
+}
+
+ov::Tensor concatenate(const std::vector<ov::Tensor>& steps, float scale) {
+    size_t length = 0;
+    for (const auto& tokens : steps)
+        length += tokens.get_shape()[2];
+    ov::Tensor result(ov::element::f32, {1, heads, length, headSize});
+    size_t offset = 0;
+    for (const auto& tokens : steps) {
+        const auto stepLength = tokens.get_shape()[2];
+        for (size_t h = 0; h < heads; h++) {
+            for (size_t i = 0; i < stepLength * headSize; i++)
+                result.data<float>()[(h * length + offset) * headSize + i] = tokens.data<float>()[h * stepLength * headSize + i] * scale;
+        }
+        offset += stepLength;
+    }
+    return result;
+}
+
+ov::Tensor infer(ov::InferRequest& req, const ov::Tensor& tokens) {
+    ov::Tensor scale(ov::element::f32, {1, 1, headSize, headSize});
+    std::fill_n(scale.data<float>(), scale.get_size(), 0.f);
+    for (size_t i = 0; i < headSize; i++)
+        scale.data<float>()[i * headSize + i] = 0.5f;
+    req.set_input_tensor(0, tokens);
+    req.set_input_tensor(1, scale);
+    req.infer();
+    const auto output = req.get_output_tensor();
+    ov::Tensor result(output.get_element_type(), output.get_shape());
+    output.copy_to(result);
+    return result;
+}
+
+void compare(const ov::Tensor& expected, const ov::Tensor& actual) {
+    ASSERT_EQ(expected.get_shape(), actual.get_shape());
+    for (size_t i = 0; i < expected.get_size(); i++)
+        ASSERT_NEAR(expected.data<float>()[i], actual.data<float>()[i], 1e-5f);
+}
+}  // namespace
+
+TEST(KVCache, ValuesAreAppendedToRequestState) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    std::shared_ptr<ov::Core> ie = ov::test::utils::PluginCache::get().core();
+
+    auto compiledModel = ie->compile_model(makeKVCacheModel(), "CPU", ov::hint::inference_precision(ov::element::f32));
+    CheckNumberOfNodesWithType(compiledModel, "KVCache", 1);
+    CheckNumberOfNodesWithType(compiledModel, "Concatenation", 0);
+    // the heads are not outermost, but the cache is kept in the layout of the variable
+    CheckNumberOfNodesWithType(compiledModel, "Transpose", 0);
+    CheckNumberOfNodesWithType(compiledModel, "Reorder", 0);
+
+    // the requests share the graph, but keep their own caches
+    auto first = compiledModel.create_infer_request();
+    auto second = compiledModel.create_infer_request();
+    std::vector<ov::Tensor> firstSteps, secondSteps;
+    const std::vector<size_t> lengths{3, 1, 1, 40, 1, 1};
+    for (size_t step = 0; step < lengths.size(); step++) {
+        firstSteps.push_back(makeTokens(lengths[step], static_cast<float>(step)));
+        secondSteps.push_back(makeTokens(1, -static_cast<float>(step)));
+        compare(concatenate(firstSteps, 0.5f), infer(first, firstSteps.back()));
+        compare(concatenate(secondSteps, 0.5f), infer(second, secondSteps.back()));
+    }
+
+    auto states = first.query_state();
+    ASSERT_EQ(states.size(), 1);
+    ASSERT_EQ(states[0].get_name(), "past");
+    compare(concatenate(firstSteps, 1.f), states[0].get_state());
+
+    states[0].reset();
+    firstSteps = {makeTokens(2, 10.f)};
+    compare(concatenate(firstSteps, 0.5f), infer(first, firstSteps.back()));
+
+    states[0].set_state(concatenate(secondSteps, 1.f));
+    secondSteps.push_back(makeTokens(2, 20.f));
+    compare(concatenate(secondSteps, 0.5f), infer(first, secondSteps.back()));
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,96 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+#include <ie_system_conf.h>
+
+using namespace ngraph;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+struct NumaPlacementEntry {
+    int graph;
+    int numaNode;
+    size_t weightsBytes;
+    size_t activationsBytes;
+};
+
+static std::vector<NumaPlacementEntry> parseNumaPlacement(const std::string& placement) {
+    std::vector<NumaPlacementEntry> entries;
+    auto value = [&placement](const std::string& key, size_t from) -> std::string {
+        const auto pos = placement.find("\"" + key + "\":", from);
+        if (pos == std::string::npos)
+            throw std::runtime_error("No " + key + " in the NUMA placement: " + placement);
+        const auto begin = pos + key.size() + 3;
+        return placement.substr(begin, placement.find_first_of(",}", begin) - begin);
+    };
+    for (auto pos = placement.find('{'); pos != std::string::npos; pos = placement.find('{', pos + 1)) {
+        entries.push_back({std::stoi(value("graph", pos)), std::stoi(value("numa_node", pos)),
+                           std::stoull(value("weights_bytes", pos)), std::stoull(value("activations_bytes", pos))});
+    }
+    return entries;
+}
+
+class NumaPlacementTest : public ::testing::TestWithParam<int> {
+public:
+    static std::string getTestCaseName(::testing::TestParamInfo<int> obj) {
+        return "streams=" + std::to_string(obj.param);
+    }
+
+protected:
+    void Run() {
+        const int streams = GetParam();
+        auto param = std::make_shared<opset8::Parameter>(element::f32, ov::Shape{1, 16, 64, 64});
+        auto conv = builder::makeConvolution(param, element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                             op::PadType::EXPLICIT, 64);
+        auto model = std::make_shared<ov::Model>(ResultVector{std::make_shared<opset8::Result>(conv)},
+                                                 ParameterVector{param});
+
+        std::shared_ptr<ov::Core> core = ov::test::utils::PluginCache::get().core();
+        auto compiledModel = core->compile_model(model, "CPU", ov::num_streams(streams));
+
+        const auto supported = compiledModel.get_property(ov::supported_properties);
+        ASSERT_NE(std::find(supported.begin(), supported.end(), ov::intel_cpu::numa_placement.name()), supported.end());
+
+        std::vector<ov::InferRequest> requests;
+        for (int i = 0; i < streams; i++) {
+            requests.push_back(compiledModel.create_infer_request());
+            requests.back().start_async();
+        }
+        for (auto& req : requests)
+            req.wait();
+
+        const auto entries = parseNumaPlacement(compiledModel.get_property(ov::intel_cpu::numa_placement));
+        ASSERT_FALSE(entries.empty());
+        ASSERT_LE(entries.size(), static_cast<size_t>(streams));
+        const auto numaNodes = InferenceEngine::getAvailableNUMANodes();
+        for (const auto& entry : entries) {
+            ASSERT_GE(entry.graph, 0);
+            ASSERT_LT(entry.graph, streams);
+            if (entry.numaNode < 0) {
+                // the placement is left to the OS, nothing is bound
+                ASSERT_EQ(0, entry.weightsBytes);
+                ASSERT_EQ(0, entry.activationsBytes);
+            } else {
+                ASSERT_NE(std::find(numaNodes.begin(), numaNodes.end(), entry.numaNode), numaNodes.end());
+                ASSERT_GT(numaNodes.size(), 1);
+            }
+        }
+    }
+};
+
+TEST_P(NumaPlacementTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    Run();
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_NumaPlacement, NumaPlacementTest,
+                         ::testing::Values(1, 2),
+                         NumaPlacementTest::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,146 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+enum class AttentionCase {
+    ScaleMask,
+    TransposedInputsOutput,
+    DynamicSequence
+};
+
+std::ostream& operator<<(std::ostream& os, AttentionCase attentionCase) {
+    switch (attentionCase) {
+        case AttentionCase::ScaleMask: return os << "ScaleMask";
+        case AttentionCase::TransposedInputsOutput: return os << "TransposedInputsOutput";
+        case AttentionCase::DynamicSequence: return os << "DynamicSequence";
+    }
+    return os;
+}
+
+/*
+    The attention block is executed by a single ScaledDotProductAttention node:
+
+       Q     K
+       |     |
+   [Transpose] [Transpose]
+        \   /
+        MatMul
+          |
+     [Multiply(scale)]
+          |
+      [Add(mask)]     V
+          |           |
+       Softmax   [Transpose]     ->   ScaledDotProductAttention
+           \       /
+            MatMul
+              |
+         [Transpose]
+*/
+class ScaledDotProductAttentionTest : public testing::WithParamInterface<AttentionCase>,
+                                      virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<AttentionCase>& obj) {
+        std::ostringstream result;
+        result << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        abs_threshold = 1e-4;
+        configuration.insert(ov::intel_cpu::attention_fusion(true));
+
+        const auto precision = ov::element::f32;
+        const auto transpose = [](const ov::Output<ov::Node>& input) {
+            auto order = ov::op::v0::Constant::create(ov::element::i64, {4}, {0, 2, 1, 3});
+            return std::make_shared<ov::op::v1::Transpose>(input, order);
+        };
+
+        ov::ParameterVector params;
+        ov::Output<ov::Node> q, k, v;
+        std::shared_ptr<ov::Node> scores;
+        switch (GetParam()) {
+            case AttentionCase::ScaleMask: {
+                // [B, H, L, D] inputs and the additive mask broadcasted over the heads
+                init_input_shapes({{{}, {{2, 4, 40, 16}}}, {{}, {{2, 4, 70, 16}}}, {{}, {{2, 4, 70, 24}}}, {{}, {{2, 1, 40, 70}}}});
+                params = ngraph::builder::makeDynamicParams(precision, inputDynamicShapes);
+                auto matmul = std::make_shared<ov::op::v0::MatMul>(params[0], params[1], false, true);
+                auto scale = ov::op::v0::Constant::create(precision, {}, {0.25f});
+                auto scaled = std::make_shared<ov::op::v1::Multiply>(matmul, scale);
+                scores = std::make_shared<ov::op::v1::Add>(scaled, params[3]);
+                v = params[2];
+                break;
+            }
+            case AttentionCase::TransposedInputsOutput: {
+                // [B, L, H, D] inputs as produced by the exporters, the scale is applied to the queries
+                init_input_shapes({{{}, {{1, 33, 2, 32}}}, {{}, {{1, 33, 2, 32}}}, {{}, {{1, 33, 2, 32}}}});
+                params = ngraph::builder::makeDynamicParams(precision, inputDynamicShapes);
+                auto scale = ov::op::v0::Constant::create(precision, {1, 1, 1, 1}, {0.125f});
+                auto scaledQ = std::make_shared<ov::op::v1::Multiply>(transpose(params[0]), scale);
+                scores = std::make_shared<ov::op::v0::MatMul>(scaledQ, transpose(params[1]), false, true);
+                v = transpose(params[2]);
+                break;
+            }
+            case AttentionCase::DynamicSequence: {
+                init_input_shapes({{{1, 2, -1, 8}, {{1, 2, 1, 8}, {1, 2, 17, 8}, {1, 2, 100, 8}}},
+                                   {{1, 2, -1, 8}, {{1, 2, 1, 8}, {1, 2, 17, 8}, {1, 2, 100, 8}}},
+                                   {{1, 2, -1, 8}, {{1, 2, 1, 8}, {1, 2, 17, 8}, {1, 2, 100, 8}}}});
+                params = ngraph::builder::makeDynamicParams(precision, inputDynamicShapes);
+                scores = std::make_shared<ov::op::v0::MatMul>(params[0], params[1], false, true);
+                v = params[2];
+                break;
+            }
+        }
+
+        auto softmax = std::make_shared<ov::op::v1::Softmax>(scores, 3);
+        std::shared_ptr<ov::Node> output = std::make_shared<ov::op::v0::MatMul>(softmax, v);
+        if (GetParam() == AttentionCase::TransposedInputsOutput)
+            output = transpose(output);
+
+        function = std::make_shared<ov::Model>(ov::NodeVector{output}, params, "ScaledDotProductAttention");
+    }
+};
+
+TEST_P(ScaledDotProductAttentionTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "ScaledDotProductAttention", 1);
+    CheckNumberOfNodesWithType(compiledModel, "Softmax", 0);
+    CheckNumberOfNodesWithType(compiledModel, "MatMul", 0);
+}
+
+TEST(ScaledDotProductAttentionFusion, DisabledByDefault) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    std::shared_ptr<ov::Core> ie = ov::test::utils::PluginCache::get().core();
+
+    auto params = ngraph::builder::makeParams(ov::element::f32, {{1, 2, 16, 8}, {1, 2, 16, 8}, {1, 2, 16, 8}});
+    auto scores = std::make_shared<ov::op::v0::MatMul>(params[0], params[1], false, true);
+    auto softmax = std::make_shared<ov::op::v1::Softmax>(scores, 3);
+    auto output = std::make_shared<ov::op::v0::MatMul>(softmax, params[2]);
+    auto model = std::make_shared<ov::Model>(ov::NodeVector{output}, params);
+
+    auto compiledModel = ie->compile_model(model, "CPU");
+    ASSERT_FALSE(compiledModel.get_property(ov::intel_cpu::attention_fusion));
+    CheckNumberOfNodesWithType(compiledModel, "ScaledDotProductAttention", 0);
+    CheckNumberOfNodesWithType(compiledModel, "Softmax", 1);
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_ScaledDotProductAttention, ScaledDotProductAttentionTest,
+                         ::testing::Values(AttentionCase::ScaleMask,
+                                           AttentionCase::TransposedInputsOutput,
+                                           AttentionCase::DynamicSequence),
+                         ScaledDotProductAttentionTest::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,98 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+
+using namespace ngraph;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+namespace {
+std::shared_ptr<ov::Model> makeDynamicConvModel() {
+    auto param = std::make_shared<opset8::Parameter>(element::f32, ov::PartialShape{1, 8, -1, -1});
+    param->set_friendly_name("data");
+    auto weights = builder::makeConstant<float>(element::f32, {8, 8, 3, 3}, {}, true);
+    auto conv = std::make_shared<opset8::Convolution>(param, weights, Strides{1, 1}, CoordinateDiff{1, 1},
+                                                      CoordinateDiff{1, 1}, Strides{1, 1});
+    auto relu = std::make_shared<opset8::Relu>(conv);
+    // the shape is folded to a constant in the static graphs, so the graph that ran is seen in the profiling info
+    auto shape = std::make_shared<opset8::ShapeOf>(param);
+    return std::make_shared<ov::Model>(OutputVector{relu, shape}, ParameterVector{param});
+}
+
+ov::Tensor infer(ov::InferRequest& req, const ov::Shape& shape) {
+    ov::Tensor input(ov::element::f32, shape);
+    auto data = input.data<float>();
+    for (size_t i = 0; i < input.get_size(); i++)
+        data[i] = static_cast<float>(i % 17) / 17.f - 0.5f;
+    req.set_input_tensor(input);
+    req.infer();
+    const auto output = req.get_output_tensor(0);
+    ov::Tensor result(output.get_element_type(), output.get_shape());
+    output.copy_to(result);
+    return result;
+}
+
+void compare(const ov::Tensor& expected, const ov::Tensor& actual) {
+    ASSERT_EQ(expected.get_shape(), actual.get_shape());
+    for (size_t i = 0; i < expected.get_size(); i++)
+        ASSERT_NEAR(expected.data<float>()[i], actual.data<float>()[i], 1e-4f);
+}
+
+bool ranStaticGraph(const ov::InferRequest& req) {
+    const auto profilingInfo = req.get_profiling_info();
+    return std::none_of(profilingInfo.begin(), profilingInfo.end(), [](const ov::ProfilingInfo& info) {
+        return info.node_type == "ShapeOf";
+    });
+}
+}  // namespace
+
+TEST(StaticShapeVariants, DeclaredAndDetectedShapesMatchDynamicGraph) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    std::shared_ptr<ov::Core> ie = ov::test::utils::PluginCache::get().core();
+
+    auto dynamicModel = ie->compile_model(makeDynamicConvModel(), "CPU");
+    auto variantsModel = ie->compile_model(makeDynamicConvModel(), "CPU",
+                                           ov::intel_cpu::static_shape_variants("data[1,8,16,16][1,8,7,9]"),
+                                           ov::intel_cpu::static_shape_variants_threshold(2),
+                                           ov::enable_profiling(true));
+    ASSERT_EQ(variantsModel.get_property(ov::intel_cpu::static_shape_variants), "data[1,8,16,16][1,8,7,9]");
+    ASSERT_EQ(variantsModel.get_property(ov::intel_cpu::static_shape_variants_threshold), 2);
+
+    auto dynamicReq = dynamicModel.create_infer_request();
+    auto variantsReq = variantsModel.create_infer_request();
+    // the declared shapes, the detected hot shape and the shapes seen once, the hot shape is inferred until its
+    // static graph is created in the background
+    const std::vector<ov::Shape> shapes{{1, 8, 16, 16}, {1, 8, 7, 9}, {1, 8, 11, 5}, {1, 8, 3, 3}};
+    for (size_t iteration = 0; iteration < 10; iteration++) {
+        for (const auto& shape : shapes) {
+            if (shape == shapes.back() && iteration > 0)
+                continue;
+            compare(infer(dynamicReq, shape), infer(variantsReq, shape));
+            // the declared shapes always run on their static graphs, the shape seen once on the dynamic graph
+            if (shape == shapes[0] || shape == shapes[1])
+                ASSERT_TRUE(ranStaticGraph(variantsReq)) << "Static variant is not selected for " << shape;
+            if (shape == shapes.back())
+                ASSERT_FALSE(ranStaticGraph(variantsReq)) << "Static variant is selected for " << shape;
+        }
+    }
+}
+
+TEST(StaticShapeVariants, WrongDeclaredShapesAreRejected) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    std::shared_ptr<ov::Core> ie = ov::test::utils::PluginCache::get().core();
+
+    ASSERT_THROW(ie->compile_model(makeDynamicConvModel(), "CPU", ov::intel_cpu::static_shape_variants("unknown[1,8,4,4]")),
+                 ov::Exception);
+    ASSERT_THROW(ie->compile_model(makeDynamicConvModel(), "CPU", ov::intel_cpu::static_shape_variants("data[1,4,4,4]")),
+                 ov::Exception);
+    ASSERT_THROW(ie->compile_model(makeDynamicConvModel(), "CPU", ov::intel_cpu::static_shape_variants("data[1,8,4")),
+                 ov::Exception);
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,50 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+
+using namespace ngraph;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+namespace {
+std::shared_ptr<ov::Model> makeConvModel() {
+    auto param = std::make_shared<opset8::Parameter>(element::f32, ov::Shape{1, 8, 16, 16});
+    auto weights = builder::makeConstant<float>(element::f32, {8, 8, 3, 3}, {}, true);
+    auto conv = std::make_shared<opset8::Convolution>(param, weights, Strides{1, 1}, CoordinateDiff{1, 1},
+                                                      CoordinateDiff{1, 1}, Strides{1, 1});
+    return std::make_shared<ov::Model>(conv->outputs(), ParameterVector{param});
+}
+}  // namespace
+
+TEST(StreamsAutoTuning, ThroughputHintIsCalibrated) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    std::shared_ptr<ov::Core> ie = ov::test::utils::PluginCache::get().core();
+
+    auto compiledModel = ie->compile_model(makeConvModel(), "CPU",
+                                           ov::hint::performance_mode(ov::hint::PerformanceMode::THROUGHPUT),
+                                           ov::intel_cpu::streams_auto_tuning(true));
+    ASSERT_TRUE(compiledModel.get_property(ov::intel_cpu::streams_auto_tuning));
+    ASSERT_GE(compiledModel.get_property(ov::num_streams), 1);
+
+    auto req = compiledModel.create_infer_request();
+    ASSERT_NO_THROW(req.infer());
+}
+
+TEST(StreamsAutoTuning, ExplicitStreamsAreNotOverridden) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    std::shared_ptr<ov::Core> ie = ov::test::utils::PluginCache::get().core();
+
+    auto compiledModel = ie->compile_model(makeConvModel(), "CPU",
+                                           ov::hint::performance_mode(ov::hint::PerformanceMode::THROUGHPUT),
+                                           ov::num_streams(3),
+                                           ov::intel_cpu::streams_auto_tuning(true));
+    ASSERT_EQ(compiledModel.get_property(ov::num_streams), 3);
+}
+
+} // namespace SubgraphTestsDefinitions
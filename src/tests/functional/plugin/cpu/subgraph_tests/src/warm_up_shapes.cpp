@@ -0,0 +1,162 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+
+using namespace ngraph;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+struct WarmUpShapesParamType {
+    std::string warmUpShapes;
+    ov::AnyMap config;
+};
+
+class WarmUpShapes : public ::testing::TestWithParam<WarmUpShapesParamType> {
+public:
+    static std::string getTestCaseName(::testing::TestParamInfo<WarmUpShapesParamType> obj) {
+        std::ostringstream result;
+        result << "shapes=" << obj.param.warmUpShapes;
+        for (const auto& item : obj.param.config)
+            result << "_" << item.first << "=" << item.second.as<std::string>();
+        return result.str();
+    }
+
+protected:
+    std::shared_ptr<ov::Model> create_test_function() {
+        auto param = std::make_shared<opset8::Parameter>(element::f32, ov::PartialShape{-1, 3, -1, -1});
+        param->set_friendly_name("input_0");
+        param->get_output_tensor(0).set_names({"tensor_input_0"});
+
+        auto conv = builder::makeConvolution(param, element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                             op::PadType::EXPLICIT, 8);
+        auto relu = std::make_shared<opset8::Relu>(conv);
+
+        auto result = std::make_shared<opset8::Result>(relu);
+        result->get_output_tensor(0).set_names({"tensor_output_0"});
+
+        return std::make_shared<ov::Model>(ResultVector{result}, ParameterVector{param});
+    }
+
+    void Run() {
+        std::shared_ptr<ov::Core> ie = ov::test::utils::PluginCache::get().core();
+        auto model = create_test_function();
+
+        auto config = GetParam().config;
+        config[ov::intel_cpu::warm_up_shapes.name()] = GetParam().warmUpShapes;
+        auto compiled_model = ie->compile_model(model, "CPU", config);
+        ASSERT_EQ(GetParam().warmUpShapes, compiled_model.get_property(ov::intel_cpu::warm_up_shapes));
+
+        // Warm-up must not affect results of the following inferences.
+        auto req = compiled_model.create_infer_request();
+        for (const auto& shape : {ov::Shape{1, 3, 16, 16}, ov::Shape{2, 3, 8, 12}}) {
+            auto input = ov::Tensor(element::f32, shape);
+            auto* data = input.data<float>();
+            for (size_t i = 0; i < input.get_size(); i++)
+                data[i] = static_cast<float>(i % 7) - 3.f;
+            req.set_tensor("tensor_input_0", input);
+            req.infer();
+
+            auto refReq = ie->compile_model(model, "CPU").create_infer_request();
+            refReq.set_tensor("tensor_input_0", input);
+            refReq.infer();
+
+            const auto actual = req.get_tensor("tensor_output_0");
+            const auto expected = refReq.get_tensor("tensor_output_0");
+            ASSERT_EQ(expected.get_shape(), actual.get_shape());
+            for (size_t i = 0; i < actual.get_size(); i++)
+                ASSERT_EQ(expected.data<float>()[i], actual.data<float>()[i]);
+        }
+
+        // Setting the property on the compiled model warms it up again.
+        compiled_model.set_property({ov::intel_cpu::warm_up_shapes("[4,3,32,32]")});
+        ASSERT_EQ("[4,3,32,32]", compiled_model.get_property(ov::intel_cpu::warm_up_shapes));
+    }
+};
+
+TEST_P(WarmUpShapes, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    Run();
+}
+
+TEST(WarmUpShapesNegative, WrongShapes) {
+    std::shared_ptr<ov::Core> ie = ov::test::utils::PluginCache::get().core();
+    auto param = std::make_shared<opset8::Parameter>(element::f32, ov::PartialShape{-1, 3});
+    param->set_friendly_name("input_0");
+    auto model = std::make_shared<ov::Model>(std::make_shared<opset8::Relu>(param), ParameterVector{param});
+
+    // not compatible with the model input
+    ASSERT_ANY_THROW(ie->compile_model(model, "CPU", ov::intel_cpu::warm_up_shapes("[1,4]")));
+    // unknown input name
+    ASSERT_ANY_THROW(ie->compile_model(model, "CPU", ov::intel_cpu::warm_up_shapes("unknown[1,3]")));
+    // malformed values
+    ASSERT_ANY_THROW(ie->compile_model(model, "CPU", ov::intel_cpu::warm_up_shapes("input_0[1,3")));
+    ASSERT_ANY_THROW(ie->compile_model(model, "CPU", ov::intel_cpu::warm_up_shapes("input_0[1,x]")));
+}
+
+// The warm-up inference updates the state, the infer requests must start from the initial state anyway.
+TEST(WarmUpShapesStateful, InitialStateIsKept) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    std::shared_ptr<ov::Core> ie = ov::test::utils::PluginCache::get().core();
+
+    const ov::Shape shape{1, 4};
+    auto param = std::make_shared<opset8::Parameter>(element::f32, shape);
+    param->get_output_tensor(0).set_names({"tensor_input_0"});
+    auto init = opset8::Constant::create(element::f32, shape, {0.f});
+    auto variable = std::make_shared<ov::op::util::Variable>(
+        ov::op::util::VariableInfo{shape, element::f32, "accumulator"});
+    auto readValue = std::make_shared<opset8::ReadValue>(init, variable);
+    auto add = std::make_shared<opset8::Add>(readValue, param);
+    auto increment = std::make_shared<opset8::Add>(add, opset8::Constant::create(element::f32, {1, 1}, {1.f}));
+    auto assign = std::make_shared<opset8::Assign>(increment, variable);
+    auto model = std::make_shared<ov::Model>(ResultVector{std::make_shared<opset8::Result>(increment)},
+                                             SinkVector{assign}, ParameterVector{param});
+
+    for (const auto& streams : {1, 2}) {
+        auto warmedUp = ie->compile_model(model, "CPU", ov::num_streams(streams),
+                                          ov::intel_cpu::warm_up_shapes("[1,4][1,4]"));
+        auto reference = ie->compile_model(model, "CPU", ov::num_streams(streams));
+        auto req = warmedUp.create_infer_request();
+        auto refReq = reference.create_infer_request();
+
+        auto states = req.query_state();
+        ASSERT_EQ(1, states.size());
+        const auto initial = states[0].get_state();
+        for (size_t i = 0; i < initial.get_size(); i++)
+            ASSERT_EQ(0.f, initial.data<float>()[i]);
+
+        ov::Tensor input(element::f32, shape);
+        for (size_t i = 0; i < input.get_size(); i++)
+            input.data<float>()[i] = static_cast<float>(i);
+        for (size_t step = 0; step < 3; step++) {
+            req.set_tensor("tensor_input_0", input);
+            req.infer();
+            refReq.set_tensor("tensor_input_0", input);
+            refReq.infer();
+
+            const auto actual = req.get_output_tensor();
+            const auto expected = refReq.get_output_tensor();
+            for (size_t i = 0; i < actual.get_size(); i++)
+                ASSERT_EQ(expected.data<float>()[i], actual.data<float>()[i]) << "at step " << step;
+        }
+    }
+}
+
+static WarmUpShapes::ParamType WarmUpShapesParams[] = {
+    { "[1,3,16,16]", {} },
+    { "input_0[1,3,16,16][2,3,8,12]", {} },
+    { "input_0[1,3,16,16][2,3,8,12]", {ov::num_streams(2)} },
+    { "[2,3,8,12]", {ov::num_streams(0)} },
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_WarmUpShapes,
+                         WarmUpShapes,
+                         ::testing::ValuesIn(WarmUpShapesParams),
+                         WarmUpShapes::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,69 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+
+#include "cpu_allocator.h"
+#include "cpu_memory.h"
+
+using namespace ov::intel_cpu;
+
+TEST(HugePagesAllocatorTest, SmallBuffersAreNotBackedByHugePages) {
+    HugePagesAllocator allocator;
+    void* ptr = allocator.allocate(1024, 64);
+    ASSERT_NE(ptr, nullptr);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(ptr) % 64, 0);
+
+    auto statistics = allocator.getStatistics();
+    ASSERT_EQ(statistics.allocatedBytes, 1024);
+    ASSERT_EQ(statistics.hugePagesBytes, 0);
+
+    allocator.deallocate(ptr, 1024);
+    ASSERT_EQ(allocator.getStatistics().allocatedBytes, 0);
+}
+
+TEST(HugePagesAllocatorTest, BigBuffersAreAlignedToHugePage) {
+    HugePagesAllocator allocator;
+    const size_t size = 3 * HugePagesAllocator::transparentHugePageSize + 1;
+    void* ptr = allocator.allocate(size, 64);
+    ASSERT_NE(ptr, nullptr);
+    std::memset(ptr, 1, size);
+#if defined(__linux__)
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(ptr) % HugePagesAllocator::transparentHugePageSize, 0);
+#endif
+
+    const auto statistics = allocator.getStatistics();
+    ASSERT_EQ(statistics.allocatedBytes, size);
+    ASSERT_LE(statistics.hugePagesBytes, size);
+
+    allocator.deallocate(ptr, size);
+    ASSERT_EQ(allocator.getStatistics().allocatedBytes, 0);
+    ASSERT_EQ(allocator.getStatistics().hugePagesBytes, 0);
+}
+
+TEST(HugePagesAllocatorTest, ExhaustedHugeTLBPoolFallsBack) {
+    // the 1GB pages pool is empty on most of the machines, the buffer must be allocated anyway
+    HugePagesAllocator allocator(1024ul * 1024 * 1024);
+    const size_t size = 1024ul * 1024 * 1024;
+    void* ptr = allocator.allocate(size, 64);
+    ASSERT_NE(ptr, nullptr);
+    ASSERT_EQ(allocator.getStatistics().allocatedBytes, size);
+    allocator.deallocate(ptr, size);
+}
+
+TEST(HugePagesAllocatorTest, MemoryMngrUsesAllocator) {
+    auto allocator = std::make_shared<HugePagesAllocator>();
+    {
+        MemoryMngrWithReuse mngr(allocator);
+        ASSERT_TRUE(mngr.resize(HugePagesAllocator::transparentHugePageSize));
+        ASSERT_EQ(allocator->getStatistics().allocatedBytes, HugePagesAllocator::transparentHugePageSize);
+        ASSERT_FALSE(mngr.resize(1024));
+        ASSERT_TRUE(mngr.resize(2 * HugePagesAllocator::transparentHugePageSize));
+        ASSERT_EQ(allocator->getStatistics().allocatedBytes, 2 * HugePagesAllocator::transparentHugePageSize);
+    }
+    ASSERT_EQ(allocator->getStatistics().allocatedBytes, 0);
+}
@@ -0,0 +1,27 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "streams_tuner.h"
+
+using namespace ov::intel_cpu;
+
+TEST(StreamsTunerTest, CandidatesIncludeHeuristicAndCoresFractions) {
+    ASSERT_EQ(StreamsTuner::getCandidates(6, 16, 0), (std::vector<int>{1, 2, 4, 6, 8, 16}));
+}
+
+TEST(StreamsTunerTest, CandidatesAreUnique) {
+    ASSERT_EQ(StreamsTuner::getCandidates(4, 8, 0), (std::vector<int>{1, 2, 4, 8}));
+    ASSERT_EQ(StreamsTuner::getCandidates(1, 1, 0), (std::vector<int>{1}));
+}
+
+TEST(StreamsTunerTest, CandidatesAreLimitedByNumberOfRequests) {
+    ASSERT_EQ(StreamsTuner::getCandidates(8, 32, 3), (std::vector<int>{1, 2, 3}));
+}
+
+TEST(StreamsTunerTest, HostSignatureIsStable) {
+    ASSERT_FALSE(StreamsTuner::getHostSignature().empty());
+    ASSERT_EQ(StreamsTuner::getHostSignature(), StreamsTuner::getHostSignature());
+}
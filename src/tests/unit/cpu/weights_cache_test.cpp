@@ -0,0 +1,96 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include <ie_system_conf.h>
+
+#include "cpu_memory.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "weights_cache.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+MemoryPtr createMemory() {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    MemoryPtr memory(new Memory(eng));
+    memory->Create(CpuBlockedMemoryDesc(InferenceEngine::Precision::FP32, Shape(VectorDims{2, 3})));
+    return memory;
+}
+} // namespace
+
+TEST(WeightsSharingTests, ProcessWeightsAreSharedByNetworks) {
+    const auto numaNode = InferenceEngine::getAvailableNUMANodes().front();
+    NumaNodesWeights network1;
+    NumaNodesWeights network2;
+    ASSERT_NE(network1[numaNode], network2[numaNode]);
+
+    const auto& processWeights = network1[numaNode]->getProcessWeights();
+    ASSERT_NE(processWeights, nullptr);
+    ASSERT_EQ(processWeights, network2[numaNode]->getProcessWeights());
+
+    MemoryPtr memory1 = *processWeights->findOrCreate("ProcessWeightsAreSharedByNetworks", createMemory);
+    size_t created = 0;
+    MemoryPtr memory2 = *network2[numaNode]->getProcessWeights()->findOrCreate("ProcessWeightsAreSharedByNetworks",
+                                                                               [&created] {
+                                                                                   ++created;
+                                                                                   return createMemory();
+                                                                               });
+    ASSERT_EQ(created, 0);
+    ASSERT_EQ(memory1, memory2);
+}
+
+TEST(WeightsSharingTests, ReleasedMemoryIsCreatedAgain) {
+    WeightsSharing cache;
+    {
+        MemoryPtr memory = *cache.findOrCreate("key", createMemory);
+    }
+    size_t created = 0;
+    MemoryPtr memory = *cache.findOrCreate("key", [&created] {
+        ++created;
+        return createMemory();
+    });
+    ASSERT_EQ(created, 1);
+    ASSERT_NE(memory, nullptr);
+}
+
+TEST(WeightsSharingTests, DataHashIsCalculatedOnce) {
+    WeightsSharing cache;
+    std::vector<uint8_t> data(3 * 1024 * 1024 + 5, 1);
+    const auto hash = cache.getDataHash("data", data.data(), data.size());
+
+    WeightsSharing otherCache;
+    ASSERT_EQ(hash, otherCache.getDataHash("other", data.data(), data.size()));
+
+    data.back() = 2;
+    ASSERT_EQ(hash, cache.getDataHash("data", data.data(), data.size()));
+    ASSERT_NE(hash, otherCache.getDataHash("changed", data.data(), data.size()));
+}
+
+TEST(WeightsSharingTests, CollidingSourcesAreNotShared) {
+    WeightsSharing cache;
+    auto source = createMemory();
+    std::fill_n(static_cast<float*>(source->GetData()), 6, 1.f);
+    auto equal = createMemory();
+    std::fill_n(static_cast<float*>(equal->GetData()), 6, 1.f);
+    auto different = createMemory();
+    std::fill_n(static_cast<float*>(different->GetData()), 6, 2.f);
+
+    const auto key = cache.getSourceKey("const", source);
+    ASSERT_FALSE(key.empty());
+    ASSERT_EQ(key, cache.getSourceKey("const", source));
+    ASSERT_EQ(key, cache.getSourceKey("const", equal));
+    // the same key is given to different data, e.g. on the hash collision
+    ASSERT_TRUE(cache.getSourceKey("const", different).empty());
+
+    // the data shared with the key of the released source can not be verified, so the new source gets another key
+    source.reset();
+    equal.reset();
+    const auto newKey = cache.getSourceKey("const", different);
+    ASSERT_FALSE(newKey.empty());
+    ASSERT_NE(key, newKey);
+}
@@ -3,6 +3,7 @@
 //
 
 #include <string>
+#include <cstring>
 #include <gtest/gtest.h>
 #include <fstream>
 #include <thread>
@@ -13,6 +14,7 @@
 #include "ngraph/ops.hpp"
 #include "ngraph/variant.hpp"
 #include "ngraph/opsets/opset6.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
 #include "transformations/rt_info/fused_names_attribute.hpp"
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
 #include "cpp/ie_cnn_network.h"
@@ -403,6 +405,107 @@ TEST(NetworkContext_CNNNetwork, HashWithDifferentMeanValues) {
               NetworkCompilationContext::computeHash(net3, {}));
 }
 
+static CNNNetwork createNetworkWithConstant(const std::vector<float>& values) {
+    auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{values.size()});
+    auto constant = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{values.size()}, values);
+    auto add = std::make_shared<ngraph::opset6::Add>(data, constant);
+    auto res = std::make_shared<ngraph::opset6::Result>(add);
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{res}, ngraph::ParameterVector{data}));
+}
+
+TEST(NetworkContext_CNNNetwork, HashWithDifferentConstantData) {
+    // Word sums of the data are equal, so the hash has to depend on the order of the values
+    auto net1 = createNetworkWithConstant({1.f, 2.f, 3.f, 4.f});
+    auto net2 = createNetworkWithConstant({4.f, 3.f, 2.f, 1.f});
+    auto net3 = createNetworkWithConstant({1.f, 2.f, 3.f, 4.f});
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+    ASSERT_EQ(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net3, {}));
+}
+
+TEST(NetworkContext_CNNNetwork, HashWithLargeConstantData) {
+    // Large constants are hashed by chunks in parallel
+    std::vector<float> values(4 * 1024 * 1024);
+    for (size_t i = 0; i < values.size(); i++) {
+        values[i] = static_cast<float>(i % 1000);
+    }
+    auto net1 = createNetworkWithConstant(values);
+    auto net2 = createNetworkWithConstant(values);
+    values.back() += 1.f;
+    auto net3 = createNetworkWithConstant(values);
+    ASSERT_EQ(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net3, {}));
+}
+
+TEST(NetworkContext_CNNNetwork, HashWithDifferentTopology) {
+    auto fun1 = create_simple_function();
+    auto fun2 = create_simple_function();
+    // Swap the inputs of Add, the set of the ops and their attributes stay the same
+    auto add = fun2->get_results()[0]->input_value(0).get_node_shared_ptr();
+    auto in0 = add->input_value(0);
+    auto in1 = add->input_value(1);
+    add->input(0).replace_source_output(in1);
+    add->input(1).replace_source_output(in0);
+    ASSERT_NE(NetworkCompilationContext::computeHash(CNNNetwork(fun1), {}),
+              NetworkCompilationContext::computeHash(CNNNetwork(fun2), {}));
+}
+
+namespace {
+// Not a Constant, so its buffer is not hashed in advance
+class BufferAttributeOp : public ov::op::Op {
+public:
+    OPENVINO_OP("BufferAttributeOp");
+
+    BufferAttributeOp(const Output<Node>& arg, const std::shared_ptr<runtime::AlignedBuffer>& buffer)
+        : Op({arg}), m_buffer(buffer) {
+        constructor_validate_and_infer_types();
+    }
+
+    void validate_and_infer_types() override {
+        set_output_type(0, get_input_element_type(0), get_input_partial_shape(0));
+    }
+
+    bool visit_attributes(AttributeVisitor& visitor) override {
+        visitor.on_attribute("data", m_buffer);
+        return true;
+    }
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override {
+        return std::make_shared<BufferAttributeOp>(new_args.at(0), m_buffer);
+    }
+
+private:
+    std::shared_ptr<runtime::AlignedBuffer> m_buffer;
+};
+}  // namespace
+
+static CNNNetwork createNetworkWithBufferAttribute(const std::vector<float>& values) {
+    std::shared_ptr<runtime::AlignedBuffer> buffer;
+    if (!values.empty()) {
+        buffer = std::make_shared<runtime::AlignedBuffer>(values.size() * sizeof(float));
+        std::memcpy(buffer->get_ptr(), values.data(), buffer->size());
+    }
+    auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{4});
+    auto op = std::make_shared<BufferAttributeOp>(data, buffer);
+    auto res = std::make_shared<ngraph::opset6::Result>(op);
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{res}, ngraph::ParameterVector{data}));
+}
+
+TEST(NetworkContext_CNNNetwork, HashWithBufferAttribute) {
+    auto net1 = createNetworkWithBufferAttribute({1.f, 2.f, 3.f, 4.f});
+    auto net2 = createNetworkWithBufferAttribute({1.f, 2.f, 3.f, 4.f});
+    auto net3 = createNetworkWithBufferAttribute({4.f, 3.f, 2.f, 1.f});
+    auto net4 = createNetworkWithBufferAttribute({});
+    ASSERT_EQ(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net3, {}));
+    ASSERT_NO_THROW(NetworkCompilationContext::computeHash(net4, {}));
+}
+
 // Verify all internal hash calculations are thread-safe (like ngraph::function serialization)
 TEST(NetworkContext_CNNNetwork, HashOfSameMultiThreading) {
     auto net1 = createNetwork();
@@ -0,0 +1,102 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <gflags/gflags.h>
+#include <iostream>
+#include <string>
+
+/// @brief message for help argument
+static const char help_message[] = "Print a usage message.";
+
+/// @brief message for filter argument
+static const char filter_message[] =
+    "Not required. Regular expression selecting the benchmark cases by name, e.g. \"Convolution/.*\". "
+    "All cases are executed by default.";
+
+/// @brief message for precisions argument
+static const char precisions_message[] =
+    "Not required. Comma separated list of precisions to benchmark: f32, bf16, i8. Default value is \"f32\".";
+
+/// @brief message for ISA argument
+static const char isa_message[] =
+    "Not required. Maximal instruction set used by the CPU plugin kernels: sse41, avx2, avx512_core, "
+    "avx512_core_vnni, avx512_core_bf16, avx512_core_amx. Sets ONEDNN_MAX_CPU_ISA before the plugin is loaded, "
+    "so a separate run is needed for every ISA.";
+
+/// @brief message for iterations argument
+static const char niter_message[] = "Not required. Minimal number of measured inferences per case. Default value is 20.";
+
+/// @brief message for time argument
+static const char min_time_message[] =
+    "Not required. Minimal measurement time per case in milliseconds. Default value is 200.";
+
+/// @brief message for threads argument
+static const char nthreads_message[] =
+    "Not required. Number of threads used by the CPU plugin. All the cores are used by default.";
+
+/// @brief message for baseline argument
+static const char baseline_message[] =
+    "Not required. Path to a baseline CSV file (written by -save_baseline) to compare the results with.";
+
+/// @brief message for save baseline argument
+static const char save_baseline_message[] = "Not required. Path to a CSV file to store the results as a baseline.";
+
+/// @brief message for threshold argument
+static const char threshold_message[] =
+    "Not required. Slowdown in percents relative to the baseline reported as a regression. Default value is 10.";
+
+/// @brief Define flag for showing help message <br>
+DEFINE_bool(h, false, help_message);
+
+/// @brief Declare flag for showing help message <br>
+DECLARE_bool(help);
+
+/// @brief Define parameter for selecting cases <br>
+DEFINE_string(filter, "", filter_message);
+
+/// @brief Define parameter for precisions <br>
+DEFINE_string(precisions, "f32", precisions_message);
+
+/// @brief Define parameter for maximal ISA <br>
+DEFINE_string(isa, "", isa_message);
+
+/// @brief Define parameter for number of measured inferences <br>
+DEFINE_uint32(niter, 20, niter_message);
+
+/// @brief Define parameter for measurement time <br>
+DEFINE_uint32(min_time, 200, min_time_message);
+
+/// @brief Define parameter for number of threads <br>
+DEFINE_uint32(nthreads, 0, nthreads_message);
+
+/// @brief Define parameter for baseline path <br>
+DEFINE_string(baseline, "", baseline_message);
+
+/// @brief Define parameter for path to store baseline <br>
+DEFINE_string(save_baseline, "", save_baseline_message);
+
+/// @brief Define parameter for regression threshold <br>
+DEFINE_double(threshold, 10, threshold_message);
+
+/**
+ * @brief This function show a help message
+ */
+static void showUsage() {
+    std::cout << std::endl;
+    std::cout << "cpu_node_benchmarks [OPTION]" << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << std::endl;
+    std::cout << "    -h, --help              " << help_message << std::endl;
+    std::cout << "    -filter \"<regex>\"       " << filter_message << std::endl;
+    std::cout << "    -precisions \"<list>\"    " << precisions_message << std::endl;
+    std::cout << "    -isa \"<isa>\"            " << isa_message << std::endl;
+    std::cout << "    -niter \"<integer>\"      " << niter_message << std::endl;
+    std::cout << "    -min_time \"<integer>\"   " << min_time_message << std::endl;
+    std::cout << "    -nthreads \"<integer>\"   " << nthreads_message << std::endl;
+    std::cout << "    -baseline \"<path>\"      " << baseline_message << std::endl;
+    std::cout << "    -save_baseline \"<path>\" " << save_baseline_message << std::endl;
+    std::cout << "    -threshold \"<float>\"    " << threshold_message << std::endl;
+}
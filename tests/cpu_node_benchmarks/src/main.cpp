@@ -0,0 +1,141 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <regex>
+#include <sstream>
+
+#include "cli.h"
+#include "node_cases.h"
+#include "runner.h"
+
+namespace {
+
+/**
+ * @brief Parses command line and check the arguments
+ */
+bool parseAndCheckCommandLine(int argc, char** argv) {
+    gflags::ParseCommandLineNonHelpFlags(&argc, &argv, true);
+    if (FLAGS_help || FLAGS_h) {
+        showUsage();
+        return false;
+    }
+
+    if (FLAGS_niter == 0)
+        throw std::logic_error("Number of iterations should be positive. Please set -niter option.");
+
+    if (FLAGS_threshold < 0)
+        throw std::logic_error("Regression threshold can't be negative. Please set -threshold option.");
+
+    return true;
+}
+
+std::vector<ov::element::Type> parsePrecisions(const std::string& list) {
+    std::vector<ov::element::Type> precisions;
+    std::stringstream stream(list);
+    std::string precision;
+    while (std::getline(stream, precision, ',')) {
+        if (precision == "f32") {
+            precisions.push_back(ov::element::f32);
+        } else if (precision == "bf16") {
+            precisions.push_back(ov::element::bf16);
+        } else if (precision == "i8") {
+            precisions.push_back(ov::element::i8);
+        } else {
+            throw std::logic_error("Unsupported precision: " + precision + ". Please set -precisions option.");
+        }
+    }
+    if (precisions.empty())
+        throw std::logic_error("No precisions to benchmark. Please set -precisions option.");
+    return precisions;
+}
+
+/**
+ * @brief Limits the instruction set of oneDNN and the plugin kernels. It has to be done before the
+ * plugin library is loaded, since the ISA is read once on the first use.
+ */
+void setMaxIsa(const std::string& isa) {
+    if (isa.empty())
+        return;
+#ifdef _WIN32
+    _putenv_s("ONEDNN_MAX_CPU_ISA", isa.c_str());
+#else
+    setenv("ONEDNN_MAX_CPU_ISA", isa.c_str(), 1);
+#endif
+}
+
+}  // namespace
+
+/**
+ * @brief Main entry point
+ */
+int main(int argc, char** argv) {
+    try {
+        if (!parseAndCheckCommandLine(argc, argv))
+            return 0;
+
+        setMaxIsa(FLAGS_isa);
+        const auto precisions = parsePrecisions(FLAGS_precisions);
+        const std::regex filter(FLAGS_filter.empty() ? ".*" : FLAGS_filter);
+        const RunConfig config{FLAGS_niter, FLAGS_min_time, FLAGS_nthreads};
+        const auto baseline = FLAGS_baseline.empty() ? std::map<std::string, double>{} : read_baseline(FLAGS_baseline);
+
+        ov::Core core;
+        std::map<std::string, double> results;
+        size_t regressions = 0;
+
+        std::cout << std::left << std::setw(60) << "case" << std::right << std::setw(12) << "median, us"
+                  << std::setw(12) << "min, us" << std::setw(10) << "GFLOPS" << std::setw(10) << "GB/s";
+        if (!baseline.empty())
+            std::cout << std::setw(12) << "baseline" << std::setw(10) << "ratio";
+        std::cout << std::endl << std::fixed << std::setprecision(2);
+
+        for (const auto& node_case : make_node_cases(precisions)) {
+            if (!std::regex_search(node_case.name, filter))
+                continue;
+
+            std::cout << std::left << std::setw(60) << node_case.name << std::right;
+            CaseResult result;
+            try {
+                result = run_case(core, node_case, config);
+            } catch (const std::exception& ex) {
+                // e.g. bf16 is requested on the CPU without bf16 support
+                std::cout << " skipped: " << ex.what() << std::endl;
+                continue;
+            }
+            results[node_case.name] = result.median_us;
+
+            const double seconds = result.median_us * 1e-6;
+            std::cout << std::setw(12) << result.median_us << std::setw(12) << result.min_us << std::setw(10)
+                      << (node_case.flops ? node_case.flops / seconds * 1e-9 : 0.) << std::setw(10)
+                      << node_case.bytes / seconds * 1e-9;
+
+            const auto reference = baseline.find(node_case.name);
+            if (reference != baseline.end()) {
+                const double ratio = result.median_us / reference->second;
+                std::cout << std::setw(12) << reference->second << std::setw(10) << ratio;
+                if (ratio > 1. + FLAGS_threshold / 100.) {
+                    std::cout << "  REGRESSION";
+                    regressions++;
+                }
+            }
+            std::cout << std::endl;
+        }
+
+        if (!FLAGS_save_baseline.empty())
+            write_baseline(FLAGS_save_baseline, results);
+
+        if (regressions) {
+            std::cerr << regressions << " case(s) are slower than the baseline by more than " << FLAGS_threshold
+                      << "%" << std::endl;
+            return 1;
+        }
+    } catch (const std::exception& ex) {
+        std::cerr << ex.what() << std::endl;
+        return -1;
+    }
+    return 0;
+}
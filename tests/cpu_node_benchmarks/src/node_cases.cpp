@@ -0,0 +1,367 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "node_cases.h"
+
+#include <functional>
+#include <numeric>
+#include <openvino/opsets/opset8.hpp>
+#include <random>
+#include <sstream>
+
+namespace {
+
+using namespace ov::opset8;
+
+std::string shape_string(const ov::Shape& shape) {
+    std::ostringstream result;
+    for (size_t i = 0; i < shape.size(); i++)
+        result << (i ? "x" : "") << shape[i];
+    return result.str();
+}
+
+std::string axes_string(const std::vector<int64_t>& axes) {
+    std::ostringstream result;
+    for (size_t i = 0; i < axes.size(); i++)
+        result << (i ? "," : "") << axes[i];
+    return result.str();
+}
+
+double elements(const ov::Shape& shape) {
+    return static_cast<double>(ov::shape_size(shape));
+}
+
+size_t element_size(const ov::element::Type& precision) {
+    return precision == ov::element::i8 ? 1 : precision == ov::element::bf16 ? 2 : 4;
+}
+
+/// Constant filled from the generator of the case, so the values depend only on the case and the results
+/// are comparable with the baseline whatever cases are selected
+std::shared_ptr<Constant> random_constant(std::mt19937& generator,
+                                          const ov::Shape& shape,
+                                          float low = -1.f,
+                                          float high = 1.f) {
+    std::uniform_real_distribution<float> distribution(low, high);
+    std::vector<float> values(ov::shape_size(shape));
+    for (auto& value : values)
+        value = distribution(generator);
+    return std::make_shared<Constant>(ov::element::f32, shape, values);
+}
+
+/// Per-tensor FakeQuantize, which the low precision transformations turn into quantized execution
+ov::Output<ov::Node> quantize(const ov::Output<ov::Node>& input, bool is_signed) {
+    const float low = is_signed ? -1.28f : 0.f;
+    const float high = is_signed ? 1.27f : 2.55f;
+    const auto input_low = Constant::create(ov::element::f32, {}, {low});
+    const auto input_high = Constant::create(ov::element::f32, {}, {high});
+    return std::make_shared<FakeQuantize>(input, input_low, input_high, input_low, input_high, is_signed ? 255 : 256);
+}
+
+std::shared_ptr<ov::Model> make_model(const ov::OutputVector& outputs, const ov::ParameterVector& params) {
+    ov::ResultVector results;
+    for (const auto& output : outputs)
+        results.push_back(std::make_shared<Result>(output));
+    return std::make_shared<ov::Model>(results, params);
+}
+
+class CaseBuilder {
+public:
+    explicit CaseBuilder(const std::vector<ov::element::Type>& precisions) : precisions(precisions) {}
+
+    /// Adds the case for every requested precision, the creator gets whether the i8 model is requested and
+    /// the generator of the constants seeded by the operation and the shapes, so all the precisions get the same values
+    void add(const std::string& operation,
+             const std::string& shapes,
+             bool has_i8,
+             double flops,
+             double elements_moved,
+             const std::function<std::shared_ptr<ov::Model>(bool, std::mt19937&)>& create) {
+        const std::string key = operation + "/" + shapes;
+        for (const auto& precision : precisions) {
+            if (precision == ov::element::i8 && !has_i8)
+                continue;
+            std::seed_seq seed(key.begin(), key.end());
+            std::mt19937 generator(seed);
+            cases.push_back({operation + "/" + precision.get_type_name() + "/" + shapes,
+                             precision,
+                             create(precision == ov::element::i8, generator),
+                             flops,
+                             elements_moved * element_size(precision)});
+        }
+    }
+
+    std::vector<NodeCase> cases;
+
+private:
+    std::vector<ov::element::Type> precisions;
+};
+
+void add_convolutions(CaseBuilder& builder) {
+    struct Config {
+        ov::Shape input;
+        size_t output_channels;
+        size_t kernel;
+        size_t stride;
+        size_t pad;
+    };
+    const std::vector<Config> configs{{{1, 64, 56, 56}, 64, 3, 1, 1},
+                                      {{1, 256, 14, 14}, 1024, 1, 1, 0},
+                                      {{1, 3, 224, 224}, 64, 7, 2, 3}};
+    for (const auto& config : configs) {
+        const ov::Shape weights{config.output_channels, config.input[1], config.kernel, config.kernel};
+        const size_t out_h = (config.input[2] + 2 * config.pad - config.kernel) / config.stride + 1;
+        const size_t out_w = (config.input[3] + 2 * config.pad - config.kernel) / config.stride + 1;
+        const ov::Shape output{config.input[0], config.output_channels, out_h, out_w};
+        const double flops = 2. * elements(output) * config.input[1] * config.kernel * config.kernel;
+
+        std::ostringstream shapes;
+        shapes << shape_string(config.input) << "_k" << config.kernel << "_s" << config.stride << "_oc"
+               << config.output_channels;
+        builder.add("Convolution", shapes.str(), true, flops,
+                    elements(config.input) + elements(weights) + elements(output),
+                    [=](bool i8, std::mt19937& generator) {
+                        const auto param = std::make_shared<Parameter>(ov::element::f32, config.input);
+                        ov::Output<ov::Node> data = param;
+                        ov::Output<ov::Node> filters = random_constant(generator, weights);
+                        if (i8) {
+                            data = quantize(data, false);
+                            filters = quantize(filters, true);
+                        }
+                        const auto pad = static_cast<std::ptrdiff_t>(config.pad);
+                        const auto conv = std::make_shared<Convolution>(data, filters,
+                                                                        ov::Strides{config.stride, config.stride},
+                                                                        ov::CoordinateDiff{pad, pad},
+                                                                        ov::CoordinateDiff{pad, pad},
+                                                                        ov::Strides{1, 1});
+                        return make_model({conv}, {param});
+                    });
+    }
+}
+
+void add_fully_connected(CaseBuilder& builder) {
+    // M, K, N
+    const std::vector<std::vector<size_t>> configs{{1, 1024, 1000}, {64, 768, 3072}, {128, 1024, 1024}};
+    for (const auto& config : configs) {
+        const ov::Shape input{config[0], config[1]};
+        const ov::Shape weights{config[2], config[1]};
+        const ov::Shape output{config[0], config[2]};
+        builder.add("FullyConnected", shape_string(input) + "_n" + std::to_string(config[2]), true,
+                    2. * config[0] * config[1] * config[2],
+                    elements(input) + elements(weights) + elements(output),
+                    [=](bool i8, std::mt19937& generator) {
+                        const auto param = std::make_shared<Parameter>(ov::element::f32, input);
+                        ov::Output<ov::Node> data = param;
+                        ov::Output<ov::Node> matrix = random_constant(generator, weights);
+                        if (i8) {
+                            data = quantize(data, false);
+                            matrix = quantize(matrix, true);
+                        }
+                        return make_model({std::make_shared<MatMul>(data, matrix, false, true)}, {param});
+                    });
+    }
+}
+
+void add_eltwise(CaseBuilder& builder) {
+    // Multiply -> Add -> Relu -> Sigmoid -> Multiply is fused into a single Eltwise node
+    for (const auto& shape : std::vector<ov::Shape>{{1, 64, 112, 112}, {1, 256, 56, 56}}) {
+        builder.add("EltwiseChain", shape_string(shape), false, 5 * elements(shape), 2 * elements(shape),
+                    [=](bool, std::mt19937& generator) {
+                        const auto param = std::make_shared<Parameter>(ov::element::f32, shape);
+                        const ov::Shape per_channel{1, shape[1], 1, 1};
+                        const auto scaled = std::make_shared<Multiply>(param, random_constant(generator, per_channel));
+                        const auto shifted = std::make_shared<Add>(scaled, random_constant(generator, per_channel));
+                        const auto relu = std::make_shared<Relu>(shifted);
+                        const auto sigmoid = std::make_shared<Sigmoid>(relu);
+                        return make_model({std::make_shared<Multiply>(sigmoid, param)}, {param});
+                    });
+    }
+}
+
+void add_interpolate(CaseBuilder& builder) {
+    const ov::Shape input{1, 64, 128, 128};
+    const ov::Shape output{1, 64, 256, 256};
+    const std::vector<std::pair<std::string, Interpolate::InterpolateMode>> modes{
+        {"linear", Interpolate::InterpolateMode::LINEAR},
+        {"nearest", Interpolate::InterpolateMode::NEAREST}};
+    for (const auto& mode : modes) {
+        // linear interpolation reads 4 points and makes 3 interpolations of 3 operations per output element
+        const double flops = mode.second == Interpolate::InterpolateMode::LINEAR ? 9 * elements(output) : 0;
+        builder.add("Interpolate", shape_string(input) + "_x2_" + mode.first, false, flops,
+                    elements(input) + elements(output),
+                    [=](bool, std::mt19937&) {
+                        const auto param = std::make_shared<Parameter>(ov::element::f32, input);
+                        Interpolate::InterpolateAttrs attrs(mode.second,
+                                                            Interpolate::ShapeCalcMode::SCALES,
+                                                            {0, 0, 0, 0},
+                                                            {0, 0, 0, 0});
+                        const auto sizes = Constant::create(ov::element::i64, {2}, {output[2], output[3]});
+                        const auto scales = Constant::create(ov::element::f32, {2}, {2.f, 2.f});
+                        const auto axes = Constant::create(ov::element::i64, {2}, {2, 3});
+                        return make_model({std::make_shared<Interpolate>(param, sizes, scales, axes, attrs)}, {param});
+                    });
+    }
+}
+
+void add_reduce(CaseBuilder& builder) {
+    const ov::Shape spatial{1, 512, 28, 28};
+    builder.add("ReduceMean", shape_string(spatial) + "_axes2,3", false, elements(spatial),
+                elements(spatial) + spatial[1],
+                [=](bool, std::mt19937&) {
+                    const auto param = std::make_shared<Parameter>(ov::element::f32, spatial);
+                    const auto axes = Constant::create(ov::element::i64, {2}, {2, 3});
+                    return make_model({std::make_shared<ReduceMean>(param, axes, true)}, {param});
+                });
+
+    const ov::Shape rows{64, 128, 768};
+    builder.add("ReduceSum", shape_string(rows) + "_axis2", false, elements(rows),
+                elements(rows) + rows[0] * rows[1],
+                [=](bool, std::mt19937&) {
+                    const auto param = std::make_shared<Parameter>(ov::element::f32, rows);
+                    const auto axes = Constant::create(ov::element::i64, {1}, {2});
+                    return make_model({std::make_shared<ReduceSum>(param, axes, false)}, {param});
+                });
+}
+
+void add_mvn(CaseBuilder& builder) {
+    const std::vector<std::pair<ov::Shape, std::vector<int64_t>>> configs{{{1, 32, 56, 56}, {2, 3}},
+                                                                          {{1, 384, 768}, {2}}};
+    for (const auto& config : configs) {
+        const auto& shape = config.first;
+        const auto& axes_values = config.second;
+        // mean, variance and normalization passes
+        builder.add("MVN", shape_string(shape) + "_axes" + axes_string(axes_values), false,
+                    5 * elements(shape), 2 * elements(shape),
+                    [=](bool, std::mt19937&) {
+                        const auto param = std::make_shared<Parameter>(ov::element::f32, shape);
+                        const auto axes = Constant::create(ov::element::i64, {axes_values.size()}, axes_values);
+                        const auto mvn = std::make_shared<MVN>(param, axes, true, 1e-5f, ov::op::MVNEpsMode::INSIDE_SQRT);
+                        return make_model({mvn}, {param});
+                    });
+    }
+}
+
+void add_gather(CaseBuilder& builder) {
+    // embedding lookup: the indices are a constant to keep them in the table range
+    const ov::Shape table{4096, 768};
+    const size_t indices_count = 512;
+    builder.add("Gather", shape_string(table) + "_indices" + std::to_string(indices_count), false, 0,
+                2. * indices_count * table[1],
+                [=](bool, std::mt19937&) {
+                    const auto param = std::make_shared<Parameter>(ov::element::f32, table);
+                    std::vector<int32_t> indices(indices_count);
+                    for (size_t i = 0; i < indices_count; i++)
+                        indices[i] = static_cast<int32_t>((i * 7919) % table[0]);
+                    const auto indices_const = Constant::create(ov::element::i32, {indices_count}, indices);
+                    const auto axis = Constant::create(ov::element::i64, {}, {0});
+                    return make_model({std::make_shared<Gather>(param, indices_const, axis)}, {param});
+                });
+
+    const ov::Shape channels{1, 256, 56, 56};
+    builder.add("Gather", shape_string(channels) + "_axis1_reverse", false, 0, 2 * elements(channels),
+                [=](bool, std::mt19937&) {
+                    const auto param = std::make_shared<Parameter>(ov::element::f32, channels);
+                    std::vector<int32_t> indices(channels[1]);
+                    std::iota(indices.rbegin(), indices.rend(), 0);
+                    const auto indices_const = Constant::create(ov::element::i32, {indices.size()}, indices);
+                    const auto axis = Constant::create(ov::element::i64, {}, {1});
+                    return make_model({std::make_shared<Gather>(param, indices_const, axis)}, {param});
+                });
+}
+
+void add_topk(CaseBuilder& builder) {
+    const std::vector<std::pair<ov::Shape, size_t>> configs{{{1, 1000}, 5}, {{64, 32000}, 50}};
+    for (const auto& config : configs) {
+        const auto& shape = config.first;
+        const size_t k = config.second;
+        builder.add("TopK", shape_string(shape) + "_k" + std::to_string(k), false, 0,
+                    elements(shape) + 2. * shape[0] * k,
+                    [=](bool, std::mt19937&) {
+                        const auto param = std::make_shared<Parameter>(ov::element::f32, shape);
+                        const auto k_const = Constant::create(ov::element::i64, {}, {k});
+                        const auto topk = std::make_shared<TopK>(param, k_const, 1, TopK::Mode::MAX, TopK::SortType::SORT_VALUES);
+                        return make_model(topk->outputs(), {param});
+                    });
+    }
+}
+
+void add_nms(CaseBuilder& builder) {
+    const ov::Shape boxes_shape{1, 4000, 4};
+    const ov::Shape scores_shape{1, 80, 4000};
+    builder.add("NonMaxSuppression", shape_string(boxes_shape) + "_classes80", false, 0,
+                elements(boxes_shape) + elements(scores_shape),
+                [=](bool, std::mt19937&) {
+                    const auto scores = std::make_shared<Parameter>(ov::element::f32, scores_shape);
+                    // the boxes are a constant to keep them valid (y1 < y2, x1 < x2)
+                    std::mt19937 generator(0);
+                    std::uniform_real_distribution<float> position(0.f, 0.9f), size(0.01f, 0.1f);
+                    std::vector<float> boxes(ov::shape_size(boxes_shape));
+                    for (size_t i = 0; i < boxes.size(); i += 4) {
+                        boxes[i] = position(generator);
+                        boxes[i + 1] = position(generator);
+                        boxes[i + 2] = boxes[i] + size(generator);
+                        boxes[i + 3] = boxes[i + 1] + size(generator);
+                    }
+                    const auto boxes_const = Constant::create(ov::element::f32, boxes_shape, boxes);
+                    const auto max_boxes = Constant::create(ov::element::i64, {}, {100});
+                    const auto iou_threshold = Constant::create(ov::element::f32, {}, {0.5f});
+                    const auto score_threshold = Constant::create(ov::element::f32, {}, {0.05f});
+                    const auto nms = std::make_shared<NonMaxSuppression>(boxes_const, scores, max_boxes, iou_threshold,
+                                                                         score_threshold);
+                    return make_model(nms->outputs(), {scores});
+                });
+}
+
+void add_data_movement(CaseBuilder& builder) {
+    const std::vector<std::pair<ov::Shape, std::vector<int64_t>>> transposes{{{1, 64, 112, 112}, {0, 2, 3, 1}},
+                                                                             {{8, 128, 12, 64}, {0, 2, 1, 3}}};
+    for (const auto& config : transposes) {
+        const auto& shape = config.first;
+        const auto& order = config.second;
+        builder.add("Transpose", shape_string(shape) + "_order" + axes_string(order), false, 0, 2 * elements(shape),
+                    [=](bool, std::mt19937&) {
+                        const auto param = std::make_shared<Parameter>(ov::element::f32, shape);
+                        const auto order_const = Constant::create(ov::element::i64, {order.size()}, order);
+                        return make_model({std::make_shared<Transpose>(param, order_const)}, {param});
+                    });
+    }
+
+    const ov::Shape shape{1, 256, 56, 56};
+    builder.add("Convert", shape_string(shape) + "_f32_to_u8", false, 0, 2 * elements(shape),
+                [=](bool, std::mt19937&) {
+                    const auto param = std::make_shared<Parameter>(ov::element::f32, shape);
+                    return make_model({std::make_shared<Convert>(param, ov::element::u8)}, {param});
+                });
+
+    // The depthwise convolution is executed in the blocked layout, so the plain input is reordered to it and
+    // the output is reordered back to plain. The two reorders move twice as many bytes as the convolution.
+    builder.add("Reorder", shape_string(shape) + "_plain_blocked_plain", false, 2. * 9 * elements(shape),
+                6 * elements(shape),
+                [=](bool, std::mt19937& generator) {
+                    const auto param = std::make_shared<Parameter>(ov::element::f32, shape);
+                    const auto weights = random_constant(generator, {shape[1], 1, 1, 3, 3});
+                    const auto conv = std::make_shared<GroupConvolution>(param, weights,
+                                                                         ov::Strides{1, 1},
+                                                                         ov::CoordinateDiff{1, 1},
+                                                                         ov::CoordinateDiff{1, 1},
+                                                                         ov::Strides{1, 1});
+                    return make_model({conv}, {param});
+                });
+}
+
+}  // namespace
+
+std::vector<NodeCase> make_node_cases(const std::vector<ov::element::Type>& precisions) {
+    CaseBuilder builder(precisions);
+    add_convolutions(builder);
+    add_fully_connected(builder);
+    add_eltwise(builder);
+    add_interpolate(builder);
+    add_reduce(builder);
+    add_mvn(builder);
+    add_gather(builder);
+    add_topk(builder);
+    add_nms(builder);
+    add_data_movement(builder);
+    return builder.cases;
+}
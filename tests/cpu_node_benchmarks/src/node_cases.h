@@ -0,0 +1,28 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <openvino/core/model.hpp>
+#include <string>
+#include <vector>
+
+/// @brief Single-operation model measured by the benchmark
+struct NodeCase {
+    /// Unique name of the case: <operation>/<precision>/<shapes>
+    std::string name;
+    /// Precision the node is executed in: f32 and bf16 cases are the same model executed with the
+    /// corresponding inference precision, i8 cases are quantized with FakeQuantize
+    ov::element::Type precision;
+    std::shared_ptr<ov::Model> model;
+    /// Number of arithmetic operations per inference, 0 for data movement operations
+    double flops;
+    /// Number of bytes of inputs, weights and outputs per inference in the model precision
+    double bytes;
+};
+
+/// @brief Creates the cases for the given precisions, i8 cases are created for the operations with
+/// quantized implementation only
+std::vector<NodeCase> make_node_cases(const std::vector<ov::element::Type>& precisions);
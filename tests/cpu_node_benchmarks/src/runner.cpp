@@ -0,0 +1,94 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "runner.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+using Time = std::chrono::high_resolution_clock;
+
+void fill_random(ov::Tensor& tensor) {
+    std::mt19937 generator(0);
+    if (tensor.get_element_type() != ov::element::f32)
+        throw std::logic_error("Only f32 model inputs are supported by the benchmark");
+    std::uniform_real_distribution<float> distribution(0.f, 1.f);
+    auto data = tensor.data<float>();
+    for (size_t i = 0; i < tensor.get_size(); i++)
+        data[i] = distribution(generator);
+}
+
+}  // namespace
+
+CaseResult run_case(ov::Core& core, const NodeCase& node_case, const RunConfig& config) {
+    ov::AnyMap properties{ov::num_streams(1)};
+    // f32 and i8 cases are executed in f32, the quantized nodes are selected by the plugin itself
+    properties.emplace(ov::hint::inference_precision(node_case.precision == ov::element::bf16 ? ov::element::bf16
+                                                                                                  : ov::element::f32));
+    if (config.nthreads)
+        properties.emplace(ov::inference_num_threads(static_cast<int32_t>(config.nthreads)));
+
+    auto compiled_model = core.compile_model(node_case.model, "CPU", properties);
+    auto request = compiled_model.create_infer_request();
+    for (const auto& input : compiled_model.inputs()) {
+        ov::Tensor tensor(input.get_element_type(), input.get_shape());
+        fill_random(tensor);
+        request.set_tensor(input, tensor);
+    }
+
+    // warm up: primitives creation and caches
+    request.infer();
+
+    std::vector<double> latencies;
+    const auto min_time = std::chrono::milliseconds(config.min_time_ms);
+    const auto start = Time::now();
+    while (latencies.size() < config.niter || Time::now() - start < min_time) {
+        const auto begin = Time::now();
+        request.infer();
+        latencies.push_back(std::chrono::duration<double, std::micro>(Time::now() - begin).count());
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+    const size_t middle = latencies.size() / 2;
+    const double median =
+        latencies.size() % 2 ? latencies[middle] : (latencies[middle - 1] + latencies[middle]) / 2;
+    return {median, latencies.front(), latencies.size()};
+}
+
+std::map<std::string, double> read_baseline(const std::string& path) {
+    std::ifstream file(path);
+    if (!file.is_open())
+        throw std::logic_error("Can't open the baseline file: " + path);
+
+    std::map<std::string, double> baseline;
+    std::string line;
+    // the header line
+    std::getline(file, line);
+    while (std::getline(file, line)) {
+        if (line.empty())
+            continue;
+        const auto separator = line.rfind(',');
+        if (separator == std::string::npos)
+            throw std::logic_error("Incorrect line in the baseline file " + path + ": " + line);
+        baseline[line.substr(0, separator)] = std::stod(line.substr(separator + 1));
+    }
+    return baseline;
+}
+
+void write_baseline(const std::string& path, const std::map<std::string, double>& results) {
+    std::ofstream file(path);
+    if (!file.is_open())
+        throw std::logic_error("Can't open the baseline file for writing: " + path);
+
+    file << "name,median_us" << std::endl;
+    for (const auto& result : results)
+        file << result.first << "," << result.second << std::endl;
+}
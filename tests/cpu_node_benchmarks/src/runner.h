@@ -0,0 +1,37 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <openvino/runtime/core.hpp>
+#include <string>
+
+#include "node_cases.h"
+
+/// @brief Measurement settings shared by all the cases
+struct RunConfig {
+    uint32_t niter;
+    uint32_t min_time_ms;
+    uint32_t nthreads;
+};
+
+/// @brief Result of the single case measurement
+struct CaseResult {
+    double median_us;
+    double min_us;
+    size_t iterations;
+};
+
+/**
+ * @brief Compiles the case model on CPU and measures the synchronous inference latency.
+ * Inferences are repeated until both the minimal number of iterations and the minimal time are reached.
+ */
+CaseResult run_case(ov::Core& core, const NodeCase& node_case, const RunConfig& config);
+
+/// @brief Reads the "name,median_us" baseline CSV file
+std::map<std::string, double> read_baseline(const std::string& path);
+
+/// @brief Writes the "name,median_us" baseline CSV file
+void write_baseline(const std::string& path, const std::map<std::string, double>& results);